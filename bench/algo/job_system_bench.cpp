@@ -0,0 +1,51 @@
+#include "benchmark_framework.hpp"
+#include "algo/job_system.hpp"
+#include "geo/matrix_transform.hpp"
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t transform_count = 100000;
+	constexpr std::size_t job_count = 10000;
+	constexpr std::size_t iterations = 50;
+}
+
+int main()
+{
+	tz::bench::Unit bench{"tz::algo::JobSystem (100k transforms)"};
+	tz::algo::JobSystem system;
+	std::vector<tz::Vec3> positions(transform_count, tz::Vec3{{1.0f, 2.0f, 3.0f}});
+	std::vector<tz::Vec3> rotations(transform_count, tz::Vec3{{0.1f, 0.2f, 0.3f}});
+	std::vector<tz::Vec3> scales(transform_count, tz::Vec3{{1.0f, 1.0f, 1.0f}});
+	std::vector<tz::Mat4> out(transform_count);
+
+	bench.add("tz::geo::model_batch (calling thread only)", iterations, [&]()
+	{
+		tz::geo::model_batch({positions.data(), transform_count}, {rotations.data(), transform_count}, {scales.data(), transform_count}, {out.data(), transform_count});
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("tz::geo::model_batch (across the JobSystem)", iterations, [&]()
+	{
+		tz::geo::model_batch({positions.data(), transform_count}, {rotations.data(), transform_count}, {scales.data(), transform_count}, {out.data(), transform_count}, &system);
+		tz::bench::do_not_optimise(out);
+	});
+	// Overhead of the system itself: The cost of a job should be negligible next to the work it does.
+	bench.add("JobSystem::execute (10k empty jobs)", iterations, [&]()
+	{
+		std::vector<tz::algo::JobHandle> jobs;
+		jobs.reserve(job_count);
+		for(std::size_t i = 0; i < job_count; i++)
+		{
+			jobs.push_back(system.execute([](){}));
+		}
+		for(const tz::algo::JobHandle& job : jobs)
+		{
+			system.wait(job);
+		}
+	});
+	bench.add("JobSystem::parallel_for (10k empty chunks)", iterations, [&]()
+	{
+		system.wait(system.parallel_for(0, job_count, 1, [](std::size_t){}));
+	});
+	return 0;
+}
@@ -0,0 +1,99 @@
+#ifndef TOPAZ_BENCHMARK_FRAMEWORK_HPP
+#define TOPAZ_BENCHMARK_FRAMEWORK_HPP
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace tz::bench
+{
+	namespace detail
+	{
+		inline const void* volatile sink = nullptr;
+	}
+
+	/**
+	 * Prevent the optimiser from discarding a value which is otherwise unused.
+	 * @param t Value to keep alive.
+	 */
+	template<typename T>
+	void do_not_optimise(const T& t)
+	{
+		detail::sink = &t;
+	}
+
+	/**
+	 * Represents a single timed measurement, possibly comprised of many iterations.
+	 */
+	class Case
+	{
+	public:
+		Case(const char* name, std::size_t iterations): case_name(name), iterations(iterations), total_ns(0.0){}
+
+		/**
+		 * Invoke the functor this->iterations times and record how long it took.
+		 * @param fn Functor to time.
+		 */
+		template<typename Functor>
+		void run(Functor&& fn)
+		{
+			using Clock = std::chrono::steady_clock;
+			// Warm caches and branch predictors before measuring.
+			fn();
+			auto begin = Clock::now();
+			for(std::size_t i = 0; i < this->iterations; i++)
+				fn();
+			auto end = Clock::now();
+			this->total_ns = std::chrono::duration<double, std::nano>(end - begin).count();
+		}
+
+		double ns_per_iteration() const
+		{
+			return this->total_ns / static_cast<double>(this->iterations);
+		}
+
+		const char* name() const
+		{
+			return this->case_name;
+		}
+	private:
+		const char* case_name;
+		std::size_t iterations;
+		double total_ns;
+	};
+
+	/**
+	 * Collection of benchmark Cases. Prints a summary table upon destruction.
+	 */
+	class Unit
+	{
+	public:
+		Unit(const char* name): unit_name(name), cases(){}
+		~Unit()
+		{
+			std::printf("%s\n", this->unit_name);
+			for(const Case& c : this->cases)
+			{
+				std::printf("\t%-56s %14.1f ns/iter\n", c.name(), c.ns_per_iteration());
+			}
+		}
+
+		/**
+		 * Time the given functor and record the result.
+		 * @param name Name of this measurement. Must outlive the Unit.
+		 * @param iterations Number of times to invoke the functor.
+		 * @param fn Functor to time.
+		 */
+		template<typename Functor>
+		void add(const char* name, std::size_t iterations, Functor&& fn)
+		{
+			Case c{name, iterations};
+			c.run(fn);
+			this->cases.push_back(c);
+		}
+	private:
+		const char* unit_name;
+		std::vector<Case> cases;
+	};
+}
+
+#endif // TOPAZ_BENCHMARK_FRAMEWORK_HPP
@@ -0,0 +1,106 @@
+#include "benchmark_framework.hpp"
+#include "geo/bvh.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Roughly a detailed level mesh.
+	constexpr std::size_t triangle_count = 100000;
+	constexpr std::size_t ray_count = 10000;
+	// Brute force is so slow that it only fires a handful of rays.
+	constexpr std::size_t brute_force_ray_count = 100;
+	constexpr float max_distance = 10000.0f;
+}
+
+int main()
+{
+	std::mt19937 rng{0};
+	std::uniform_real_distribution<float> coordinate{-500.0f, 500.0f};
+	std::uniform_real_distribution<float> offset{-2.0f, 2.0f};
+	std::uniform_real_distribution<float> component{-1.0f, 1.0f};
+	std::vector<tz::Vec3> positions;
+	std::vector<tz::geo::AABB> bounds;
+	for(std::size_t i = 0; i < triangle_count; i++)
+	{
+		const tz::Vec3 centre{{coordinate(rng), coordinate(rng), coordinate(rng)}};
+		tz::geo::AABB box{centre, centre};
+		for(std::size_t j = 0; j < 3; j++)
+		{
+			const tz::Vec3 vertex{{centre[0] + offset(rng), centre[1] + offset(rng), centre[2] + offset(rng)}};
+			positions.push_back(vertex);
+			for(std::size_t axis = 0; axis < 3; axis++)
+			{
+				box.min[axis] = std::min(box.min[axis], vertex[axis]);
+				box.max[axis] = std::max(box.max[axis], vertex[axis]);
+			}
+		}
+		bounds.push_back(box);
+	}
+	std::vector<tz::geo::Ray> rays;
+	std::vector<tz::geo::AABB> queries;
+	for(std::size_t i = 0; i < ray_count; i++)
+	{
+		rays.push_back({{{coordinate(rng), coordinate(rng), coordinate(rng)}}, {{component(rng), component(rng), component(rng)}}});
+		const tz::Vec3 min{{coordinate(rng), coordinate(rng), coordinate(rng)}};
+		queries.push_back({min, {{min[0] + 10.0f, min[1] + 10.0f, min[2] + 10.0f}}});
+	}
+	auto intersect_triangle = [&positions](const tz::geo::Ray& ray, std::size_t triangle, float max)
+	{
+		return tz::geo::intersect(ray, positions[triangle * 3], positions[(triangle * 3) + 1], positions[(triangle * 3) + 2], max);
+	};
+	tz::geo::BVH bvh;
+	std::size_t hits = 0;
+
+	tz::bench::Unit bench{tz::geo::simd::enabled ? "tz::geo::BVH (100k triangles, SIMD)" : "tz::geo::BVH (100k triangles, SIMD disabled)"};
+
+	bench.add("BVH build", 5, [&]()
+	{
+		bvh = tz::geo::BVH{{bounds.data(), bounds.size()}};
+		tz::bench::do_not_optimise(bvh);
+	});
+	bench.add("Brute-force closest hit (100 rays)", 3, [&]()
+	{
+		for(std::size_t r = 0; r < brute_force_ray_count; r++)
+		{
+			float closest = max_distance;
+			for(std::size_t i = 0; i < triangle_count; i++)
+			{
+				const std::optional<float> distance = intersect_triangle(rays[r], i, closest);
+				if(distance.has_value())
+					closest = distance.value();
+			}
+			hits += closest < max_distance;
+		}
+		tz::bench::do_not_optimise(hits);
+	});
+	bench.add("BVH::closest_hit (100 rays)", 100, [&]()
+	{
+		for(std::size_t r = 0; r < brute_force_ray_count; r++)
+		{
+			const tz::geo::Ray& ray = rays[r];
+			hits += bvh.closest_hit(ray, max_distance, [&](std::size_t triangle, float max){return intersect_triangle(ray, triangle, max);}).has_value();
+		}
+		tz::bench::do_not_optimise(hits);
+	});
+	bench.add("BVH::closest_hit (10k rays)", 10, [&]()
+	{
+		for(const tz::geo::Ray& ray : rays)
+			hits += bvh.closest_hit(ray, max_distance, [&](std::size_t triangle, float max){return intersect_triangle(ray, triangle, max);}).has_value();
+		tz::bench::do_not_optimise(hits);
+	});
+	bench.add("BVH::raycast (10k rays)", 10, [&]()
+	{
+		for(const tz::geo::Ray& ray : rays)
+			hits += bvh.raycast(ray, max_distance, [&](std::size_t triangle, float max){return intersect_triangle(ray, triangle, max);});
+		tz::bench::do_not_optimise(hits);
+	});
+	bench.add("BVH::overlap (10k boxes)", 10, [&]()
+	{
+		for(const tz::geo::AABB& query : queries)
+			bvh.overlap(query, [&hits](std::size_t){hits++;});
+		tz::bench::do_not_optimise(hits);
+	});
+	return 0;
+}
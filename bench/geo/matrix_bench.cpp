@@ -0,0 +1,112 @@
+#include "benchmark_framework.hpp"
+#include "geo/matrix.hpp"
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Small enough that every operand stays in cache. Otherwise we mostly measure memory bandwidth.
+	constexpr std::size_t matrix_count = 1024;
+	constexpr std::size_t iterations = 1000;
+
+	template<std::size_t N>
+	std::vector<tz::Matrix<float, N, N>> random_matrices(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> dist{-1.0f, 1.0f};
+		std::vector<tz::Matrix<float, N, N>> matrices(matrix_count);
+		for(auto& m : matrices)
+		{
+			for(std::size_t i = 0; i < N; i++)
+			{
+				for(std::size_t j = 0; j < N; j++)
+				{
+					m(i, j) = dist(rng);
+				}
+				// Keep them comfortably invertible.
+				m(i, i) += 4.0f;
+			}
+		}
+		return matrices;
+	}
+}
+
+int main()
+{
+	std::mt19937 rng{0};
+	auto lhs = random_matrices<4>(rng);
+	auto rhs = random_matrices<4>(rng);
+	auto lhs3 = random_matrices<3>(rng);
+	std::vector<tz::Vec4> vecs(matrix_count, tz::Vec4{{1.0f, 2.0f, 3.0f, 1.0f}});
+	// Results are written out rather than accumulated, so that we time the kernels rather than the accumulation.
+	std::vector<tz::Mat4> out4(matrix_count);
+	std::vector<tz::Mat3> out3(matrix_count);
+	std::vector<tz::Vec4> outv(matrix_count);
+
+	tz::bench::Unit bench{tz::geo::simd::enabled ? (tz::geo::simd::avx ? "tz::Matrix Kernels (1024 matrices, SIMD with AVX)" : "tz::Matrix Kernels (1024 matrices, SIMD)") : "tz::Matrix Kernels (1024 matrices, SIMD disabled)"};
+
+	bench.add("Mat4 * Mat4 (generic)", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < matrix_count; i++)
+			out4[i] = tz::detail::generic_multiply(lhs[i], rhs[i]);
+		tz::bench::do_not_optimise(out4);
+	});
+	bench.add("Mat4 * Mat4", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < matrix_count; i++)
+			out4[i] = lhs[i] * rhs[i];
+		tz::bench::do_not_optimise(out4);
+	});
+
+	bench.add("Mat4 * Vec4 (generic)", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < matrix_count; i++)
+			outv[i] = tz::detail::generic_multiply(lhs[i], vecs[i]);
+		tz::bench::do_not_optimise(outv);
+	});
+	bench.add("Mat4 * Vec4", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < matrix_count; i++)
+			outv[i] = lhs[i] * vecs[i];
+		tz::bench::do_not_optimise(outv);
+	});
+
+	bench.add("Mat4 transpose (generic)", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < matrix_count; i++)
+			out4[i] = tz::detail::generic_transpose(lhs[i]);
+		tz::bench::do_not_optimise(out4);
+	});
+	bench.add("Mat4 transpose", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < matrix_count; i++)
+			out4[i] = lhs[i].transpose();
+		tz::bench::do_not_optimise(out4);
+	});
+
+	bench.add("Mat4 inverse (generic)", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < matrix_count; i++)
+			out4[i] = tz::detail::generic_inverse(lhs[i]);
+		tz::bench::do_not_optimise(out4);
+	});
+	bench.add("Mat4 inverse", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < matrix_count; i++)
+			out4[i] = lhs[i].inverse();
+		tz::bench::do_not_optimise(out4);
+	});
+
+	bench.add("Mat3 inverse (generic)", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < matrix_count; i++)
+			out3[i] = tz::detail::generic_inverse(lhs3[i]);
+		tz::bench::do_not_optimise(out3);
+	});
+	bench.add("Mat3 inverse", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < matrix_count; i++)
+			out3[i] = lhs3[i].inverse();
+		tz::bench::do_not_optimise(out3);
+	});
+	return 0;
+}
@@ -0,0 +1,93 @@
+#include "benchmark_framework.hpp"
+#include "geo/quaternion_batch.hpp"
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Roughly the bone count of a crowd of animated skeletons.
+	constexpr std::size_t quaternion_count = 100000;
+	constexpr std::size_t iterations = 100;
+}
+
+int main()
+{
+	std::mt19937 rng{0};
+	std::uniform_real_distribution<float> angle{-3.14159f, 3.14159f};
+	std::uniform_real_distribution<float> component{-10.0f, 10.0f};
+	std::uniform_real_distribution<float> factor{0.0f, 1.0f};
+	std::vector<tz::Quaternion> from, to;
+	std::vector<tz::Vec3> vectors;
+	std::vector<float> t;
+	for(std::size_t i = 0; i < quaternion_count; i++)
+	{
+		from.push_back(tz::Quaternion::from_eulers({{angle(rng), angle(rng), angle(rng)}}));
+		to.push_back(tz::Quaternion::from_eulers({{angle(rng), angle(rng), angle(rng)}}));
+		vectors.push_back({{component(rng), component(rng), component(rng)}});
+		t.push_back(factor(rng));
+	}
+	std::vector<tz::Quaternion> out(quaternion_count);
+	std::vector<tz::Vec3> rotated(quaternion_count);
+	std::vector<tz::Mat4> matrices(quaternion_count);
+	const tz::mem::Span<const tz::Quaternion> from_span{from.data(), quaternion_count};
+	const tz::mem::Span<const tz::Quaternion> to_span{to.data(), quaternion_count};
+
+	tz::bench::Unit bench{tz::geo::simd::enabled ? "tz::geo Quaternions (100k quaternions, SIMD)" : "tz::geo Quaternions (100k quaternions, SIMD disabled)"};
+
+	bench.add("Quaternion::operator* per quaternion", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < quaternion_count; i++)
+			out[i] = from[i] * to[i];
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("tz::geo::multiply_batch", iterations, [&]()
+	{
+		tz::geo::multiply_batch(from_span, to_span, {out.data(), quaternion_count});
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("Quaternion::nlerp per quaternion", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < quaternion_count; i++)
+			out[i] = tz::Quaternion::nlerp(from[i], to[i], t[i]);
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("tz::geo::nlerp_batch", iterations, [&]()
+	{
+		tz::geo::nlerp_batch(from_span, to_span, {t.data(), quaternion_count}, {out.data(), quaternion_count});
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("Quaternion::slerp per quaternion", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < quaternion_count; i++)
+			out[i] = tz::Quaternion::slerp(from[i], to[i], t[i]);
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("tz::geo::slerp_batch", iterations, [&]()
+	{
+		tz::geo::slerp_batch(from_span, to_span, {t.data(), quaternion_count}, {out.data(), quaternion_count});
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("Quaternion::rotate per vector", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < quaternion_count; i++)
+			rotated[i] = from[i].rotate(vectors[i]);
+		tz::bench::do_not_optimise(rotated);
+	});
+	bench.add("tz::geo::rotate_batch", iterations, [&]()
+	{
+		tz::geo::rotate_batch(from_span, {vectors.data(), quaternion_count}, {rotated.data(), quaternion_count});
+		tz::bench::do_not_optimise(rotated);
+	});
+	bench.add("Quaternion::to_matrix per quaternion", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < quaternion_count; i++)
+			matrices[i] = from[i].to_matrix();
+		tz::bench::do_not_optimise(matrices);
+	});
+	bench.add("tz::geo::to_matrix_batch", iterations, [&]()
+	{
+		tz::geo::to_matrix_batch(from_span, {matrices.data(), quaternion_count});
+		tz::bench::do_not_optimise(matrices);
+	});
+	return 0;
+}
@@ -0,0 +1,92 @@
+#include "benchmark_framework.hpp"
+#include "geo/matrix_transform.hpp"
+#include "algo/job_system.hpp"
+#include <random>
+#include <vector>
+
+namespace
+{
+	// A typical per-frame transform count for a large scene.
+	constexpr std::size_t transform_count = 100000;
+	constexpr std::size_t iterations = 100;
+}
+
+int main()
+{
+	std::mt19937 rng{0};
+	std::uniform_real_distribution<float> position{-100.0f, 100.0f};
+	std::uniform_real_distribution<float> angle{-3.14159f, 3.14159f};
+	std::uniform_real_distribution<float> scale{0.5f, 2.0f};
+	std::vector<tz::Vec3> positions, rotations, scales;
+	std::vector<tz::Quaternion> quaternions;
+	for(std::size_t i = 0; i < transform_count; i++)
+	{
+		positions.push_back({{position(rng), position(rng), position(rng)}});
+		rotations.push_back({{angle(rng), angle(rng), angle(rng)}});
+		quaternions.push_back(tz::Quaternion::from_eulers(rotations.back()));
+		scales.push_back({{scale(rng), scale(rng), scale(rng)}});
+	}
+	std::vector<tz::Mat4> out(transform_count);
+	tz::algo::JobSystem job_system;
+
+	tz::bench::Unit bench{tz::geo::simd::enabled ? "tz::geo Transforms (100k transforms, SIMD)" : "tz::geo Transforms (100k transforms, SIMD disabled)"};
+
+	bench.add("tz::geo::model per transform", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < transform_count; i++)
+			out[i] = tz::geo::model(positions[i], rotations[i], scales[i]);
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("tz::geo::model_batch (euler, calling thread only)", iterations, [&]()
+	{
+		tz::geo::model_batch({positions.data(), transform_count}, {rotations.data(), transform_count}, {scales.data(), transform_count}, {out.data(), transform_count});
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("tz::geo::model_batch (euler, JobSystem)", iterations, [&]()
+	{
+		tz::geo::model_batch({positions.data(), transform_count}, {rotations.data(), transform_count}, {scales.data(), transform_count}, {out.data(), transform_count}, &job_system);
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("tz::geo::model_batch (quaternion, calling thread only)", iterations, [&]()
+	{
+		tz::geo::model_batch({positions.data(), transform_count}, {quaternions.data(), transform_count}, {scales.data(), transform_count}, {out.data(), transform_count});
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("tz::geo::model_batch (quaternion, JobSystem)", iterations, [&]()
+	{
+		tz::geo::model_batch({positions.data(), transform_count}, {quaternions.data(), transform_count}, {scales.data(), transform_count}, {out.data(), transform_count}, &job_system);
+		tz::bench::do_not_optimise(out);
+	});
+
+	// Inverting the model matrices computed above, as is done per-object for lighting and picking.
+	std::vector<tz::Mat4> models = out;
+	std::vector<tz::Mat4> rigids(transform_count);
+	for(std::size_t i = 0; i < transform_count; i++)
+		rigids[i] = tz::geo::translate(positions[i]) * tz::geo::rotate(rotations[i]);
+	std::vector<tz::Mat3> normals(transform_count);
+	bench.add("Mat4::inverse", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < transform_count; i++)
+			out[i] = models[i].inverse();
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("tz::geo::affine_inverse", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < transform_count; i++)
+			out[i] = tz::geo::affine_inverse(models[i]);
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("tz::geo::rigid_inverse", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < transform_count; i++)
+			out[i] = tz::geo::rigid_inverse(rigids[i]);
+		tz::bench::do_not_optimise(out);
+	});
+	bench.add("tz::geo::normal_matrix", iterations, [&]()
+	{
+		for(std::size_t i = 0; i < transform_count; i++)
+			normals[i] = tz::geo::normal_matrix(models[i]);
+		tz::bench::do_not_optimise(normals);
+	});
+	return 0;
+}
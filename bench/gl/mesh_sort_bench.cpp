@@ -0,0 +1,91 @@
+#include "benchmark_framework.hpp"
+#include "gl/mesh.hpp"
+#include "algo/job_system.hpp"
+#include <algorithm>
+#include <random>
+
+namespace
+{
+	constexpr std::size_t triangle_count = 100000;
+	constexpr std::size_t iterations = 20;
+
+	// The comparison sort sort_indices used before it was radix-sorted: both centroids and a sqrt on every comparison.
+	void legacy_sort_indices(tz::gl::IndexedMesh& mesh, tz::Vec3 closest_to)
+	{
+		struct Triangle
+		{
+			unsigned int a, b, c;
+		};
+		auto get_triangle_pos = [&mesh](const Triangle& t)->tz::Vec3
+		{
+			return (mesh.vertices[t.a].position + mesh.vertices[t.b].position + mesh.vertices[t.c].position) / 3.0f;
+		};
+		std::vector<Triangle> triangles;
+		triangles.reserve(mesh.indices.size() / 3);
+		for(std::size_t i = 0; i < mesh.indices.size(); i += 3)
+		{
+			triangles.push_back({mesh.indices[i], mesh.indices[i + 1], mesh.indices[i + 2]});
+		}
+		auto dist = [closest_to](tz::Vec3 position){return (closest_to - position).length();};
+		std::sort(triangles.begin(), triangles.end(), [get_triangle_pos, dist](Triangle lhs, Triangle rhs){return dist(get_triangle_pos(lhs)) < dist(get_triangle_pos(rhs));});
+		for(std::size_t i = 0; i < triangles.size(); i++)
+		{
+			mesh.indices[i * 3] = triangles[i].a;
+			mesh.indices[(i * 3) + 1] = triangles[i].b;
+			mesh.indices[(i * 3) + 2] = triangles[i].c;
+		}
+	}
+}
+
+int main()
+{
+	tz::bench::Unit bench{"tz::gl::sort_indices (100k triangles)"};
+	std::mt19937 rng{0};
+	std::uniform_real_distribution<float> coordinate{-100.0f, 100.0f};
+	tz::gl::IndexedMesh mesh;
+	for(std::size_t i = 0; i < triangle_count * 3; i++)
+	{
+		mesh.vertices.push_back({{{coordinate(rng), coordinate(rng), coordinate(rng)}}, {{0.0f, 0.0f}}});
+		mesh.indices.push_back(static_cast<tz::gl::Index>(i));
+	}
+	const tz::Vec3 camera{{10.0f, 20.0f, 30.0f}};
+	tz::algo::JobSystem job_system;
+
+	// Each frame, the camera moves slightly and the mesh is re-sorted. The indices start each frame in the previous frame's order, as they would in a real scene.
+	tz::Vec3 moving_camera = camera;
+	auto next_frame = [&moving_camera]()
+	{
+		moving_camera[0] += 0.002f;
+		moving_camera[2] -= 0.001f;
+		return moving_camera;
+	};
+	tz::gl::sort_indices(mesh, camera);
+	bench.add("Legacy std::sort by centroid distance", iterations, [&]()
+	{
+		legacy_sort_indices(mesh, next_frame());
+		tz::bench::do_not_optimise(mesh);
+	});
+	bench.add("sort_indices", iterations, [&]()
+	{
+		tz::gl::sort_indices(mesh, next_frame());
+		tz::bench::do_not_optimise(mesh);
+	});
+	bench.add("sort_indices (JobSystem)", iterations, [&]()
+	{
+		tz::gl::sort_indices(mesh, next_frame(), &job_system);
+		tz::bench::do_not_optimise(mesh);
+	});
+	bench.add("resort_indices", iterations, [&]()
+	{
+		tz::gl::resort_indices(mesh, next_frame());
+		tz::bench::do_not_optimise(mesh);
+	});
+	// Without coherence, e.g the first frame or after a camera cut.
+	bench.add("resort_indices (camera cut)", iterations, [&]()
+	{
+		moving_camera[1] = moving_camera[1] > 0.0f ? -150.0f : 150.0f;
+		tz::gl::resort_indices(mesh, moving_camera);
+		tz::bench::do_not_optimise(mesh);
+	});
+	return 0;
+}
@@ -0,0 +1,172 @@
+#include "benchmark_framework.hpp"
+#include "memory/offset_allocator.hpp"
+#include <map>
+#include <random>
+
+namespace
+{
+	constexpr std::size_t capacity = 1 << 20;
+	constexpr std::size_t op_count = 100000;
+	constexpr std::size_t iterations = 20;
+
+	// A single step of a mesh churn workload. If size is zero, free the live allocation at victim (modulo live count).
+	struct Op
+	{
+		std::size_t size;
+		std::size_t victim;
+	};
+
+	// The obvious alternative: A first-fit free-list keyed by offset, coalescing on free.
+	class FirstFitAllocator
+	{
+	public:
+		FirstFitAllocator(std::size_t capacity): free_regions{{0, capacity}}{}
+
+		std::optional<tz::mem::OffsetAllocation> allocate(std::size_t size)
+		{
+			for(auto iter = this->free_regions.begin(); iter != this->free_regions.end(); iter++)
+			{
+				if(iter->second < size)
+					continue;
+				std::size_t offset = iter->first;
+				std::size_t remainder = iter->second - size;
+				this->free_regions.erase(iter);
+				if(remainder > 0)
+					this->free_regions.emplace(offset + size, remainder);
+				return tz::mem::OffsetAllocation{offset, size, 0};
+			}
+			return std::nullopt;
+		}
+
+		void free(tz::mem::OffsetAllocation allocation)
+		{
+			auto iter = this->free_regions.emplace(allocation.offset, allocation.size).first;
+			auto next = std::next(iter);
+			if(next != this->free_regions.end() && iter->first + iter->second == next->first)
+			{
+				iter->second += next->second;
+				this->free_regions.erase(next);
+			}
+			if(iter != this->free_regions.begin())
+			{
+				auto prev = std::prev(iter);
+				if(prev->first + prev->second == iter->first)
+				{
+					prev->second += iter->second;
+					this->free_regions.erase(iter);
+				}
+			}
+		}
+	private:
+		std::map<std::size_t, std::size_t> free_regions;
+	};
+
+	std::vector<Op> make_workload()
+	{
+		// Mesh-sized allocations with a long tail, hovering at roughly three-quarters occupancy.
+		std::mt19937 rng{0};
+		std::uniform_int_distribution<std::size_t> size_dist{64, 4096};
+		std::vector<Op> ops;
+		ops.reserve(op_count);
+		std::size_t approx_used = 0;
+		for(std::size_t i = 0; i < op_count; i++)
+		{
+			bool should_free = approx_used > (capacity * 3) / 4 ? (rng() % 4 != 0) : (rng() % 4 == 0);
+			if(should_free)
+			{
+				ops.push_back({0, rng()});
+				approx_used -= std::min(approx_used, std::size_t{2080});
+			}
+			else
+			{
+				std::size_t size = size_dist(rng);
+				ops.push_back({size, 0});
+				approx_used += size;
+			}
+		}
+		return ops;
+	}
+
+	struct Result
+	{
+		std::size_t failures = 0;
+	};
+
+	template<typename Allocator>
+	Result run_workload(Allocator& alloc, const std::vector<Op>& ops)
+	{
+		Result result;
+		std::vector<tz::mem::OffsetAllocation> live;
+		live.reserve(op_count);
+		for(const Op& op : ops)
+		{
+			if(op.size == 0)
+			{
+				if(live.empty())
+					continue;
+				std::size_t idx = op.victim % live.size();
+				alloc.free(live[idx]);
+				live[idx] = live.back();
+				live.pop_back();
+			}
+			else
+			{
+				auto a = alloc.allocate(op.size);
+				if(a.has_value())
+					live.push_back(a.value());
+				else
+					result.failures++;
+			}
+		}
+		for(const tz::mem::OffsetAllocation& a : live)
+			alloc.free(a);
+		return result;
+	}
+}
+
+int main()
+{
+	const std::vector<Op> ops = make_workload();
+	std::size_t total_failures = 0;
+	{
+		tz::bench::Unit bench{"tz::mem::OffsetAllocator Churn (100000 ops over 1M units)"};
+		bench.add("First-fit std::map free-list", iterations, [&ops, &total_failures]()
+		{
+			FirstFitAllocator alloc{capacity};
+			total_failures += run_workload(alloc, ops).failures;
+		});
+		bench.add("tz::mem::OffsetAllocator (TLSF)", iterations, [&ops, &total_failures]()
+		{
+			tz::mem::OffsetAllocator alloc{capacity};
+			total_failures += run_workload(alloc, ops).failures;
+		});
+	}
+	tz::bench::do_not_optimise(total_failures);
+
+	// Replay half of the workload and report how fragmented the allocator is mid-churn.
+	tz::mem::OffsetAllocator alloc{capacity};
+	std::vector<Op> half{ops.begin(), ops.begin() + (op_count / 2)};
+	std::vector<tz::mem::OffsetAllocation> live;
+	std::size_t failures = 0;
+	for(const Op& op : half)
+	{
+		if(op.size == 0)
+		{
+			if(live.empty())
+				continue;
+			std::size_t idx = op.victim % live.size();
+			alloc.free(live[idx]);
+			live[idx] = live.back();
+			live.pop_back();
+		}
+		else if(auto a = alloc.allocate(op.size); a.has_value())
+			live.push_back(a.value());
+		else
+			failures++;
+	}
+	tz::mem::OffsetAllocatorStats stats = alloc.stats();
+	std::printf("Fragmentation after %zu ops:\n", half.size());
+	std::printf("\tUsed: %zu/%zu, Allocations: %zu, Failed allocations: %zu\n", stats.used, stats.capacity, stats.allocation_count, failures);
+	std::printf("\tFree regions: %zu, Largest free region: %zu, Fragmentation: %.3f, Merges: %zu\n", stats.free_region_count, stats.largest_free_region, stats.fragmentation(), stats.coalesce_count);
+	return 0;
+}
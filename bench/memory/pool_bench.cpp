@@ -0,0 +1,76 @@
+#include "benchmark_framework.hpp"
+#include "memory/pool.hpp"
+#include <random>
+
+namespace
+{
+	constexpr std::size_t slot_count = 65536;
+	constexpr std::size_t iterations = 200;
+
+	// The occupancy mask UniformPool used before it became a packed bitset: one wrapped bool per slot.
+	class LegacyBool
+	{
+	public:
+		LegacyBool(bool b): b(b){}
+		operator bool() const{return this->b;}
+	private:
+		bool b;
+	};
+
+	struct FillRatio
+	{
+		float ratio;
+		const char* legacy_name;
+		const char* packed_name;
+	};
+}
+
+int main()
+{
+	tz::bench::Unit bench{"tz::mem::UniformPool Live Iteration (65536 slots)"};
+	constexpr FillRatio ratios[] =
+	{
+		{0.01f, "Legacy mask scan (1% full)", "for_each_live (1% full)"},
+		{0.10f, "Legacy mask scan (10% full)", "for_each_live (10% full)"},
+		{0.50f, "Legacy mask scan (50% full)", "for_each_live (50% full)"},
+		{0.90f, "Legacy mask scan (90% full)", "for_each_live (90% full)"},
+		{1.00f, "Legacy mask scan (100% full)", "for_each_live (100% full)"},
+	};
+
+	tz::mem::AutoBlock blk{slot_count * sizeof(float)};
+	std::mt19937 rng{0};
+	for(const FillRatio& fill : ratios)
+	{
+		tz::mem::UniformPool<float> pool{blk};
+		std::vector<LegacyBool> legacy_mask;
+		legacy_mask.reserve(slot_count);
+		std::bernoulli_distribution live{fill.ratio};
+		for(std::size_t i = 0; i < slot_count; i++)
+		{
+			bool b = live(rng);
+			legacy_mask.push_back(b);
+			if(b)
+				pool.set(i, static_cast<float>(i));
+		}
+
+		bench.add(fill.legacy_name, iterations, [&pool, &legacy_mask]()
+		{
+			float sum = 0.0f;
+			for(std::size_t i = 0; i < legacy_mask.size(); i++)
+			{
+				if(legacy_mask[i])
+					sum += pool[i];
+			}
+			tz::bench::do_not_optimise(sum);
+		});
+
+		bench.add(fill.packed_name, iterations, [&pool]()
+		{
+			float sum = 0.0f;
+			pool.for_each_live([&sum](float f){sum += f;});
+			tz::bench::do_not_optimise(sum);
+		});
+		pool.clear();
+	}
+	return 0;
+}
@@ -0,0 +1,71 @@
+#include "benchmark_framework.hpp"
+#include "render/frustum_culler.hpp"
+#include "geo/matrix_transform.hpp"
+#include <random>
+#include <vector>
+
+namespace
+{
+	// A large open-world scene's worth of objects.
+	constexpr std::size_t object_count = 100000;
+	constexpr std::size_t iterations = 100;
+}
+
+int main()
+{
+	std::mt19937 rng{0};
+	std::uniform_real_distribution<float> coordinate{-500.0f, 500.0f};
+	std::uniform_real_distribution<float> size{0.5f, 5.0f};
+	std::vector<tz::geo::Bounds> bounds;
+	std::vector<tz::geo::AABB> boxes;
+	std::vector<tz::geo::BoundingSphere> spheres;
+	tz::gl::IndexSnippetList snippets;
+	for(std::size_t i = 0; i < object_count; i++)
+	{
+		const tz::Vec3 centre{{coordinate(rng), coordinate(rng), coordinate(rng)}};
+		const float half_size = size(rng);
+		const tz::Vec3 min{{centre[0] - half_size, centre[1] - half_size, centre[2] - half_size}};
+		const tz::Vec3 max{{centre[0] + half_size, centre[1] + half_size, centre[2] + half_size}};
+		bounds.push_back({{min, max}, {centre, half_size * 1.7320508f}});
+		boxes.push_back(bounds.back().box);
+		spheres.push_back(bounds.back().sphere);
+		snippets.emplace_range(i * 36, (i * 36) + 35, i * 24);
+	}
+	const tz::render::FrustumCuller culler{tz::geo::perspective(1.5707963f, 16.0f / 9.0f, 0.1f, 1000.0f) * tz::geo::view({{{0.0f, 0.0f, 0.0f}}}, {{{0.0f, 0.0f, 0.0f}}})};
+	std::vector<std::size_t> visible(object_count);
+	tz::gl::MDIDrawCommandList commands;
+
+	tz::bench::Unit bench{tz::geo::simd::enabled ? "tz::render::FrustumCuller (100k objects, SIMD)" : "tz::render::FrustumCuller (100k objects, SIMD disabled)"};
+
+	bench.add("FrustumCuller::visible per box", iterations, [&]()
+	{
+		std::size_t visible_count = 0;
+		for(std::size_t i = 0; i < object_count; i++)
+		{
+			if(culler.visible(boxes[i]))
+				visible[visible_count++] = i;
+		}
+		tz::bench::do_not_optimise(visible);
+	});
+	bench.add("FrustumCuller::cull boxes", iterations, [&]()
+	{
+		culler.cull(tz::mem::Span<const tz::geo::AABB>{boxes.data(), object_count}, {visible.data(), object_count});
+		tz::bench::do_not_optimise(visible);
+	});
+	bench.add("FrustumCuller::cull spheres", iterations, [&]()
+	{
+		culler.cull(tz::mem::Span<const tz::geo::BoundingSphere>{spheres.data(), object_count}, {visible.data(), object_count});
+		tz::bench::do_not_optimise(visible);
+	});
+	bench.add("IndexSnippetList::get_command_list (no culling)", iterations, [&]()
+	{
+		commands = snippets.get_command_list();
+		tz::bench::do_not_optimise(commands);
+	});
+	bench.add("FrustumCuller::cull snippets into MDIDrawCommandList", iterations, [&]()
+	{
+		commands = culler.cull(snippets, {bounds.data(), object_count});
+		tz::bench::do_not_optimise(commands);
+	});
+	return 0;
+}
@@ -0,0 +1,263 @@
+#include "algo/job_system.hpp"
+#include <algorithm>
+
+namespace tz::algo
+{
+	namespace detail
+	{
+		struct Job : public std::enable_shared_from_this<Job>
+		{
+			std::function<void()> work = nullptr;
+			/// Job which spawned this one, and so cannot complete until this one does.
+			std::shared_ptr<Job> parent = nullptr;
+			/// One for the job itself, plus one for each child which has not completed.
+			std::atomic<std::size_t> unfinished{1};
+			/// One for each dependency which has not completed, plus one while the job is being submitted.
+			std::atomic<std::size_t> pending_dependencies{1};
+			std::atomic<bool> complete{false};
+			/// Guards dependents, so that a job cannot be added as a dependent after it is too late for it to be released.
+			std::mutex mutex;
+			std::vector<std::shared_ptr<Job>> dependents;
+		};
+	}
+
+	namespace
+	{
+		thread_local const JobSystem* current_system = nullptr;
+		thread_local std::size_t current_queue_index = 0;
+	}
+
+	JobHandle::JobHandle(std::shared_ptr<detail::Job> job): job(std::move(job)){}
+
+	bool JobHandle::valid() const
+	{
+		return this->job != nullptr;
+	}
+
+	bool JobHandle::complete() const
+	{
+		return !this->valid() || this->job->complete.load();
+	}
+
+	JobSystem::JobSystem(std::size_t worker_count): queues(), workers(), queued_count(0), sleeping_count(0), sleep_mutex(), job_queued(), stopping(false), blocked_count(0), complete_mutex(), job_complete()
+	{
+		for(std::size_t i = 0; i <= worker_count; i++)
+		{
+			this->queues.push_back(std::make_unique<WorkQueue>());
+		}
+		this->workers.reserve(worker_count);
+		for(std::size_t i = 1; i <= worker_count; i++)
+		{
+			this->workers.emplace_back(&JobSystem::work, this, i);
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		// Without any workers, nothing else would run what's left.
+		while(this->try_run()){}
+		{
+			std::lock_guard<std::mutex> lock{this->sleep_mutex};
+			this->stopping = true;
+		}
+		this->job_queued.notify_all();
+		for(std::thread& worker : this->workers)
+		{
+			worker.join();
+		}
+	}
+
+	std::size_t JobSystem::default_worker_count()
+	{
+		return std::max(std::thread::hardware_concurrency(), 1u) - 1;
+	}
+
+	std::size_t JobSystem::worker_count() const
+	{
+		return this->workers.size();
+	}
+
+	JobHandle JobSystem::execute(std::function<void()> work)
+	{
+		return this->execute(std::move(work), {nullptr, 0});
+	}
+
+	JobHandle JobSystem::execute(std::function<void()> work, tz::mem::Span<const JobHandle> dependencies)
+	{
+		auto job = std::make_shared<detail::Job>();
+		job->work = std::move(work);
+		return this->submit(std::move(job), dependencies);
+	}
+
+	void JobSystem::wait(const JobHandle& job, WaitPolicy policy)
+	{
+		if(job.complete())
+			return;
+		if(policy == WaitPolicy::Help || this->workers.empty())
+		{
+			while(!job.complete())
+			{
+				if(!this->try_run())
+					std::this_thread::yield();
+			}
+			return;
+		}
+		this->blocked_count++;
+		{
+			std::unique_lock<std::mutex> lock{this->complete_mutex};
+			this->job_complete.wait(lock, [&job](){return job.complete();});
+		}
+		this->blocked_count--;
+	}
+
+	JobHandle JobSystem::split(std::size_t begin, std::size_t end, std::size_t grain_size, std::shared_ptr<const ChunkFunction> chunk, tz::mem::Span<const JobHandle> dependencies)
+	{
+		auto job = std::make_shared<detail::Job>();
+		// The job only spawns the chunks once its dependencies are met. It owns its work, so the raw pointer is valid whenever the work runs.
+		detail::Job* parent = job.get();
+		job->work = [this, parent, begin, end, grain_size, chunk = std::move(chunk)]()
+		{
+			for(std::size_t chunk_begin = begin; chunk_begin < end; chunk_begin += std::min(grain_size, end - chunk_begin))
+			{
+				const std::size_t chunk_end = chunk_begin + std::min(grain_size, end - chunk_begin);
+				auto child = std::make_shared<detail::Job>();
+				child->work = [chunk, chunk_begin, chunk_end](){(*chunk)(chunk_begin, chunk_end);};
+				child->parent = parent->shared_from_this();
+				child->pending_dependencies = 0;
+				parent->unfinished++;
+				this->push(std::move(child));
+			}
+		};
+		return this->submit(std::move(job), dependencies);
+	}
+
+	JobHandle JobSystem::submit(std::shared_ptr<detail::Job> job, tz::mem::Span<const JobHandle> dependencies)
+	{
+		for(const JobHandle& dependency : dependencies)
+		{
+			if(!dependency.valid())
+				continue;
+			std::lock_guard<std::mutex> lock{dependency.job->mutex};
+			if(dependency.job->complete)
+				continue;
+			job->pending_dependencies++;
+			dependency.job->dependents.push_back(job);
+		}
+		// Release the hold taken while submitting. If every dependency is already complete, this queues it.
+		this->release(job);
+		return {std::move(job)};
+	}
+
+	void JobSystem::release(std::shared_ptr<detail::Job> job)
+	{
+		if(job->pending_dependencies.fetch_sub(1) == 1)
+			this->push(std::move(job));
+	}
+
+	void JobSystem::push(std::shared_ptr<detail::Job> job)
+	{
+		// Counted before it's visible, so that the count never underflows when it's popped straight away.
+		this->queued_count++;
+		WorkQueue& queue = *this->queues[this->current_queue()];
+		{
+			std::lock_guard<std::mutex> lock{queue.mutex};
+			queue.jobs.push_back(std::move(job));
+		}
+		if(this->sleeping_count.load() > 0)
+		{
+			// Sleeping workers check the count while holding the mutex, so locking it here means the notification cannot be missed.
+			std::lock_guard<std::mutex> lock{this->sleep_mutex};
+			this->job_queued.notify_one();
+		}
+	}
+
+	std::shared_ptr<detail::Job> JobSystem::pop()
+	{
+		const std::size_t own_index = this->current_queue();
+		for(std::size_t i = 0; i < this->queues.size(); i++)
+		{
+			WorkQueue& queue = *this->queues[(own_index + i) % this->queues.size()];
+			std::lock_guard<std::mutex> lock{queue.mutex};
+			if(queue.jobs.empty())
+				continue;
+			std::shared_ptr<detail::Job> job;
+			if(i == 0)
+			{
+				// Own queue: Most recently pushed first, as its data is most likely to still be in cache.
+				job = std::move(queue.jobs.back());
+				queue.jobs.pop_back();
+			}
+			else
+			{
+				// Stealing: Oldest first. This is typically the largest piece of work, which makes stealing it again less likely.
+				job = std::move(queue.jobs.front());
+				queue.jobs.pop_front();
+			}
+			this->queued_count--;
+			return job;
+		}
+		return nullptr;
+	}
+
+	bool JobSystem::try_run()
+	{
+		std::shared_ptr<detail::Job> job = this->pop();
+		if(job == nullptr)
+			return false;
+		this->run(job);
+		return true;
+	}
+
+	void JobSystem::run(const std::shared_ptr<detail::Job>& job)
+	{
+		job->work();
+		// Release anything the work captured now, rather than whenever the last handle is dropped.
+		job->work = nullptr;
+		if(job->unfinished.fetch_sub(1) == 1)
+			this->finish(*job);
+	}
+
+	void JobSystem::finish(detail::Job& job)
+	{
+		std::vector<std::shared_ptr<detail::Job>> dependents;
+		{
+			std::lock_guard<std::mutex> lock{job.mutex};
+			job.complete = true;
+			dependents.swap(job.dependents);
+		}
+		for(std::shared_ptr<detail::Job>& dependent : dependents)
+		{
+			this->release(std::move(dependent));
+		}
+		if(this->blocked_count.load() > 0)
+		{
+			std::lock_guard<std::mutex> lock{this->complete_mutex};
+			this->job_complete.notify_all();
+		}
+		std::shared_ptr<detail::Job> parent = std::move(job.parent);
+		if(parent != nullptr && parent->unfinished.fetch_sub(1) == 1)
+			this->finish(*parent);
+	}
+
+	void JobSystem::work(std::size_t queue_index)
+	{
+		current_system = this;
+		current_queue_index = queue_index;
+		while(true)
+		{
+			if(this->try_run())
+				continue;
+			this->sleeping_count++;
+			std::unique_lock<std::mutex> lock{this->sleep_mutex};
+			this->job_queued.wait(lock, [this](){return this->queued_count.load() > 0 || this->stopping;});
+			this->sleeping_count--;
+			if(this->stopping && this->queued_count.load() == 0)
+				return;
+		}
+	}
+
+	std::size_t JobSystem::current_queue() const
+	{
+		return current_system == this ? current_queue_index : 0;
+	}
+}
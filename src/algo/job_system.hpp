@@ -0,0 +1,181 @@
+#ifndef TOPAZ_ALGO_JOB_SYSTEM_HPP
+#define TOPAZ_ALGO_JOB_SYSTEM_HPP
+#include "memory/span.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tz::algo
+{
+	/**
+	 * \addtogroup tz_algo Topaz Algorithms Library (tz::algo)
+	 * Contains common algorithms used in Topaz modules that aren't available in the C++ standard library.
+	 * @{
+	 */
+
+	namespace detail
+	{
+		struct Job;
+	}
+
+	/**
+	 * Refers to a job submitted to a tz::algo::JobSystem. Handles are cheap to copy, and keep track of the job even after it has completed.
+	 * A default-constructed handle refers to no job, and is considered complete.
+	 */
+	class JobHandle
+	{
+	public:
+		/**
+		 * Construct a handle which refers to no job.
+		 */
+		JobHandle() = default;
+		/**
+		 * Query as to whether this handle refers to a job.
+		 * @return True if the handle was returned by a JobSystem. Otherwise false.
+		 */
+		bool valid() const;
+		/**
+		 * Query as to whether the job has finished running, along with any jobs that it spawned (such as the chunks of a parallel_for).
+		 * @return True if the job is complete or the handle is invalid. Otherwise false.
+		 */
+		bool complete() const;
+	private:
+		friend class JobSystem;
+		JobHandle(std::shared_ptr<detail::Job> job);
+
+		std::shared_ptr<detail::Job> job;
+	};
+
+	/**
+	 * How a thread should behave when waiting for a job.
+	 */
+	enum class WaitPolicy
+	{
+		/// Run other queued jobs until the job completes. This is almost always preferable, as the waiting thread contributes rather than idling.
+		Help,
+		/// Sleep until the job completes. Useful if the waiting thread must not be held up by unrelated long-running jobs.
+		Block
+	};
+
+	/**
+	 * Runs jobs across a fixed pool of worker threads.
+	 *
+	 * Each worker has its own queue, and every other thread (such as the thread which created the system) shares one further queue. Jobs submitted by a worker go on the back of its own queue, and it runs jobs from the back, which keeps related work on the same core while it's still in cache. Idle workers steal from the front of the other queues.
+	 * Jobs may depend on other jobs, in which case they are not queued until all of their dependencies have completed.
+	 * Note: Jobs must not block on anything other than other jobs, using JobSystem::wait. Otherwise, a worker may sit idle while there is queued work.
+	 */
+	class JobSystem
+	{
+	public:
+		/**
+		 * Create a job system with the given number of worker threads.
+		 * @param worker_count Number of worker threads to spawn. The thread waiting on jobs also runs them, so this is typically one less than the number of cores. If this is 0, jobs only run while a thread is waiting on them.
+		 */
+		JobSystem(std::size_t worker_count = JobSystem::default_worker_count());
+		JobSystem(const JobSystem& copy) = delete;
+		JobSystem& operator=(const JobSystem& copy) = delete;
+		/**
+		 * Runs all queued jobs before joining the workers. Jobs whose dependencies have not completed by then are discarded.
+		 */
+		~JobSystem();
+		/**
+		 * Retrieve the number of worker threads that a default-constructed system spawns. This is one less than the number of hardware threads, so that the main thread can help without oversubscribing the cores.
+		 * @return Default worker count.
+		 */
+		static std::size_t default_worker_count();
+		/**
+		 * Retrieve the number of worker threads.
+		 * @return Number of workers, not including any thread which waits on jobs.
+		 */
+		std::size_t worker_count() const;
+		/**
+		 * Queue a job.
+		 * @param work Function to run.
+		 * @return Handle to the job.
+		 */
+		JobHandle execute(std::function<void()> work);
+		/**
+		 * Queue a job once every one of the given jobs has completed.
+		 * @param work Function to run.
+		 * @param dependencies Jobs which must complete before this job can start. Invalid handles are ignored.
+		 * @return Handle to the job.
+		 */
+		JobHandle execute(std::function<void()> work, tz::mem::Span<const JobHandle> dependencies);
+		/**
+		 * Invoke function(i) for every index in [begin, end), split into chunks which may run in parallel. The job completes once every chunk has completed.
+		 * @param begin First index.
+		 * @param end One past the last index.
+		 * @param grain_size Maximum number of indices per chunk. Chunks should be large enough that queueing one is negligible in comparison to running it (typically hundreds of microseconds of work), but there should be several chunks per worker so that stealing can balance the load.
+		 * @param function Invoked as function(std::size_t i). Invocations in different chunks may run concurrently.
+		 * @return Handle to the whole loop.
+		 */
+		template<typename Function>
+		JobHandle parallel_for(std::size_t begin, std::size_t end, std::size_t grain_size, Function function);
+		/**
+		 * Invoke function(i) for every index in [begin, end) once every one of the given jobs has completed. See parallel_for(std::size_t, std::size_t, std::size_t, Function).
+		 * @param dependencies Jobs which must complete before any chunk can start. Invalid handles are ignored.
+		 * @return Handle to the whole loop.
+		 */
+		template<typename Function>
+		JobHandle parallel_for(std::size_t begin, std::size_t end, std::size_t grain_size, Function function, tz::mem::Span<const JobHandle> dependencies);
+		/**
+		 * Wait until the given job has completed.
+		 * Note: If there are no workers, the waiting thread always helps. Otherwise, nothing would ever run the job.
+		 * @param job Job to wait on. If this is invalid, this returns immediately.
+		 * @param policy Whether the waiting thread should run other jobs meanwhile.
+		 */
+		void wait(const JobHandle& job, WaitPolicy policy = WaitPolicy::Help);
+	private:
+		using ChunkFunction = std::function<void(std::size_t, std::size_t)>;
+
+		/// Queue belonging to one thread. Owners push and pop from the back, thieves steal from the front.
+		struct WorkQueue
+		{
+			std::mutex mutex;
+			std::deque<std::shared_ptr<detail::Job>> jobs;
+		};
+
+		JobHandle split(std::size_t begin, std::size_t end, std::size_t grain_size, std::shared_ptr<const ChunkFunction> chunk, tz::mem::Span<const JobHandle> dependencies);
+		JobHandle submit(std::shared_ptr<detail::Job> job, tz::mem::Span<const JobHandle> dependencies);
+		/// Mark one of the job's dependencies as met. Once they all are, the job is queued.
+		void release(std::shared_ptr<detail::Job> job);
+		void push(std::shared_ptr<detail::Job> job);
+		std::shared_ptr<detail::Job> pop();
+		/// Run one queued job, if there are any.
+		bool try_run();
+		void run(const std::shared_ptr<detail::Job>& job);
+		/// Invoked once the job and all of its children have finished running.
+		void finish(detail::Job& job);
+		void work(std::size_t queue_index);
+		/// Retrieve the index of the calling thread's queue. Threads which aren't workers share the first queue.
+		std::size_t current_queue() const;
+
+		/// The first queue is for threads which aren't workers. The rest belong to each worker.
+		std::vector<std::unique_ptr<WorkQueue>> queues;
+		std::vector<std::thread> workers;
+		/// Number of jobs across all queues.
+		std::atomic<std::size_t> queued_count;
+		/// Number of workers waiting for a job to be queued. Queueing a job only needs to wake anyone if this is non-zero.
+		std::atomic<std::size_t> sleeping_count;
+		std::mutex sleep_mutex;
+		std::condition_variable job_queued;
+		bool stopping;
+		/// Number of threads blocked in wait(...). Completing a job only needs to wake anyone if this is non-zero.
+		std::atomic<std::size_t> blocked_count;
+		std::mutex complete_mutex;
+		std::condition_variable job_complete;
+	};
+
+	/**
+	 * @}
+	 */
+}
+
+#include "algo/job_system.inl"
+#endif // TOPAZ_ALGO_JOB_SYSTEM_HPP
@@ -0,0 +1,28 @@
+#include "core/debug/assert.hpp"
+#include <utility>
+
+namespace tz::algo
+{
+	template<typename Function>
+	JobHandle JobSystem::parallel_for(std::size_t begin, std::size_t end, std::size_t grain_size, Function function)
+	{
+		return this->parallel_for(begin, end, grain_size, std::move(function), {nullptr, 0});
+	}
+
+	template<typename Function>
+	JobHandle JobSystem::parallel_for(std::size_t begin, std::size_t end, std::size_t grain_size, Function function, tz::mem::Span<const JobHandle> dependencies)
+	{
+		topaz_assert(grain_size > 0, "tz::algo::JobSystem::parallel_for(...): Grain size must be non-zero.");
+		if(grain_size == 0)
+			grain_size = 1;
+		// Every chunk shares the one function. The loop over the chunk is in here so that function can be inlined into it.
+		auto chunk = std::make_shared<const ChunkFunction>([function = std::move(function)](std::size_t chunk_begin, std::size_t chunk_end)
+		{
+			for(std::size_t i = chunk_begin; i < chunk_end; i++)
+			{
+				function(i);
+			}
+		});
+		return this->split(begin, end, grain_size, std::move(chunk), dependencies);
+	}
+}
@@ -7,6 +7,7 @@
 #include "core/debug/print.hpp"
 #include "core/tz_glad/glad_context.hpp"
 #include "gl/tz_imgui/imgui_context.hpp"
+#include "memory/tracking.hpp"
 #include "GLFW/glfw3.h"
 
 namespace tz::core
@@ -111,6 +112,8 @@ namespace tz::core
 
 	static TopazCore global_core;
 	static ResourceManager root_manager{tz::core::project_directory};
+	constexpr std::size_t frame_arena_size = 1024 * 1024;
+	static tz::mem::LinearArena global_frame_arena{frame_arena_size};
 
 	void initialise(const char* app_name)
 	{
@@ -119,8 +122,13 @@ namespace tz::core
 
 	void update()
 	{
-		glfwPollEvents();
-		tz::ext::imgui::update();
+		{
+			tz::mem::tracking::ScopedTag tag{tz::mem::tracking::Tag::Core};
+			glfwPollEvents();
+			tz::ext::imgui::update();
+		}
+		global_frame_arena.reset();
+		tz::mem::tracking::next_frame();
 	}
 	
 	void terminate()
@@ -138,5 +146,10 @@ namespace tz::core
 	{
 		return root_manager;
 	}
+
+	tz::mem::LinearArena& frame_arena()
+	{
+		return global_frame_arena;
+	}
 }
 
@@ -6,6 +6,7 @@
 #define TOPAZ_CORE_HPP
 #include "core/window.hpp"
 #include "core/resource_manager.hpp"
+#include "memory/arena.hpp"
 #include <memory>
 
 /*! \mainpage Topaz 2
@@ -132,6 +133,13 @@ namespace tz::core
 	TopazCore& get();
 	
 	const ResourceManager& res();
+	/**
+	 * Retrieve the per-frame scratch arena.
+	 * Allocations made from this arena are valid until the next invocation of tz::core::update(), which resets it.
+	 * Note: This is available even if topaz is not initialised.
+	 * @return Reference to the frame arena.
+	 */
+	tz::mem::LinearArena& frame_arena();
 
 	/**
 	 * @}
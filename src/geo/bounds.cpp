@@ -0,0 +1,145 @@
+#include "geo/bounds.hpp"
+#include "geo/simd.hpp"
+#include "core/debug/assert.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace tz::geo
+{
+	namespace
+	{
+		static_assert(sizeof(tz::Vec3) == 3 * sizeof(float));
+
+		const float* point_at(const tz::Vec3* first, std::size_t stride_bytes, std::size_t i)
+		{
+			return reinterpret_cast<const float*>(reinterpret_cast<const char*>(first) + (i * stride_bytes));
+		}
+
+		AABB bound_box(const tz::Vec3* first, std::size_t count, std::size_t stride_bytes)
+		{
+			std::size_t i = 0;
+			float min[3], max[3];
+			const float* p0 = point_at(first, stride_bytes, 0);
+			std::copy(p0, p0 + 3, min);
+			std::copy(p0, p0 + 3, max);
+		#if TOPAZ_GEO_SIMD
+			using namespace tz::geo::simd::detail;
+			// Two accumulator pairs, so consecutive min/max don't have to wait on each other.
+			__m128 min0 = load3(p0), max0 = min0;
+			__m128 min1 = min0, max1 = max0;
+			for(; i + 4 <= count; i += 4)
+			{
+				const __m128 a = load3(point_at(first, stride_bytes, i));
+				const __m128 b = load3(point_at(first, stride_bytes, i + 1));
+				const __m128 c = load3(point_at(first, stride_bytes, i + 2));
+				const __m128 d = load3(point_at(first, stride_bytes, i + 3));
+				min0 = _mm_min_ps(min0, _mm_min_ps(a, b));
+				max0 = _mm_max_ps(max0, _mm_max_ps(a, b));
+				min1 = _mm_min_ps(min1, _mm_min_ps(c, d));
+				max1 = _mm_max_ps(max1, _mm_max_ps(c, d));
+			}
+			store3(min, _mm_min_ps(min0, min1));
+			store3(max, _mm_max_ps(max0, max1));
+		#endif
+			for(; i < count; i++)
+			{
+				const float* p = point_at(first, stride_bytes, i);
+				for(std::size_t j = 0; j < 3; j++)
+				{
+					min[j] = std::min(min[j], p[j]);
+					max[j] = std::max(max[j], p[j]);
+				}
+			}
+			return {{{min[0], min[1], min[2]}}, {{max[0], max[1], max[2]}}};
+		}
+
+		float max_distance_squared(const tz::Vec3* first, std::size_t count, std::size_t stride_bytes, const tz::Vec3& centre)
+		{
+			std::size_t i = 0;
+			float result = 0.0f;
+		#if TOPAZ_GEO_SIMD
+			using namespace tz::geo::simd::detail;
+			const __m128 cx = _mm_set1_ps(centre[0]);
+			const __m128 cy = _mm_set1_ps(centre[1]);
+			const __m128 cz = _mm_set1_ps(centre[2]);
+			__m128 furthest = _mm_setzero_ps();
+			for(; i + 4 <= count; i += 4)
+			{
+				__m128 x = load3(point_at(first, stride_bytes, i));
+				__m128 y = load3(point_at(first, stride_bytes, i + 1));
+				__m128 z = load3(point_at(first, stride_bytes, i + 2));
+				__m128 w = load3(point_at(first, stride_bytes, i + 3));
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+				x = _mm_sub_ps(x, cx);
+				y = _mm_sub_ps(y, cy);
+				z = _mm_sub_ps(z, cz);
+				furthest = _mm_max_ps(furthest, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+			}
+			furthest = _mm_max_ps(furthest, swizzle<2, 3, 0, 1>(furthest));
+			furthest = _mm_max_ps(furthest, swizzle<1, 0, 3, 2>(furthest));
+			result = _mm_cvtss_f32(furthest);
+		#endif
+			for(; i < count; i++)
+			{
+				const float* p = point_at(first, stride_bytes, i);
+				float distance_squared = 0.0f;
+				for(std::size_t j = 0; j < 3; j++)
+				{
+					const float d = p[j] - centre[j];
+					distance_squared += d * d;
+				}
+				result = std::max(result, distance_squared);
+			}
+			return result;
+		}
+	}
+
+	tz::Vec3 AABB::centre() const
+	{
+		return {{(this->min[0] + this->max[0]) * 0.5f, (this->min[1] + this->max[1]) * 0.5f, (this->min[2] + this->max[2]) * 0.5f}};
+	}
+
+	tz::Vec3 AABB::extents() const
+	{
+		return {{(this->max[0] - this->min[0]) * 0.5f, (this->max[1] - this->min[1]) * 0.5f, (this->max[2] - this->min[2]) * 0.5f}};
+	}
+
+	bool AABB::contains(const tz::Vec3& point) const
+	{
+		for(std::size_t i = 0; i < 3; i++)
+		{
+			if(point[i] < this->min[i] || point[i] > this->max[i])
+				return false;
+		}
+		return true;
+	}
+
+	bool BoundingSphere::contains(const tz::Vec3& point) const
+	{
+		float distance_squared = 0.0f;
+		for(std::size_t i = 0; i < 3; i++)
+		{
+			const float d = point[i] - this->centre[i];
+			distance_squared += d * d;
+		}
+		return distance_squared <= this->radius * this->radius;
+	}
+
+	Bounds bound(tz::mem::Span<const tz::Vec3> points)
+	{
+		return bound(points.data(), points.size(), sizeof(tz::Vec3));
+	}
+
+	Bounds bound(const tz::Vec3* first, std::size_t count, std::size_t stride_bytes)
+	{
+		topaz_assert(stride_bytes >= sizeof(tz::Vec3), "tz::geo::bound(...): Stride ", stride_bytes, " is smaller than a tz::Vec3, so points would overlap.");
+		if(count == 0)
+		{
+			const tz::Vec3 origin{{0.0f, 0.0f, 0.0f}};
+			return {{origin, origin}, {origin, 0.0f}};
+		}
+		const AABB box = bound_box(first, count, stride_bytes);
+		const tz::Vec3 centre = box.centre();
+		return {box, {centre, std::sqrt(max_distance_squared(first, count, stride_bytes, centre))}};
+	}
+}
@@ -0,0 +1,73 @@
+#ifndef TOPAZ_GEO_BOUNDS_HPP
+#define TOPAZ_GEO_BOUNDS_HPP
+#include "geo/vector.hpp"
+#include "memory/span.hpp"
+
+namespace tz::geo
+{
+	/**
+	 * \addtogroup tz_geo Topaz Geometry Library (tz::geo)
+	 * A collection of geometric data structures and mathematical types, such as vectors and matrices.
+	 * @{
+	 */
+
+	/**
+	 * Axis-aligned bounding box.
+	 */
+	struct AABB
+	{
+		/// Retrieve the point in the middle of the box.
+		tz::Vec3 centre() const;
+		/// Retrieve half of the size of the box along each axis.
+		tz::Vec3 extents() const;
+		/// Query as to whether the point lies within the box or on its surface.
+		bool contains(const tz::Vec3& point) const;
+
+		tz::Vec3 min;
+		tz::Vec3 max;
+	};
+
+	/**
+	 * Bounding sphere.
+	 */
+	struct BoundingSphere
+	{
+		/// Query as to whether the point lies within the sphere or on its surface.
+		bool contains(const tz::Vec3& point) const;
+
+		tz::Vec3 centre;
+		float radius;
+	};
+
+	/**
+	 * Both bounding volumes of a set of points. Cheap tests can use the sphere, and fall back to the tighter box only when the sphere is inconclusive.
+	 * The sphere is centred on the centre of the box. It is not the minimal bounding sphere, but is never larger than the box's circumscribed sphere.
+	 */
+	struct Bounds
+	{
+		AABB box;
+		BoundingSphere sphere;
+	};
+
+	/**
+	 * Compute the bounding volumes of a set of points.
+	 * Points are reduced four at a time using SIMD where available (see tz::geo::simd::enabled).
+	 * @param points Points to bound. If this is empty, the box and sphere are both degenerate at the origin.
+	 * @return Bounding volumes of all of the points.
+	 */
+	Bounds bound(tz::mem::Span<const tz::Vec3> points);
+	/**
+	 * Compute the bounding volumes of a set of points which are interleaved with other data, such as the positions of an array of tz::gl::Vertex.
+	 * @param first Pointer to the first point.
+	 * @param count Number of points.
+	 * @param stride_bytes Distance between each point in bytes. Must be at least sizeof(tz::Vec3).
+	 * @return Bounding volumes of all of the points.
+	 */
+	Bounds bound(const tz::Vec3* first, std::size_t count, std::size_t stride_bytes);
+
+	/**
+	 * @}
+	 */
+}
+
+#endif // TOPAZ_GEO_BOUNDS_HPP
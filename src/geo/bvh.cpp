@@ -0,0 +1,439 @@
+#include "geo/bvh.hpp"
+#include "core/debug/assert.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace tz::geo
+{
+	namespace
+	{
+		constexpr float infinity = std::numeric_limits<float>::infinity();
+		/// Number of buckets which centroids are sorted into when evaluating the SAH along an axis.
+		constexpr std::size_t bin_count = 16;
+		/// Beyond this depth, nodes are split at the median rather than by the SAH. SAH splits can be arbitrarily lopsided, so this bounds the depth of the hierarchy (and therefore the traversal stack).
+		constexpr std::size_t max_sah_depth = 48;
+
+		/// Box as plain arrays, which is far cheaper to grow than tz::geo::AABB during a build.
+		struct Box
+		{
+			float min[3] = {infinity, infinity, infinity};
+			float max[3] = {-infinity, -infinity, -infinity};
+
+			void grow(const float* point)
+			{
+				for(std::size_t i = 0; i < 3; i++)
+				{
+					this->min[i] = std::min(this->min[i], point[i]);
+					this->max[i] = std::max(this->max[i], point[i]);
+				}
+			}
+
+			void grow(const Box& box)
+			{
+				for(std::size_t i = 0; i < 3; i++)
+				{
+					this->min[i] = std::min(this->min[i], box.min[i]);
+					this->max[i] = std::max(this->max[i], box.max[i]);
+				}
+			}
+
+			float surface_area() const
+			{
+				const float x = this->max[0] - this->min[0];
+				const float y = this->max[1] - this->min[1];
+				const float z = this->max[2] - this->min[2];
+				// An empty box (never grown) is inverted, and has no area.
+				if(x < 0.0f)
+					return 0.0f;
+				return 2.0f * ((x * y) + (y * z) + (z * x));
+			}
+		};
+
+		/// Node of the binary hierarchy built by the SAH, before it is collapsed into four-wide nodes.
+		struct BuildNode
+		{
+			Box box;
+			std::uint32_t left;
+			std::uint32_t right;
+			std::uint32_t first;
+			/// 0 if this is an internal node.
+			std::uint32_t count;
+		};
+
+		/// Primitive being sorted into the hierarchy. Builds partition these in-place, so that each node's primitives are contiguous and are read sequentially.
+		struct BuildPrimitive
+		{
+			Box box;
+			float centroid[3];
+			std::uint32_t index;
+		};
+
+		class Builder
+		{
+		public:
+			Builder(tz::mem::Span<const AABB> primitives): primitives(), nodes()
+			{
+				this->primitives.reserve(primitives.size());
+				for(std::size_t i = 0; i < primitives.size(); i++)
+				{
+					BuildPrimitive primitive;
+					primitive.box.grow(primitives[i].min.data());
+					primitive.box.grow(primitives[i].max.data());
+					for(std::size_t axis = 0; axis < 3; axis++)
+					{
+						primitive.centroid[axis] = (primitive.box.min[axis] + primitive.box.max[axis]) * 0.5f;
+					}
+					primitive.index = static_cast<std::uint32_t>(i);
+					this->primitives.push_back(primitive);
+				}
+				this->nodes.reserve(2 * primitives.size());
+			}
+
+			std::uint32_t build(std::uint32_t first, std::uint32_t count, std::size_t depth)
+			{
+				const std::uint32_t node_index = static_cast<std::uint32_t>(this->nodes.size());
+				this->nodes.push_back({});
+				Box box, centroid_box;
+				for(std::uint32_t i = first; i < first + count; i++)
+				{
+					box.grow(this->primitives[i].box);
+					centroid_box.grow(this->primitives[i].centroid);
+				}
+				this->nodes[node_index].box = box;
+				std::uint32_t split = this->split(first, count, depth, box, centroid_box);
+				if(split == 0)
+				{
+					this->nodes[node_index].first = first;
+					this->nodes[node_index].count = count;
+					return node_index;
+				}
+				const std::uint32_t left = this->build(first, split, depth + 1);
+				const std::uint32_t right = this->build(first + split, count - split, depth + 1);
+				this->nodes[node_index].left = left;
+				this->nodes[node_index].right = right;
+				this->nodes[node_index].count = 0;
+				return node_index;
+			}
+
+			const std::vector<BuildNode>& get_nodes() const
+			{
+				return this->nodes;
+			}
+
+			/// Retrieve the index of each primitive, in the order that the leaves refer to them.
+			std::vector<std::uint32_t> get_indices() const
+			{
+				std::vector<std::uint32_t> indices;
+				indices.reserve(this->primitives.size());
+				for(const BuildPrimitive& primitive : this->primitives)
+				{
+					indices.push_back(primitive.index);
+				}
+				return indices;
+			}
+		private:
+			/**
+			 * Partition the range into two halves.
+			 * @return Number of primitives in the left half, or 0 if the range should be a leaf.
+			 */
+			std::uint32_t split(std::uint32_t first, std::uint32_t count, std::size_t depth, const Box& box, const Box& centroid_box)
+			{
+				if(count <= 1)
+					return 0;
+				BuildPrimitive* begin = this->primitives.data() + first;
+				BuildPrimitive* end = begin + count;
+				if(depth < max_sah_depth)
+				{
+					// Bin along all three axes in a single pass. Small nodes don't need as many bins, and most nodes are small.
+					const std::size_t used_bins = std::min(static_cast<std::size_t>(count), bin_count);
+					Box bins[3][bin_count];
+					std::uint32_t bin_sizes[3][bin_count] = {};
+					float scales[3];
+					for(std::size_t axis = 0; axis < 3; axis++)
+					{
+						const float extent = centroid_box.max[axis] - centroid_box.min[axis];
+						scales[axis] = extent > 0.0f ? used_bins / extent : 0.0f;
+					}
+					for(const BuildPrimitive* primitive = begin; primitive != end; primitive++)
+					{
+						for(std::size_t axis = 0; axis < 3; axis++)
+						{
+							const std::size_t bin = bin_of(*primitive, axis, centroid_box.min[axis], scales[axis], used_bins);
+							bins[axis][bin].grow(primitive->box);
+							bin_sizes[axis][bin]++;
+						}
+					}
+					// Costs are relative to testing one primitive. Traversing a node costs about as much.
+					float best_cost = static_cast<float>(count);
+					std::size_t best_axis = 0, best_bin = 0;
+					bool found = false;
+					const float area = box.surface_area();
+					for(std::size_t axis = 0; axis < 3; axis++)
+					{
+						if(scales[axis] == 0.0f)
+							continue;
+						// Sweep from the right to find the area and size of everything right of each split, then from the left to evaluate each split.
+						float right_areas[bin_count];
+						std::uint32_t right_sizes[bin_count];
+						Box right;
+						std::uint32_t right_size = 0;
+						for(std::size_t bin = used_bins - 1; bin > 0; bin--)
+						{
+							right.grow(bins[axis][bin]);
+							right_size += bin_sizes[axis][bin];
+							right_areas[bin] = right.surface_area();
+							right_sizes[bin] = right_size;
+						}
+						Box left;
+						std::uint32_t left_size = 0;
+						for(std::size_t bin = 0; bin < used_bins - 1; bin++)
+						{
+							left.grow(bins[axis][bin]);
+							left_size += bin_sizes[axis][bin];
+							if(left_size == 0 || right_sizes[bin + 1] == 0)
+								continue;
+							const float cost = 1.0f + ((left.surface_area() * left_size) + (right_areas[bin + 1] * right_sizes[bin + 1])) / area;
+							if(cost < best_cost)
+							{
+								best_cost = cost;
+								best_axis = axis;
+								best_bin = bin;
+								found = true;
+							}
+						}
+					}
+					if(found)
+					{
+						const float min = centroid_box.min[best_axis];
+						const float scale = scales[best_axis];
+						BuildPrimitive* middle = std::partition(begin, end, [best_axis, best_bin, min, scale, used_bins](const BuildPrimitive& primitive){return bin_of(primitive, best_axis, min, scale, used_bins) <= best_bin;});
+						return static_cast<std::uint32_t>(middle - begin);
+					}
+				}
+				// Splitting is no cheaper than a leaf.
+				if(count <= BVH::max_leaf_size)
+					return 0;
+				// Too large to be a leaf but the SAH can't (or mustn't) split it, so split at the median along the widest axis.
+				std::size_t axis = 0;
+				for(std::size_t i = 1; i < 3; i++)
+				{
+					if(centroid_box.max[i] - centroid_box.min[i] > centroid_box.max[axis] - centroid_box.min[axis])
+						axis = i;
+				}
+				std::nth_element(begin, begin + (count / 2), end, [axis](const BuildPrimitive& a, const BuildPrimitive& b){return a.centroid[axis] < b.centroid[axis];});
+				return count / 2;
+			}
+
+			static std::size_t bin_of(const BuildPrimitive& primitive, std::size_t axis, float min, float scale, std::size_t used_bins)
+			{
+				return std::min(static_cast<std::size_t>((primitive.centroid[axis] - min) * scale), used_bins - 1);
+			}
+
+			std::vector<BuildPrimitive> primitives;
+			std::vector<BuildNode> nodes;
+		};
+	}
+
+	tz::Vec3 Ray::at(float distance) const
+	{
+		return {{this->origin[0] + this->direction[0] * distance, this->origin[1] + this->direction[1] * distance, this->origin[2] + this->direction[2] * distance}};
+	}
+
+	std::optional<float> intersect(const Ray& ray, const AABB& box, float max_distance)
+	{
+		float near = 0.0f;
+		float far = max_distance;
+		for(std::size_t axis = 0; axis < 3; axis++)
+		{
+			const float inverse_direction = 1.0f / ray.direction[axis];
+			float slab_near = (box.min[axis] - ray.origin[axis]) * inverse_direction;
+			float slab_far = (box.max[axis] - ray.origin[axis]) * inverse_direction;
+			if(std::signbit(inverse_direction))
+				std::swap(slab_near, slab_far);
+			// Comparisons with NaN are false, so slabs which the origin lies exactly upon (parallel to the ray) are skipped.
+			if(slab_near > near)
+				near = slab_near;
+			if(slab_far < far)
+				far = slab_far;
+		}
+		if(near > far)
+			return std::nullopt;
+		return near;
+	}
+
+	std::optional<float> intersect(const Ray& ray, const tz::Vec3& a, const tz::Vec3& b, const tz::Vec3& c, float max_distance)
+	{
+		// Moller-Trumbore.
+		constexpr float epsilon = 1e-8f;
+		tz::Vec3 ab = b;
+		ab -= a;
+		tz::Vec3 ac = c;
+		ac -= a;
+		const tz::Vec3 p = tz::cross(ray.direction, ac);
+		const float determinant = ab.dot(p);
+		// Ray is parallel to the triangle.
+		if(std::abs(determinant) < epsilon)
+			return std::nullopt;
+		const float inverse_determinant = 1.0f / determinant;
+		tz::Vec3 to_origin = ray.origin;
+		to_origin -= a;
+		const float u = to_origin.dot(p) * inverse_determinant;
+		if(u < 0.0f || u > 1.0f)
+			return std::nullopt;
+		const tz::Vec3 q = tz::cross(to_origin, ab);
+		const float v = ray.direction.dot(q) * inverse_determinant;
+		if(v < 0.0f || u + v > 1.0f)
+			return std::nullopt;
+		const float distance = ac.dot(q) * inverse_determinant;
+		if(distance < 0.0f || distance > max_distance)
+			return std::nullopt;
+		return distance;
+	}
+
+	bool overlaps(const AABB& a, const AABB& b)
+	{
+		for(std::size_t i = 0; i < 3; i++)
+		{
+			if(a.max[i] < b.min[i] || b.max[i] < a.min[i])
+				return false;
+		}
+		return true;
+	}
+
+	BVH::BVH(): nodes(), primitive_indices(), primitive_bounds(){}
+
+	BVH::BVH(tz::mem::Span<const AABB> primitives): nodes(), primitive_indices(), primitive_bounds(primitives.begin(), primitives.end())
+	{
+		topaz_assert(primitives.size() < std::numeric_limits<std::uint32_t>::max(), "tz::geo::BVH::BVH(...): Too many primitives (", primitives.size(), "). Primitives are indexed with 32 bits.");
+		if(primitives.empty())
+			return;
+		Builder builder{primitives};
+		builder.build(0, static_cast<std::uint32_t>(primitives.size()), 0);
+		this->primitive_indices = builder.get_indices();
+		const std::vector<BuildNode>& build_nodes = builder.get_nodes();
+
+		// Collapse the binary hierarchy: Each node adopts the children of its largest internal children, until it has four.
+		auto collapse = [this, &build_nodes](auto& self, std::uint32_t build_index)->std::uint32_t
+		{
+			const std::uint32_t node_index = static_cast<std::uint32_t>(this->nodes.size());
+			this->nodes.emplace_back();
+			std::uint32_t children[width];
+			std::size_t child_count = 0;
+			const BuildNode& build_node = build_nodes[build_index];
+			if(build_node.count > 0)
+			{
+				// Only the root can be a leaf here. It becomes the sole child of a node.
+				children[child_count++] = build_index;
+			}
+			else
+			{
+				children[child_count++] = build_node.left;
+				children[child_count++] = build_node.right;
+				while(child_count < width)
+				{
+					std::size_t largest = width;
+					float largest_area = -1.0f;
+					for(std::size_t i = 0; i < child_count; i++)
+					{
+						const BuildNode& child = build_nodes[children[i]];
+						if(child.count == 0 && child.box.surface_area() > largest_area)
+						{
+							largest = i;
+							largest_area = child.box.surface_area();
+						}
+					}
+					if(largest == width)
+						break;
+					const BuildNode& adopted = build_nodes[children[largest]];
+					children[largest] = adopted.left;
+					children[child_count++] = adopted.right;
+				}
+			}
+			for(std::size_t i = 0; i < width; i++)
+			{
+				// Recursion may reallocate the node array, so the node must be looked-up again each time.
+				std::uint32_t child = 0;
+				std::uint32_t count = 0;
+				Box box;
+				if(i < child_count)
+				{
+					const BuildNode& child_node = build_nodes[children[i]];
+					box = child_node.box;
+					count = child_node.count;
+					child = count > 0 ? child_node.first : self(self, children[i]);
+				}
+				Node& node = this->nodes[node_index];
+				for(std::size_t axis = 0; axis < 3; axis++)
+				{
+					node.bounds[axis][i] = box.min[axis];
+					node.bounds[axis + 3][i] = box.max[axis];
+				}
+				node.child[i] = child;
+				node.count[i] = count;
+			}
+			return node_index;
+		};
+		this->nodes.reserve(build_nodes.size() / 2 + 1);
+		collapse(collapse, 0);
+	}
+
+	std::size_t BVH::size() const
+	{
+		return this->primitive_bounds.size();
+	}
+
+	bool BVH::empty() const
+	{
+		return this->primitive_bounds.empty();
+	}
+
+	std::size_t BVH::node_count() const
+	{
+		return this->nodes.size();
+	}
+
+	bool BVH::raycast(const Ray& ray, float max_distance) const
+	{
+		return this->raycast(ray, max_distance, [this, &ray](std::size_t primitive, float max)
+		{
+			return intersect(ray, this->primitive_bounds[primitive], max);
+		});
+	}
+
+	std::optional<RayHit> BVH::closest_hit(const Ray& ray, float max_distance) const
+	{
+		return this->closest_hit(ray, max_distance, [this, &ray](std::size_t primitive, float max)
+		{
+			return intersect(ray, this->primitive_bounds[primitive], max);
+		});
+	}
+
+	std::vector<std::size_t> BVH::overlap(const AABB& box) const
+	{
+		std::vector<std::size_t> primitives;
+		this->overlap(box, [&primitives](std::size_t primitive){primitives.push_back(primitive);});
+		return primitives;
+	}
+
+	BVH::Traversal::Traversal(const Ray& ray)
+	{
+		for(std::size_t axis = 0; axis < 3; axis++)
+		{
+			this->origin[axis] = ray.origin[axis];
+			this->inverse_direction[axis] = 1.0f / ray.direction[axis];
+			// Use the sign of the inverse, so that a direction of -0 (whose inverse is -inf) enters through the max.
+			this->near_row[axis] = std::signbit(this->inverse_direction[axis]) ? axis + 3 : axis;
+		}
+	}
+
+	/*static*/ bool BVH::overlap_child(const Node& node, std::size_t child, const AABB& box)
+	{
+		for(std::size_t axis = 0; axis < 3; axis++)
+		{
+			if(node.bounds[axis + 3][child] < box.min[axis] || box.max[axis] < node.bounds[axis][child])
+				return false;
+		}
+		return true;
+	}
+}
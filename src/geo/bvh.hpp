@@ -0,0 +1,193 @@
+#ifndef TOPAZ_GEO_BVH_HPP
+#define TOPAZ_GEO_BVH_HPP
+#include "geo/bounds.hpp"
+#include "memory/span.hpp"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace tz::geo
+{
+	/**
+	 * \addtogroup tz_geo Topaz Geometry Library (tz::geo)
+	 * A collection of geometric data structures and mathematical types, such as vectors and matrices.
+	 * @{
+	 */
+
+	/**
+	 * Half-line starting at an origin. Distances along the ray are measured in multiples of the direction's length, so they are only world-space distances if the direction is normalised.
+	 */
+	struct Ray
+	{
+		/// Retrieve the point at the given distance along the ray.
+		tz::Vec3 at(float distance) const;
+
+		tz::Vec3 origin;
+		tz::Vec3 direction;
+	};
+
+	/**
+	 * Result of a successful closest-hit query.
+	 */
+	struct RayHit
+	{
+		/// Index of the primitive which was hit, i.e its position within the span which the tz::geo::BVH was built from.
+		std::size_t primitive;
+		/// Distance along the ray at which it was hit.
+		float distance;
+	};
+
+	/**
+	 * Intersect a ray with a box.
+	 * @param ray Ray to test.
+	 * @param box Box to test.
+	 * @param max_distance Hits further along the ray than this are ignored.
+	 * @return Distance along the ray at which it enters the box, or 0 if the origin is inside the box. If the ray misses, nullopt.
+	 */
+	std::optional<float> intersect(const Ray& ray, const AABB& box, float max_distance);
+	/**
+	 * Intersect a ray with a triangle. Both faces of the triangle can be hit.
+	 * @param ray Ray to test.
+	 * @param a First vertex of the triangle.
+	 * @param b Second vertex of the triangle.
+	 * @param c Third vertex of the triangle.
+	 * @param max_distance Hits further along the ray than this are ignored.
+	 * @return Distance along the ray at which it hits the triangle. If the ray misses, nullopt.
+	 */
+	std::optional<float> intersect(const Ray& ray, const tz::Vec3& a, const tz::Vec3& b, const tz::Vec3& c, float max_distance);
+	/**
+	 * Query as to whether two boxes overlap. Boxes which only touch are considered to overlap.
+	 */
+	bool overlaps(const AABB& a, const AABB& b);
+
+	/**
+	 * Bounding volume hierarchy over a static set of primitives, such as the triangles of a mesh or the bounds of every mesh in a scene. Answers ray and box queries without testing every primitive.
+	 * The BVH only knows the box of each primitive. Queries which need an exact test (such as ray-triangle intersection) take a callback to perform it, and only invoke it for primitives whose boxes pass.
+	 *
+	 * The hierarchy is built using the surface area heuristic (SAH), and is then collapsed into a flat array of four-wide nodes. Rays are tested against all four children of a node at once using SIMD where available (see tz::geo::simd::enabled).
+	 * Note: The BVH is immutable. If any of the primitives move, it must be rebuilt.
+	 */
+	class BVH
+	{
+	public:
+		/// Leaves never contain more primitives than this.
+		static constexpr std::size_t max_leaf_size = 8;
+
+		/**
+		 * Construct an empty BVH. All queries will miss.
+		 */
+		BVH();
+		/**
+		 * Build a BVH over the given primitives.
+		 * @param primitives Box of each primitive. Each primitive is identified by its index within this span.
+		 */
+		BVH(tz::mem::Span<const AABB> primitives);
+		/**
+		 * Retrieve the number of primitives.
+		 */
+		std::size_t size() const;
+		/**
+		 * Query as to whether there are no primitives.
+		 */
+		bool empty() const;
+		/**
+		 * Retrieve the number of nodes in the flattened hierarchy.
+		 */
+		std::size_t node_count() const;
+		/**
+		 * Query as to whether the ray hits any primitive. This stops at the first hit, which makes it cheaper than closest_hit. This is suitable for line-of-sight checks.
+		 * @param ray Ray to cast.
+		 * @param max_distance Hits further along the ray than this are ignored.
+		 * @param intersect Exact test invoked as std::optional<float> intersect(std::size_t primitive, float max_distance) for each primitive whose box the ray hits. Returns the distance along the ray at which it hits the primitive, or nullopt if it misses.
+		 * @return True if intersect returned a distance for any primitive. Otherwise false.
+		 */
+		template<typename Intersect>
+		bool raycast(const Ray& ray, float max_distance, Intersect intersect) const;
+		/**
+		 * Query as to whether the ray hits the box of any primitive.
+		 * @param ray Ray to cast.
+		 * @param max_distance Hits further along the ray than this are ignored.
+		 * @return True if the ray hits the box of any primitive. Otherwise false.
+		 */
+		bool raycast(const Ray& ray, float max_distance) const;
+		/**
+		 * Find the first primitive along the ray. Children are visited nearest-first, and any part of the hierarchy further than the closest hit so far is skipped.
+		 * @param ray Ray to cast.
+		 * @param max_distance Hits further along the ray than this are ignored.
+		 * @param intersect Exact test invoked as std::optional<float> intersect(std::size_t primitive, float max_distance) for each primitive whose box the ray hits. max_distance is the distance of the closest hit so far. Returns the distance along the ray at which it hits the primitive, or nullopt if it misses.
+		 * @return Primitive with the smallest distance returned by intersect. If intersect never returned a distance, nullopt.
+		 */
+		template<typename Intersect>
+		std::optional<RayHit> closest_hit(const Ray& ray, float max_distance, Intersect intersect) const;
+		/**
+		 * Find the first primitive box along the ray.
+		 * @param ray Ray to cast.
+		 * @param max_distance Hits further along the ray than this are ignored.
+		 * @return Primitive whose box the ray enters first. If it hits none, nullopt.
+		 */
+		std::optional<RayHit> closest_hit(const Ray& ray, float max_distance) const;
+		/**
+		 * Find every primitive whose box overlaps the given box.
+		 * @param box Box to test.
+		 * @param visitor Invoked as visitor(std::size_t primitive) for each overlapping primitive, in no particular order.
+		 */
+		template<typename Visitor>
+		void overlap(const AABB& box, Visitor visitor) const;
+		/**
+		 * Find every primitive whose box overlaps the given box.
+		 * @param box Box to test.
+		 * @return Index of each overlapping primitive, in no particular order.
+		 */
+		std::vector<std::size_t> overlap(const AABB& box) const;
+	private:
+		static constexpr std::size_t width = 4;
+		/// Traversal never needs more than this many pending nodes. The build bounds the depth of the hierarchy to guarantee it.
+		static constexpr std::size_t stack_size = 256;
+
+		struct Node
+		{
+			/// Box of each child, as structure-of-arrays: min x, min y, min z, max x, max y then max z of all four children. Unused children have an inverted box, so are never hit.
+			alignas(16) float bounds[6][width];
+			/// If the child is a leaf, the index of its first primitive within primitive_indices. Otherwise, the index of its node.
+			std::uint32_t child[width];
+			/// If the child is a leaf, its number of primitives. Otherwise, 0.
+			std::uint32_t count[width];
+		};
+
+		/// A ray prepared for traversal.
+		struct Traversal
+		{
+			Traversal(const Ray& ray);
+
+			float origin[3];
+			float inverse_direction[3];
+			/// Row of Node::bounds which each slab is entered through. This is the min if the direction is positive along that axis, otherwise the max.
+			std::size_t near_row[3];
+		};
+
+		struct StackEntry
+		{
+			std::uint32_t node;
+			float distance;
+		};
+
+		/**
+		 * Intersect the ray with all four children of a node.
+		 * @param distances Distance along the ray at which it enters each child. Only written for children which are hit.
+		 * @return Bitmask of the children which are hit.
+		 */
+		static int intersect_children(const Node& node, const Traversal& ray, float max_distance, float* distances);
+		static bool overlap_child(const Node& node, std::size_t child, const AABB& box);
+
+		std::vector<Node> nodes;
+		std::vector<std::uint32_t> primitive_indices;
+		std::vector<AABB> primitive_bounds;
+	};
+
+	/**
+	 * @}
+	 */
+}
+
+#include "geo/bvh.inl"
+#endif // TOPAZ_GEO_BVH_HPP
@@ -0,0 +1,176 @@
+#include "geo/simd.hpp"
+#include "core/debug/assert.hpp"
+#include <array>
+#include <utility>
+
+namespace tz::geo
+{
+	template<typename Intersect>
+	bool BVH::raycast(const Ray& ray, float max_distance, Intersect intersect) const
+	{
+		if(this->nodes.empty())
+			return false;
+		const Traversal traversal{ray};
+		std::array<std::uint32_t, stack_size> stack;
+		std::size_t stack_count = 0;
+		stack[stack_count++] = 0;
+		while(stack_count > 0)
+		{
+			const Node& node = this->nodes[stack[--stack_count]];
+			float distances[width];
+			const int mask = intersect_children(node, traversal, max_distance, distances);
+			for(std::size_t i = 0; i < width; i++)
+			{
+				if(!(mask & (1 << i)))
+					continue;
+				if(node.count[i] == 0)
+				{
+					topaz_assert(stack_count < stack_size, "tz::geo::BVH::raycast(...): Traversal stack overflow. The hierarchy is deeper than should be possible.");
+					stack[stack_count++] = node.child[i];
+					continue;
+				}
+				for(std::uint32_t j = node.child[i]; j < node.child[i] + node.count[i]; j++)
+				{
+					if(intersect(static_cast<std::size_t>(this->primitive_indices[j]), max_distance).has_value())
+						return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	template<typename Intersect>
+	std::optional<RayHit> BVH::closest_hit(const Ray& ray, float max_distance, Intersect intersect) const
+	{
+		if(this->nodes.empty())
+			return std::nullopt;
+		const Traversal traversal{ray};
+		std::optional<RayHit> closest = std::nullopt;
+		float closest_distance = max_distance;
+		std::array<StackEntry, stack_size> stack;
+		std::size_t stack_count = 0;
+		stack[stack_count++] = {0, 0.0f};
+		while(stack_count > 0)
+		{
+			const StackEntry entry = stack[--stack_count];
+			// We may have found something closer since this node was pushed.
+			if(entry.distance > closest_distance)
+				continue;
+			const Node& node = this->nodes[entry.node];
+			float distances[width];
+			const int mask = intersect_children(node, traversal, closest_distance, distances);
+			// Leaves are tested immediately. Internal children are pushed furthest-first, so that the nearest is popped next.
+			std::size_t internal[width];
+			std::size_t internal_count = 0;
+			for(std::size_t i = 0; i < width; i++)
+			{
+				if(!(mask & (1 << i)))
+					continue;
+				if(node.count[i] == 0)
+				{
+					internal[internal_count++] = i;
+					continue;
+				}
+				for(std::uint32_t j = node.child[i]; j < node.child[i] + node.count[i]; j++)
+				{
+					const std::size_t primitive = this->primitive_indices[j];
+					const std::optional<float> distance = intersect(primitive, closest_distance);
+					if(distance.has_value() && distance.value() <= closest_distance)
+					{
+						closest_distance = distance.value();
+						closest = RayHit{primitive, distance.value()};
+					}
+				}
+			}
+			// Insertion sort by descending distance. There are at most four.
+			for(std::size_t i = 1; i < internal_count; i++)
+			{
+				for(std::size_t j = i; j > 0 && distances[internal[j - 1]] < distances[internal[j]]; j--)
+				{
+					std::swap(internal[j - 1], internal[j]);
+				}
+			}
+			for(std::size_t i = 0; i < internal_count; i++)
+			{
+				topaz_assert(stack_count < stack_size, "tz::geo::BVH::closest_hit(...): Traversal stack overflow. The hierarchy is deeper than should be possible.");
+				stack[stack_count++] = {node.child[internal[i]], distances[internal[i]]};
+			}
+		}
+		return closest;
+	}
+
+	template<typename Visitor>
+	void BVH::overlap(const AABB& box, Visitor visitor) const
+	{
+		if(this->nodes.empty())
+			return;
+		std::array<std::uint32_t, stack_size> stack;
+		std::size_t stack_count = 0;
+		stack[stack_count++] = 0;
+		while(stack_count > 0)
+		{
+			const Node& node = this->nodes[stack[--stack_count]];
+			for(std::size_t i = 0; i < width; i++)
+			{
+				if(!overlap_child(node, i, box))
+					continue;
+				if(node.count[i] == 0)
+				{
+					topaz_assert(stack_count < stack_size, "tz::geo::BVH::overlap(...): Traversal stack overflow. The hierarchy is deeper than should be possible.");
+					stack[stack_count++] = node.child[i];
+					continue;
+				}
+				for(std::uint32_t j = node.child[i]; j < node.child[i] + node.count[i]; j++)
+				{
+					const std::size_t primitive = this->primitive_indices[j];
+					if(overlaps(this->primitive_bounds[primitive], box))
+						visitor(primitive);
+				}
+			}
+		}
+	}
+
+	inline int BVH::intersect_children(const Node& node, const Traversal& ray, float max_distance, float* distances)
+	{
+		// Slab test. Where the origin lies exactly on a slab parallel to the ray, 0 * inf gives NaN. The min/max operand order below makes such slabs non-constraining.
+	#if TOPAZ_GEO_SIMD
+		__m128 near = _mm_setzero_ps();
+		__m128 far = _mm_set1_ps(max_distance);
+		for(std::size_t axis = 0; axis < 3; axis++)
+		{
+			const __m128 origin = _mm_set1_ps(ray.origin[axis]);
+			const __m128 inverse_direction = _mm_set1_ps(ray.inverse_direction[axis]);
+			const std::size_t near_row = ray.near_row[axis];
+			const std::size_t far_row = near_row < 3 ? near_row + 3 : near_row - 3;
+			// _mm_max_ps and _mm_min_ps return their second operand if either is NaN.
+			near = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.bounds[near_row]), origin), inverse_direction), near);
+			far = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.bounds[far_row]), origin), inverse_direction), far);
+		}
+		_mm_storeu_ps(distances, near);
+		return _mm_movemask_ps(_mm_cmple_ps(near, far));
+	#else
+		int mask = 0;
+		for(std::size_t i = 0; i < width; i++)
+		{
+			float near = 0.0f;
+			float far = max_distance;
+			for(std::size_t axis = 0; axis < 3; axis++)
+			{
+				const std::size_t near_row = ray.near_row[axis];
+				const std::size_t far_row = near_row < 3 ? near_row + 3 : near_row - 3;
+				const float slab_near = (node.bounds[near_row][i] - ray.origin[axis]) * ray.inverse_direction[axis];
+				const float slab_far = (node.bounds[far_row][i] - ray.origin[axis]) * ray.inverse_direction[axis];
+				// Comparisons with NaN are false, so NaN slabs are skipped.
+				if(slab_near > near)
+					near = slab_near;
+				if(slab_far < far)
+					far = slab_far;
+			}
+			distances[i] = near;
+			if(near <= far)
+				mask |= (1 << i);
+		}
+		return mask;
+	#endif
+	}
+}
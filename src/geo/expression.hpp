@@ -0,0 +1,157 @@
+#ifndef TOPAZ_GEO_EXPRESSION_HPP
+#define TOPAZ_GEO_EXPRESSION_HPP
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace tz
+{
+	template<typename T, std::size_t S>
+	class Vector;
+	template<typename T, std::size_t R, std::size_t C>
+	class Matrix;
+
+	/**
+	 * \addtogroup tz_geo Topaz Geometry Library (tz::geo)
+	 * A collection of geometric data structures and mathematical types, such as vectors and matrices.
+	 * @{
+	 */
+
+	namespace detail
+	{
+		template<typename Result, typename Op, typename L, typename R>
+		class Elementwise;
+
+		/// Describes what a geometric operand evaluates to. Specialised for tz::Vector, tz::Matrix and every Elementwise expression. Anything else (such as a scalar) has a void result.
+		template<typename T>
+		struct GeoTraits
+		{
+			using result_type = void;
+		};
+
+		template<typename T, std::size_t S>
+		struct GeoTraits<Vector<T, S>>
+		{
+			using result_type = Vector<T, S>;
+			using value_type = T;
+			static constexpr std::size_t size = S;
+			static constexpr bool is_vector = true;
+		};
+
+		template<typename T, std::size_t R, std::size_t C>
+		struct GeoTraits<Matrix<T, R, C>>
+		{
+			using result_type = Matrix<T, R, C>;
+			using value_type = T;
+			static constexpr std::size_t size = R * C;
+			static constexpr std::size_t rows = R;
+			static constexpr bool is_vector = false;
+		};
+
+		template<typename Result, typename Op, typename L, typename R>
+		struct GeoTraits<Elementwise<Result, Op, L, R>> : GeoTraits<Result>{};
+
+		/// The tz::Vector or tz::Matrix which the given operand evaluates to, or void if it isn't one.
+		template<typename T>
+		using result_t = typename GeoTraits<std::decay_t<T>>::result_type;
+		/// True if T is a tz::Vector, tz::Matrix or an expression thereof.
+		template<typename T>
+		constexpr bool is_operand = !std::is_void_v<result_t<T>>;
+		/// True if T is an unevaluated expression.
+		template<typename T>
+		constexpr bool is_expression = is_operand<T> && !std::is_same_v<std::decay_t<T>, result_t<T>>;
+		/// True if T is an expression which evaluates to exactly Result. Used to constrain the converting constructors of tz::Vector and tz::Matrix.
+		template<typename T, typename Result>
+		constexpr bool is_expression_of = is_expression<T> && std::is_same_v<result_t<T>, Result>;
+		/// True if L and R can be combined element-wise: They must evaluate to exactly the same type.
+		template<typename L, typename R>
+		constexpr bool same_shape = is_operand<L> && is_operand<R> && std::is_same_v<result_t<L>, result_t<R>>;
+
+		/**
+		 * How an expression holds onto an operand.
+		 * Named vectors and matrices are held by reference. Everything else (temporaries, sub-expressions and scalars) is held by value, so that an expression built from temporaries (e.g returned from a function) never dangles.
+		 */
+		template<typename T>
+		using stored_t = std::conditional_t<std::is_lvalue_reference_v<T> && is_operand<T> && !is_expression<T>, const std::decay_t<T>&, std::decay_t<T>>;
+
+		/**
+		 * An unevaluated element-wise operation between two operands, each of which is either a tz::Vector, tz::Matrix, another Elementwise or a scalar.
+		 * The elements are only computed when the expression is converted into a Result, which happens in a single pass no matter how many operations are chained together.
+		 * Note: Expressions hold named operands by reference. Avoid storing one (e.g via auto) beyond the lifetime of the vectors and matrices it refers to.
+		 * @tparam Result tz::Vector or tz::Matrix which this expression evaluates to.
+		 * @tparam Op Binary function object applied to each pair of elements.
+		 * @tparam L Storage type of the left operand.
+		 * @tparam R Storage type of the right operand.
+		 */
+		template<typename Result, typename Op, typename L, typename R>
+		class Elementwise
+		{
+		public:
+			using result_type = Result;
+			using value_type = typename GeoTraits<Result>::value_type;
+
+			template<typename LHS, typename RHS>
+			constexpr Elementwise(LHS&& lhs, RHS&& rhs);
+			/**
+			 * Compute a single element of the result.
+			 * @param idx Index of the element. For matrices, this indexes the elements in column-major order.
+			 * @return Value of the element.
+			 */
+			constexpr value_type element(std::size_t idx) const;
+			/**
+			 * Evaluate the whole expression.
+			 * @return Result of the expression.
+			 */
+			constexpr Result eval() const;
+
+			/*
+			 * Read-only equivalents of tz::Vector's member functions, so that expressions can be used in-place like before. These are only available for vector expressions.
+			 */
+
+			constexpr value_type operator[](std::size_t idx) const;
+			constexpr value_type dot(const Result& rhs) const;
+			value_type length() const;
+			Result normalised() const;
+			constexpr bool operator==(const Result& rhs) const;
+		private:
+			L lhs;
+			R rhs;
+		};
+
+		/// Retrieve an element from any operand. Scalars are broadcast to every element.
+		template<typename T>
+		constexpr decltype(auto) element(const T& operand, std::size_t idx);
+	}
+
+	/*
+	 * Element-wise arithmetic on tz::Vector and tz::Matrix. Each of these returns an unevaluated expression rather than a result.
+	 * Operands must evaluate to the same type, e.g a tz::Vec3 can be added to a tz::Vec3 or to an expression producing a tz::Vec3.
+	 */
+
+	template<typename L, typename R, typename = std::enable_if_t<detail::same_shape<L, R>>>
+	constexpr auto operator+(L&& lhs, R&& rhs);
+	template<typename L, typename R, typename = std::enable_if_t<detail::same_shape<L, R>>>
+	constexpr auto operator-(L&& lhs, R&& rhs);
+	template<typename L, typename = std::enable_if_t<detail::is_operand<L>>>
+	constexpr auto operator*(L&& lhs, typename detail::GeoTraits<std::decay_t<L>>::value_type scalar);
+	template<typename L, typename = std::enable_if_t<detail::is_operand<L>>>
+	constexpr auto operator/(L&& lhs, typename detail::GeoTraits<std::decay_t<L>>::value_type scalar);
+	/// Matrices additionally support adding and subtracting a scalar from every element.
+	template<typename L, typename = std::enable_if_t<detail::is_operand<L> && !detail::GeoTraits<std::decay_t<L>>::is_vector>>
+	constexpr auto operator+(L&& lhs, typename detail::GeoTraits<std::decay_t<L>>::value_type scalar);
+	template<typename L, typename = std::enable_if_t<detail::is_operand<L> && !detail::GeoTraits<std::decay_t<L>>::is_vector>>
+	constexpr auto operator-(L&& lhs, typename detail::GeoTraits<std::decay_t<L>>::value_type scalar);
+	/**
+	 * Matrix products are not element-wise, so a matrix expression on the left-hand side of one is evaluated first.
+	 */
+	template<typename L, typename R, typename = std::enable_if_t<detail::is_expression<L> && !detail::GeoTraits<std::decay_t<L>>::is_vector && detail::is_operand<R>>>
+	constexpr auto operator*(const L& lhs, const R& rhs);
+
+	/**
+	 * @}
+	 */
+}
+
+#include "geo/expression.inl"
+#endif // TOPAZ_GEO_EXPRESSION_HPP
@@ -0,0 +1,142 @@
+#include <cmath>
+
+namespace tz
+{
+	namespace detail
+	{
+		template<typename Result, typename Op, typename L, typename R>
+		template<typename LHS, typename RHS>
+		constexpr Elementwise<Result, Op, L, R>::Elementwise(LHS&& lhs, RHS&& rhs): lhs(std::forward<LHS>(lhs)), rhs(std::forward<RHS>(rhs)){}
+
+		template<typename Result, typename Op, typename L, typename R>
+		constexpr typename Elementwise<Result, Op, L, R>::value_type Elementwise<Result, Op, L, R>::element(std::size_t idx) const
+		{
+			return Op{}(detail::element(this->lhs, idx), detail::element(this->rhs, idx));
+		}
+
+		template<typename Result, typename Op, typename L, typename R>
+		constexpr Result Elementwise<Result, Op, L, R>::eval() const
+		{
+			return {*this};
+		}
+
+		template<typename Result, typename Op, typename L, typename R>
+		constexpr typename Elementwise<Result, Op, L, R>::value_type Elementwise<Result, Op, L, R>::operator[](std::size_t idx) const
+		{
+			static_assert(GeoTraits<Result>::is_vector, "tz::detail::Elementwise<...>::operator[]: Only vector expressions can be indexed. Evaluate matrix expressions first.");
+			return this->element(idx);
+		}
+
+		template<typename Result, typename Op, typename L, typename R>
+		constexpr typename Elementwise<Result, Op, L, R>::value_type Elementwise<Result, Op, L, R>::dot(const Result& rhs) const
+		{
+			static_assert(GeoTraits<Result>::is_vector, "tz::detail::Elementwise<...>::dot(...): Only vector expressions have a dot product.");
+			value_type sum = value_type();
+			for(std::size_t i = 0; i < GeoTraits<Result>::size; i++)
+			{
+				sum += this->element(i) * rhs[i];
+			}
+			return sum;
+		}
+
+		template<typename Result, typename Op, typename L, typename R>
+		typename Elementwise<Result, Op, L, R>::value_type Elementwise<Result, Op, L, R>::length() const
+		{
+			static_assert(GeoTraits<Result>::is_vector, "tz::detail::Elementwise<...>::length(): Only vector expressions have a length.");
+			value_type sum_squares = value_type();
+			for(std::size_t i = 0; i < GeoTraits<Result>::size; i++)
+			{
+				value_type e = this->element(i);
+				sum_squares += e * e;
+			}
+			return std::sqrt(sum_squares);
+		}
+
+		template<typename Result, typename Op, typename L, typename R>
+		Result Elementwise<Result, Op, L, R>::normalised() const
+		{
+			static_assert(GeoTraits<Result>::is_vector, "tz::detail::Elementwise<...>::normalised(): Only vector expressions can be normalised.");
+			return this->eval().normalised();
+		}
+
+		template<typename Result, typename Op, typename L, typename R>
+		constexpr bool Elementwise<Result, Op, L, R>::operator==(const Result& rhs) const
+		{
+			return this->eval() == rhs;
+		}
+
+		template<typename T>
+		constexpr decltype(auto) element(const T& operand, std::size_t idx)
+		{
+			if constexpr(is_expression<T>)
+			{
+				return operand.element(idx);
+			}
+			else if constexpr(is_operand<T>)
+			{
+				if constexpr(GeoTraits<T>::is_vector)
+				{
+					return operand.data()[idx];
+				}
+				else
+				{
+					// Not via data(), as walking from one column into the next isn't allowed in a constant expression.
+					constexpr std::size_t rows = GeoTraits<T>::rows;
+					return operand[idx / rows][idx % rows];
+				}
+			}
+			else
+			{
+				return operand;
+			}
+		}
+
+		template<typename Op, typename L, typename R>
+		constexpr auto make_elementwise(L&& lhs, R&& rhs)
+		{
+			return Elementwise<result_t<L>, Op, stored_t<L&&>, stored_t<R&&>>{std::forward<L>(lhs), std::forward<R>(rhs)};
+		}
+	}
+
+	template<typename L, typename R, typename>
+	constexpr auto operator+(L&& lhs, R&& rhs)
+	{
+		return detail::make_elementwise<std::plus<>>(std::forward<L>(lhs), std::forward<R>(rhs));
+	}
+
+	template<typename L, typename R, typename>
+	constexpr auto operator-(L&& lhs, R&& rhs)
+	{
+		return detail::make_elementwise<std::minus<>>(std::forward<L>(lhs), std::forward<R>(rhs));
+	}
+
+	template<typename L, typename>
+	constexpr auto operator*(L&& lhs, typename detail::GeoTraits<std::decay_t<L>>::value_type scalar)
+	{
+		return detail::make_elementwise<std::multiplies<>>(std::forward<L>(lhs), scalar);
+	}
+
+	template<typename L, typename>
+	constexpr auto operator/(L&& lhs, typename detail::GeoTraits<std::decay_t<L>>::value_type scalar)
+	{
+		return detail::make_elementwise<std::divides<>>(std::forward<L>(lhs), scalar);
+	}
+
+	template<typename L, typename>
+	constexpr auto operator+(L&& lhs, typename detail::GeoTraits<std::decay_t<L>>::value_type scalar)
+	{
+		return detail::make_elementwise<std::plus<>>(std::forward<L>(lhs), scalar);
+	}
+
+	template<typename L, typename>
+	constexpr auto operator-(L&& lhs, typename detail::GeoTraits<std::decay_t<L>>::value_type scalar)
+	{
+		return detail::make_elementwise<std::minus<>>(std::forward<L>(lhs), scalar);
+	}
+
+	template<typename L, typename R, typename>
+	constexpr auto operator*(const L& lhs, const R& rhs)
+	{
+		return lhs.eval() * rhs;
+	}
+}
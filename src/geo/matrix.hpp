@@ -1,7 +1,9 @@
 #ifndef TOPAZ_GEO_MATRIX_HPP
 #define TOPAZ_GEO_MATRIX_HPP
 #include "geo/vector.hpp"
+#include "geo/simd.hpp"
 #include <array>
+#include <type_traits>
 
 namespace tz
 {
@@ -16,7 +18,13 @@ namespace tz
 	{
 	public:
 		Matrix() = default;
-		Matrix(std::array<std::array<T, R>, C> data);
+		constexpr Matrix(std::array<std::array<T, R>, C> data);
+		/**
+		 * Evaluate an element-wise expression, such as a + b - 1.0f, directly into a new matrix.
+		 * @param expression Expression producing a matrix of this type.
+		 */
+		template<typename E, typename = std::enable_if_t<detail::is_expression_of<E, Matrix<T, R, C>>>>
+		constexpr Matrix(const E& expression);
 
 		static constexpr Matrix<T, R, C> identity()
 		{
@@ -37,34 +45,49 @@ namespace tz
 		using Row = std::array<T, R>;
 		using Column = std::array<T, C>;
 
-		const Row& operator[](std::size_t row_idx) const;
-		Row& operator[](std::size_t row_idx);
-		const T& operator()(std::size_t row, std::size_t column) const;
-		T& operator()(std::size_t row, std::size_t column);
+		constexpr const Row& operator[](std::size_t row_idx) const;
+		constexpr Row& operator[](std::size_t row_idx);
+		constexpr const T& operator()(std::size_t row, std::size_t column) const;
+		constexpr T& operator()(std::size_t row, std::size_t column);
 
-		Matrix<T, R, C>& operator+=(T scalar);
-		Matrix<T, R, C>& operator+=(const Matrix<T, R, C>& matrix);
-		Matrix<T, R, C> operator+(T scalar) const;
-		Matrix<T, R, C> operator+(const Matrix<T, R, C>& matrix) const;
+		// Note: Element-wise binary operators (e.g +) are defined in geo/expression.hpp, and are evaluated lazily. Matrix products are not element-wise, so are evaluated eagerly.
+		constexpr Matrix<T, R, C>& operator+=(T scalar);
+		constexpr Matrix<T, R, C>& operator+=(const Matrix<T, R, C>& matrix);
 
-		Matrix<T, R, C>& operator-=(T scalar);
-		Matrix<T, R, C>& operator-=(const Matrix<T, R, C>& matrix);
-		Matrix<T, R, C> operator-(T scalar) const;
-		Matrix<T, R, C> operator-(const Matrix<T, R, C>& matrix) const;
+		constexpr Matrix<T, R, C>& operator-=(T scalar);
+		constexpr Matrix<T, R, C>& operator-=(const Matrix<T, R, C>& matrix);
 
-		Matrix<T, R, C>& operator*=(T scalar);
-		Matrix<T, R, C>& operator*=(const Matrix<T, R, C>& matrix);
-		Matrix<T, R, C> operator*(T scalar) const;
-		Matrix<T, R, C> operator*(const Matrix<T, R, C>& matrix) const;
+		constexpr Matrix<T, R, C>& operator*=(T scalar);
+		constexpr Matrix<T, R, C>& operator*=(const Matrix<T, R, C>& matrix);
+		constexpr Matrix<T, R, C> operator*(const Matrix<T, R, C>& matrix) const;
 
-		Vector<T, R> operator*(const Vector<T, C>& vec) const;
+		constexpr Vector<T, R> operator*(const Vector<T, C>& vec) const;
 
-		bool operator==(T scalar) const;
-		bool operator==(const Matrix<T, R, C>& matrix) const;
+		constexpr bool operator==(T scalar) const;
+		constexpr bool operator==(const Matrix<T, R, C>& matrix) const;
 
+		/**
+		 * Retrieve the inverse of this matrix.
+		 * Note: Only 3x3 and 4x4 matrices are supported. For float matrices, this uses tz::geo::simd kernels if they are enabled.
+		 * Precondition: The matrix is invertible (non-zero determinant). Otherwise, this will assert and invoke UB.
+		 * @return Inverse matrix.
+		 */
 		Matrix<T, R, C> inverse() const;
-		//template<std::size_t X = R, std::size_t Y = C, typename std::enable_if_t<std::conditional_t<X == Y>>>
-		Matrix<T, R, C> transpose() const;
+		/**
+		 * Retrieve the transpose of this matrix.
+		 * @return Transposed matrix.
+		 */
+		constexpr Matrix<T, R, C> transpose() const;
+		/**
+		 * Retrieve a pointer to the underlying elements, in column-major order.
+		 * @return Pointer to R*C contiguous elements.
+		 */
+		constexpr const T* data() const;
+		/**
+		 * Retrieve a pointer to the underlying elements, in column-major order.
+		 * @return Pointer to R*C contiguous elements.
+		 */
+		constexpr T* data();
 
 		#if TOPAZ_DEBUG
 		void debug_print() const;
@@ -77,6 +100,26 @@ namespace tz
 	using Mat4 = Matrix<float, 4, 4>;
 	using Mat3 = Matrix<float, 3, 3>;
 
+	namespace detail
+	{
+		/// True if Matrix<T, R, C> is a float matrix of the given square size, which tz::geo::simd has kernels for.
+		template<typename T, std::size_t R, std::size_t C, std::size_t N>
+		constexpr bool simd_square = tz::geo::simd::enabled && std::is_same_v<T, float> && R == N && C == N;
+
+		/*
+		 * Scalar implementations of the matrix operations. Matrix uses these whenever no SIMD kernel applies.
+		 * They are exposed so that the SIMD kernels can be tested and benchmarked against them.
+		 */
+		template<typename T, std::size_t R, std::size_t C>
+		constexpr Matrix<T, R, C> generic_multiply(const Matrix<T, R, C>& lhs, const Matrix<T, R, C>& rhs);
+		template<typename T, std::size_t R, std::size_t C>
+		constexpr Vector<T, R> generic_multiply(const Matrix<T, R, C>& lhs, const Vector<T, C>& rhs);
+		template<typename T, std::size_t R, std::size_t C>
+		constexpr Matrix<T, R, C> generic_transpose(const Matrix<T, R, C>& m);
+		template<typename T, std::size_t R, std::size_t C>
+		Matrix<T, R, C> generic_inverse(const Matrix<T, R, C>& m);
+	}
+
 	/**
 	 * @}
 	 */
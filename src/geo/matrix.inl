@@ -6,24 +6,32 @@
 namespace tz
 {
 	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>::Matrix(std::array<std::array<T, R>, C> data): mat(data){}
+	constexpr Matrix<T, R, C>::Matrix(std::array<std::array<T, R>, C> data): mat(data){}
 
 	template<typename T, std::size_t R, std::size_t C>
-	const typename Matrix<T, R, C>::Row& Matrix<T, R, C>::operator[](std::size_t row_idx) const
+	template<typename E, typename>
+	constexpr Matrix<T, R, C>::Matrix(const E& expression): mat{}
+	{
+		for(std::size_t i = 0; i < R * C; i++)
+			this->mat[i / R][i % R] = expression.element(i);
+	}
+
+	template<typename T, std::size_t R, std::size_t C>
+	constexpr const typename Matrix<T, R, C>::Row& Matrix<T, R, C>::operator[](std::size_t row_idx) const
 	{
 		topaz_assert(row_idx < R, "tz::Matrix<T, ", R, ", ", C, ">::operator[", row_idx, "]: Index out of range!");
 		return this->mat[row_idx];
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	typename Matrix<T, R, C>::Row& Matrix<T, R, C>::operator[](std::size_t row_idx)
+	constexpr typename Matrix<T, R, C>::Row& Matrix<T, R, C>::operator[](std::size_t row_idx)
 	{
 		topaz_assert(row_idx < R, "tz::Matrix<T, ", R, ", ", C, ">::operator[", row_idx, "]: Index out of range!");
 		return this->mat[row_idx];
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	const T& Matrix<T, R, C>::operator()(std::size_t row, std::size_t column) const
+	constexpr const T& Matrix<T, R, C>::operator()(std::size_t row, std::size_t column) const
 	{
 		topaz_assert(row < R, "tz::Matrix<T, ", R, ", ", C, ">::operator(", row, ", ", column, "): Row index out of range!");
 		topaz_assert(column < R, "tz::Matrix<T, ", R, ", ", C, ">::operator(", row, ", ", column, "): Column index out of range!");
@@ -31,7 +39,7 @@ namespace tz
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	T& Matrix<T, R, C>::operator()(std::size_t row, std::size_t column)
+	constexpr T& Matrix<T, R, C>::operator()(std::size_t row, std::size_t column)
 	{
 		topaz_assert(row < R, "tz::Matrix<T, ", R, ", ", C, ">::operator(", row, ", ", column, "): Row index out of range!");
 		topaz_assert(column < R, "tz::Matrix<T, ", R, ", ", C, ">::operator(", row, ", ", column, "): Column index out of range!");
@@ -39,7 +47,7 @@ namespace tz
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>& Matrix<T, R, C>::operator+=(T scalar)
+	constexpr Matrix<T, R, C>& Matrix<T, R, C>::operator+=(T scalar)
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -52,7 +60,7 @@ namespace tz
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>& Matrix<T, R, C>::operator+=(const Matrix<T, R, C>& matrix)
+	constexpr Matrix<T, R, C>& Matrix<T, R, C>::operator+=(const Matrix<T, R, C>& matrix)
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -65,23 +73,7 @@ namespace tz
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::operator+(T scalar) const
-	{
-		Matrix<T, R, C> copy = *this;
-		copy += scalar;
-		return std::move(copy);
-	}
-
-	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::operator+(const Matrix<T, R, C>& matrix) const
-	{
-		Matrix<T, R, C> copy = *this;
-		copy += matrix;
-		return std::move(copy);
-	}
-
-	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>& Matrix<T, R, C>::operator-=(T scalar)
+	constexpr Matrix<T, R, C>& Matrix<T, R, C>::operator-=(T scalar)
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -94,7 +86,7 @@ namespace tz
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>& Matrix<T, R, C>::operator-=(const Matrix<T, R, C>& matrix)
+	constexpr Matrix<T, R, C>& Matrix<T, R, C>::operator-=(const Matrix<T, R, C>& matrix)
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -107,23 +99,7 @@ namespace tz
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::operator-(T scalar) const
-	{
-		Matrix<T, R, C> copy = *this;
-		copy -= scalar;
-		return std::move(copy);
-	}
-
-	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::operator-(const Matrix<T, R, C>& matrix) const
-	{
-		Matrix<T, R, C> copy = *this;
-		copy -= matrix;
-		return std::move(copy);
-	}
-
-	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>& Matrix<T, R, C>::operator*=(T scalar)
+	constexpr Matrix<T, R, C>& Matrix<T, R, C>::operator*=(T scalar)
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -136,53 +112,61 @@ namespace tz
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>& Matrix<T, R, C>::operator*=(const Matrix<T, R, C>& matrix)
+	constexpr Matrix<T, R, C>& Matrix<T, R, C>::operator*=(const Matrix<T, R, C>& matrix)
 	{
-		Matrix<T, R, C> m = *this;
-		for(std::size_t i = 0; i < R; i++)
-		{
-			for(std::size_t j = 0; j < C; j++)
+		#if TOPAZ_GEO_SIMD
+			if constexpr(detail::simd_square<T, R, C, 4>)
 			{
-				T res_ele = T();
-				for(std::size_t k = 0; k < C; k++)
+				if(!tz::geo::simd::constant_evaluated())
 				{
-					res_ele += (m(i, k) * matrix(k, j));
+					tz::geo::simd::mat4_multiply(this->data(), matrix.data(), this->data());
+					return *this;
 				}
-				(*this)(i, j) = res_ele;
 			}
-		}
+		#endif
+		*this = detail::generic_multiply(*this, matrix);
 		return *this;
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::operator*(T scalar) const
-	{
-		Matrix<T, R, C> copy = *this;
-		copy *= scalar;
-		return std::move(copy);
-	}
-
-	template<typename T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::operator*(const Matrix<T, R, C>& matrix) const
+	constexpr Matrix<T, R, C> Matrix<T, R, C>::operator*(const Matrix<T, R, C>& matrix) const
 	{
+		#if TOPAZ_GEO_SIMD
+			// Write straight into the result rather than going through a copy.
+			if constexpr(detail::simd_square<T, R, C, 4>)
+			{
+				if(!tz::geo::simd::constant_evaluated())
+				{
+					Matrix<T, R, C> res{};
+					tz::geo::simd::mat4_multiply(this->data(), matrix.data(), res.data());
+					return res;
+				}
+			}
+		#endif
 		Matrix<T, R, C> copy = *this;
 		copy *= matrix;
-		return std::move(copy);
+		return copy;
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	Vector<T, R> Matrix<T, R, C>::operator*(const Vector<T, C>& vec) const
+	constexpr Vector<T, R> Matrix<T, R, C>::operator*(const Vector<T, C>& vec) const
 	{
-		Vector<T, R> ret;
-		for(std::size_t i = 0; i < R; i++)
-		{
-			ret[i] = tz::Vec4{(*this)[i]}.dot(vec);
-		}
-		return ret;
+		#if TOPAZ_GEO_SIMD
+			if constexpr(detail::simd_square<T, R, C, 4>)
+			{
+				if(!tz::geo::simd::constant_evaluated())
+				{
+					Vector<T, R> ret{};
+					tz::geo::simd::mat4_multiply_vec4(this->data(), vec.data(), ret.data());
+					return ret;
+				}
+			}
+		#endif
+		return detail::generic_multiply(*this, vec);
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	bool Matrix<T, R, C>::operator==(T scalar) const
+	constexpr bool Matrix<T, R, C>::operator==(T scalar) const
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -196,7 +180,7 @@ namespace tz
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	bool Matrix<T, R, C>::operator==(const Matrix<T, R, C>& matrix) const
+	constexpr bool Matrix<T, R, C>::operator==(const Matrix<T, R, C>& matrix) const
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -212,163 +196,55 @@ namespace tz
 	template<typename T, std::size_t R, std::size_t C>
 	Matrix<T, R, C> Matrix<T, R, C>::inverse() const
 	{
-		// Create copy of the current matrix to work with.
-		Matrix<T, R, C> mat = Matrix<T, R, C>::identity();
-		// TODO: Replace with Jacobi's Method.
-		
-		// Column-major
-		auto at = [](Matrix<T, R, C>& m, std::size_t idx)->T&
-		{
-			// 5 ==> (1, 1)
-			// row_id = 5 / 4 == 1
-			// column_id = (1*4)
-			std::size_t row_id = idx / C;
-			std::size_t column_id = idx - (row_id*C);
-			return m(row_id, column_id);
-		};
-
-		auto cat = [](const Matrix<T, R, C>& m, std::size_t idx)->const T&
-		{
-			// 5 ==> (1, 1)
-			// row_id = 5 / 4 == 1
-			// column_id = (1*4)
-			std::size_t row_id = idx / C;
-			std::size_t column_id = idx - (row_id*C);
-			return m(row_id, column_id);
-		};
-
-		at(mat, 0) = cat(*this, 5) * cat(*this, 10) * cat(*this, 15) -
-				cat(*this, 5) * cat(*this, 11) * cat(*this, 14) -
-				cat(*this, 9) * cat(*this, 6)  * cat(*this, 15) +
-				cat(*this, 9) * cat(*this, 7)  * cat(*this, 14) + 
-				cat(*this, 13) * cat(*this, 6) * cat(*this, 11) - 
-				cat(*this, 13) * cat(*this, 7) * cat(*this, 10);
-
-		at(mat, 4) = -cat(*this, 4)  * cat(*this, 10) * cat(*this, 15) + 
-				cat(*this, 4)  * cat(*this, 11) * cat(*this, 14) + 
-				cat(*this, 8)  * cat(*this, 6)  * cat(*this, 15) - 
-				cat(*this, 8)  * cat(*this, 7)  * cat(*this, 14) - 
-				cat(*this, 12) * cat(*this, 6)  * cat(*this, 11) + 
-				cat(*this, 12) * cat(*this, 7)  * cat(*this, 10);
-
-		at(mat, 8) = cat(*this, 4)  * cat(*this, 9) * cat(*this, 15) - 
-				cat(*this, 4)  * cat(*this, 11) * cat(*this, 13) - 
-				cat(*this, 8)  * cat(*this, 5) * cat(*this, 15) + 
-				cat(*this, 8)  * cat(*this, 7) * cat(*this, 13) + 
-				cat(*this, 12) * cat(*this, 5) * cat(*this, 11) - 
-				cat(*this, 12) * cat(*this, 7) * cat(*this, 9);
-
-		at(mat, 12) = -cat(*this, 4)  * cat(*this, 9) * cat(*this, 14) + 
-				cat(*this, 4)  * cat(*this, 10) * cat(*this, 13) +
-				cat(*this, 8)  * cat(*this, 5) * cat(*this, 14) - 
-				cat(*this, 8)  * cat(*this, 6) * cat(*this, 13) - 
-				cat(*this, 12) * cat(*this, 5) * cat(*this, 10) + 
-				cat(*this, 12) * cat(*this, 6) * cat(*this, 9);
-
-		at(mat, 1) = -cat(*this, 1)  * cat(*this, 10) * cat(*this, 15) + 
-				cat(*this, 1)  * cat(*this, 11) * cat(*this, 14) + 
-				cat(*this, 9)  * cat(*this, 2) * cat(*this, 15) - 
-				cat(*this, 9)  * cat(*this, 3) * cat(*this, 14) - 
-				cat(*this, 13) * cat(*this, 2) * cat(*this, 11) + 
-				cat(*this, 13) * cat(*this, 3) * cat(*this, 10);
-
-		at(mat, 5) = cat(*this, 0)  * cat(*this, 10) * cat(*this, 15) - 
-				cat(*this, 0)  * cat(*this, 11) * cat(*this, 14) - 
-				cat(*this, 8)  * cat(*this, 2) * cat(*this, 15) + 
-				cat(*this, 8)  * cat(*this, 3) * cat(*this, 14) + 
-				cat(*this, 12) * cat(*this, 2) * cat(*this, 11) - 
-				cat(*this, 12) * cat(*this, 3) * cat(*this, 10);
-
-		at(mat, 9) = -cat(*this, 0)  * cat(*this, 9) * cat(*this, 15) + 
-				cat(*this, 0)  * cat(*this, 11) * cat(*this, 13) + 
-				cat(*this, 8)  * cat(*this, 1) * cat(*this, 15) - 
-				cat(*this, 8)  * cat(*this, 3) * cat(*this, 13) - 
-				cat(*this, 12) * cat(*this, 1) * cat(*this, 11) + 
-				cat(*this, 12) * cat(*this, 3) * cat(*this, 9);
-
-		at(mat, 13) = cat(*this, 0)  * cat(*this, 9) * cat(*this, 14) - 
-				cat(*this, 0)  * cat(*this, 10) * cat(*this, 13) - 
-				cat(*this, 8)  * cat(*this, 1) * cat(*this, 14) + 
-				cat(*this, 8)  * cat(*this, 2) * cat(*this, 13) + 
-				cat(*this, 12) * cat(*this, 1) * cat(*this, 10) - 
-				cat(*this, 12) * cat(*this, 2) * cat(*this, 9);
-
-		at(mat, 2) = cat(*this, 1)  * cat(*this, 6) * cat(*this, 15) - 
-				cat(*this, 1)  * cat(*this, 7) * cat(*this, 14) - 
-				cat(*this, 5)  * cat(*this, 2) * cat(*this, 15) + 
-				cat(*this, 5)  * cat(*this, 3) * cat(*this, 14) + 
-				cat(*this, 13) * cat(*this, 2) * cat(*this, 7) - 
-				cat(*this, 13) * cat(*this, 3) * cat(*this, 6);
-
-		at(mat, 6) = -cat(*this, 0)  * cat(*this, 6) * cat(*this, 15) + 
-				cat(*this, 0)  * cat(*this, 7) * cat(*this, 14) + 
-				cat(*this, 4)  * cat(*this, 2) * cat(*this, 15) - 
-				cat(*this, 4)  * cat(*this, 3) * cat(*this, 14) - 
-				cat(*this, 12) * cat(*this, 2) * cat(*this, 7) + 
-				cat(*this, 12) * cat(*this, 3) * cat(*this, 6);
-
-		at(mat, 10) = cat(*this, 0)  * cat(*this, 5) * cat(*this, 15) - 
-				cat(*this, 0)  * cat(*this, 7) * cat(*this, 13) - 
-				cat(*this, 4)  * cat(*this, 1) * cat(*this, 15) + 
-				cat(*this, 4)  * cat(*this, 3) * cat(*this, 13) + 
-				cat(*this, 12) * cat(*this, 1) * cat(*this, 7) - 
-				cat(*this, 12) * cat(*this, 3) * cat(*this, 5);
-
-		at(mat, 14) = -cat(*this, 0)  * cat(*this, 5) * cat(*this, 14) + 
-				cat(*this, 0)  * cat(*this, 6) * cat(*this, 13) + 
-				cat(*this, 4)  * cat(*this, 1) * cat(*this, 14) - 
-				cat(*this, 4)  * cat(*this, 2) * cat(*this, 13) - 
-				cat(*this, 12) * cat(*this, 1) * cat(*this, 6) + 
-				cat(*this, 12) * cat(*this, 2) * cat(*this, 5);
-
-		at(mat, 3) = -cat(*this, 1) * cat(*this, 6) * cat(*this, 11) + 
-				cat(*this, 1) * cat(*this, 7) * cat(*this, 10) + 
-				cat(*this, 5) * cat(*this, 2) * cat(*this, 11) - 
-				cat(*this, 5) * cat(*this, 3) * cat(*this, 10) - 
-				cat(*this, 9) * cat(*this, 2) * cat(*this, 7) + 
-				cat(*this, 9) * cat(*this, 3) * cat(*this, 6);
-
-		at(mat, 7) = cat(*this, 0) * cat(*this, 6) * cat(*this, 11) - 
-				cat(*this, 0) * cat(*this, 7) * cat(*this, 10) - 
-				cat(*this, 4) * cat(*this, 2) * cat(*this, 11) + 
-				cat(*this, 4) * cat(*this, 3) * cat(*this, 10) + 
-				cat(*this, 8) * cat(*this, 2) * cat(*this, 7) - 
-				cat(*this, 8) * cat(*this, 3) * cat(*this, 6);
-
-		at(mat, 11) = -cat(*this, 0) * cat(*this, 5) * cat(*this, 11) + 
-				cat(*this, 0) * cat(*this, 7) * cat(*this, 9) + 
-				cat(*this, 4) * cat(*this, 1) * cat(*this, 11) - 
-				cat(*this, 4) * cat(*this, 3) * cat(*this, 9) - 
-				cat(*this, 8) * cat(*this, 1) * cat(*this, 7) + 
-				cat(*this, 8) * cat(*this, 3) * cat(*this, 5);
-
-		at(mat, 15) = cat(*this, 0) * cat(*this, 5) * cat(*this, 10) - 
-				cat(*this, 0) * cat(*this, 6) * cat(*this, 9) - 
-				cat(*this, 4) * cat(*this, 1) * cat(*this, 10) + 
-				cat(*this, 4) * cat(*this, 2) * cat(*this, 9) + 
-				cat(*this, 8) * cat(*this, 1) * cat(*this, 6) - 
-				cat(*this, 8) * cat(*this, 2) * cat(*this, 5);
-
-		float determinant = cat(*this, 0) * cat(mat, 0) + cat(*this, 1) * cat(mat, 4) + cat(*this, 2) * cat(mat, 8) + cat(*this, 3) * cat(mat, 12);
-		topaz_assert(determinant != 0, "tz::geo::Matrix<T, ", R, ", ", C, ">::inverse(): Cannot get inverse because determinant is zero.");
-		determinant = 1.0f / determinant;
-		for(std::size_t i = 0; i < 16; i++)
-			at(mat, i) = cat(mat, i) * determinant;
-		return mat;
+		#if TOPAZ_GEO_SIMD
+			if constexpr(detail::simd_square<T, R, C, 4> || detail::simd_square<T, R, C, 3>)
+			{
+				Matrix<T, R, C> inv;
+				float determinant;
+				if constexpr(R == 4)
+					determinant = tz::geo::simd::mat4_inverse(this->data(), inv.data());
+				else
+					determinant = tz::geo::simd::mat3_inverse(this->data(), inv.data());
+				topaz_assert(determinant != 0, "tz::geo::Matrix<T, ", R, ", ", C, ">::inverse(): Cannot get inverse because determinant is zero.");
+				return inv;
+			}
+		#endif
+		return detail::generic_inverse(*this);
+	}
+
+	template<typename T, std::size_t R, std::size_t C>
+	constexpr Matrix<T, R, C> Matrix<T, R, C>::transpose() const
+	{
+		#if TOPAZ_GEO_SIMD
+			if(!tz::geo::simd::constant_evaluated())
+			{
+				if constexpr(detail::simd_square<T, R, C, 4>)
+				{
+					Matrix<T, R, C> m{};
+					tz::geo::simd::mat4_transpose(this->data(), m.data());
+					return m;
+				}
+				else if constexpr(detail::simd_square<T, R, C, 3>)
+				{
+					Matrix<T, R, C> m{};
+					tz::geo::simd::mat3_transpose(this->data(), m.data());
+					return m;
+				}
+			}
+		#endif
+		return detail::generic_transpose(*this);
 	}
 
 	template<typename T, std::size_t R, std::size_t C>
-	//template<std::size_t X, std::size_t Y, typename std::enable_if_t<X == Y>>
-	Matrix<T, R, C> Matrix<T, R, C>::transpose() const
+	constexpr const T* Matrix<T, R, C>::data() const
 	{
-		Matrix<T, R, C> m = *this;
-		std::swap(m(0, 1), m(1, 0));
-		std::swap(m(0, 2), m(2, 0));
-		std::swap(m(1, 2), m(2, 1));
-		std::swap(m(0, 3), m(3, 0));
-		std::swap(m(1, 3), m(3, 1));
-		std::swap(m(2, 3), m(3, 2));
-		return m;
+		return this->mat[0].data();
+	}
+
+	template<typename T, std::size_t R, std::size_t C>
+	constexpr T* Matrix<T, R, C>::data()
+	{
+		return this->mat[0].data();
 	}
 
 	#if TOPAZ_DEBUG
@@ -392,4 +268,221 @@ namespace tz
 		std::printf("\n");
 	}
 	#endif
+
+	namespace detail
+	{
+		template<typename T, std::size_t R, std::size_t C>
+		constexpr Matrix<T, R, C> generic_multiply(const Matrix<T, R, C>& lhs, const Matrix<T, R, C>& rhs)
+		{
+			Matrix<T, R, C> res{};
+			for(std::size_t i = 0; i < R; i++)
+			{
+				for(std::size_t j = 0; j < C; j++)
+				{
+					T res_ele = T();
+					for(std::size_t k = 0; k < C; k++)
+					{
+						res_ele += (lhs(i, k) * rhs(k, j));
+					}
+					res(i, j) = res_ele;
+				}
+			}
+			return res;
+		}
+
+		template<typename T, std::size_t R, std::size_t C>
+		constexpr Vector<T, R> generic_multiply(const Matrix<T, R, C>& lhs, const Vector<T, C>& rhs)
+		{
+			Vector<T, R> ret{};
+			for(std::size_t i = 0; i < R; i++)
+			{
+				ret[i] = Vector<T, C>{lhs[i]}.dot(rhs);
+			}
+			return ret;
+		}
+
+		template<typename T, std::size_t R, std::size_t C>
+		constexpr Matrix<T, R, C> generic_transpose(const Matrix<T, R, C>& m)
+		{
+			Matrix<T, R, C> t{};
+			for(std::size_t i = 0; i < R; i++)
+			{
+				for(std::size_t j = 0; j < C; j++)
+				{
+					t(j, i) = m(i, j);
+				}
+			}
+			return t;
+		}
+
+		template<typename T, std::size_t R, std::size_t C>
+		Matrix<T, R, C> generic_inverse(const Matrix<T, R, C>& m)
+		{
+			static_assert(R == C && (R == 3 || R == 4), "tz::Matrix<T, R, C>::inverse(): Only 3x3 and 4x4 matrices can be inverted.");
+			if constexpr(R == 3)
+			{
+				// Cofactors, already transposed into the adjugate.
+				Matrix<T, R, C> inv;
+				inv(0, 0) = m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1);
+				inv(0, 1) = m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2);
+				inv(0, 2) = m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1);
+				inv(1, 0) = m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2);
+				inv(1, 1) = m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0);
+				inv(1, 2) = m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2);
+				inv(2, 0) = m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0);
+				inv(2, 1) = m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1);
+				inv(2, 2) = m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+				T determinant = m(0, 0) * inv(0, 0) + m(0, 1) * inv(1, 0) + m(0, 2) * inv(2, 0);
+				topaz_assert(determinant != 0, "tz::geo::Matrix<T, ", R, ", ", C, ">::inverse(): Cannot get inverse because determinant is zero.");
+				inv *= (T{1} / determinant);
+				return inv;
+			}
+			else
+			{
+				// Create copy of the current matrix to work with.
+				Matrix<T, R, C> inv = Matrix<T, R, C>::identity();
+				// TODO: Replace with Jacobi's Method.
+		
+				// Column-major
+				auto at = [](Matrix<T, R, C>& m, std::size_t idx)->T&
+				{
+					// 5 ==> (1, 1)
+					// row_id = 5 / 4 == 1
+					// column_id = (1*4)
+					std::size_t row_id = idx / C;
+					std::size_t column_id = idx - (row_id*C);
+					return m(row_id, column_id);
+				};
+
+				auto cat = [](const Matrix<T, R, C>& m, std::size_t idx)->const T&
+				{
+					// 5 ==> (1, 1)
+					// row_id = 5 / 4 == 1
+					// column_id = (1*4)
+					std::size_t row_id = idx / C;
+					std::size_t column_id = idx - (row_id*C);
+					return m(row_id, column_id);
+				};
+
+				at(inv, 0) = cat(m, 5) * cat(m, 10) * cat(m, 15) -
+						cat(m, 5) * cat(m, 11) * cat(m, 14) -
+						cat(m, 9) * cat(m, 6)  * cat(m, 15) +
+						cat(m, 9) * cat(m, 7)  * cat(m, 14) + 
+						cat(m, 13) * cat(m, 6) * cat(m, 11) - 
+						cat(m, 13) * cat(m, 7) * cat(m, 10);
+
+				at(inv, 4) = -cat(m, 4)  * cat(m, 10) * cat(m, 15) + 
+						cat(m, 4)  * cat(m, 11) * cat(m, 14) + 
+						cat(m, 8)  * cat(m, 6)  * cat(m, 15) - 
+						cat(m, 8)  * cat(m, 7)  * cat(m, 14) - 
+						cat(m, 12) * cat(m, 6)  * cat(m, 11) + 
+						cat(m, 12) * cat(m, 7)  * cat(m, 10);
+
+				at(inv, 8) = cat(m, 4)  * cat(m, 9) * cat(m, 15) - 
+						cat(m, 4)  * cat(m, 11) * cat(m, 13) - 
+						cat(m, 8)  * cat(m, 5) * cat(m, 15) + 
+						cat(m, 8)  * cat(m, 7) * cat(m, 13) + 
+						cat(m, 12) * cat(m, 5) * cat(m, 11) - 
+						cat(m, 12) * cat(m, 7) * cat(m, 9);
+
+				at(inv, 12) = -cat(m, 4)  * cat(m, 9) * cat(m, 14) + 
+						cat(m, 4)  * cat(m, 10) * cat(m, 13) +
+						cat(m, 8)  * cat(m, 5) * cat(m, 14) - 
+						cat(m, 8)  * cat(m, 6) * cat(m, 13) - 
+						cat(m, 12) * cat(m, 5) * cat(m, 10) + 
+						cat(m, 12) * cat(m, 6) * cat(m, 9);
+
+				at(inv, 1) = -cat(m, 1)  * cat(m, 10) * cat(m, 15) + 
+						cat(m, 1)  * cat(m, 11) * cat(m, 14) + 
+						cat(m, 9)  * cat(m, 2) * cat(m, 15) - 
+						cat(m, 9)  * cat(m, 3) * cat(m, 14) - 
+						cat(m, 13) * cat(m, 2) * cat(m, 11) + 
+						cat(m, 13) * cat(m, 3) * cat(m, 10);
+
+				at(inv, 5) = cat(m, 0)  * cat(m, 10) * cat(m, 15) - 
+						cat(m, 0)  * cat(m, 11) * cat(m, 14) - 
+						cat(m, 8)  * cat(m, 2) * cat(m, 15) + 
+						cat(m, 8)  * cat(m, 3) * cat(m, 14) + 
+						cat(m, 12) * cat(m, 2) * cat(m, 11) - 
+						cat(m, 12) * cat(m, 3) * cat(m, 10);
+
+				at(inv, 9) = -cat(m, 0)  * cat(m, 9) * cat(m, 15) + 
+						cat(m, 0)  * cat(m, 11) * cat(m, 13) + 
+						cat(m, 8)  * cat(m, 1) * cat(m, 15) - 
+						cat(m, 8)  * cat(m, 3) * cat(m, 13) - 
+						cat(m, 12) * cat(m, 1) * cat(m, 11) + 
+						cat(m, 12) * cat(m, 3) * cat(m, 9);
+
+				at(inv, 13) = cat(m, 0)  * cat(m, 9) * cat(m, 14) - 
+						cat(m, 0)  * cat(m, 10) * cat(m, 13) - 
+						cat(m, 8)  * cat(m, 1) * cat(m, 14) + 
+						cat(m, 8)  * cat(m, 2) * cat(m, 13) + 
+						cat(m, 12) * cat(m, 1) * cat(m, 10) - 
+						cat(m, 12) * cat(m, 2) * cat(m, 9);
+
+				at(inv, 2) = cat(m, 1)  * cat(m, 6) * cat(m, 15) - 
+						cat(m, 1)  * cat(m, 7) * cat(m, 14) - 
+						cat(m, 5)  * cat(m, 2) * cat(m, 15) + 
+						cat(m, 5)  * cat(m, 3) * cat(m, 14) + 
+						cat(m, 13) * cat(m, 2) * cat(m, 7) - 
+						cat(m, 13) * cat(m, 3) * cat(m, 6);
+
+				at(inv, 6) = -cat(m, 0)  * cat(m, 6) * cat(m, 15) + 
+						cat(m, 0)  * cat(m, 7) * cat(m, 14) + 
+						cat(m, 4)  * cat(m, 2) * cat(m, 15) - 
+						cat(m, 4)  * cat(m, 3) * cat(m, 14) - 
+						cat(m, 12) * cat(m, 2) * cat(m, 7) + 
+						cat(m, 12) * cat(m, 3) * cat(m, 6);
+
+				at(inv, 10) = cat(m, 0)  * cat(m, 5) * cat(m, 15) - 
+						cat(m, 0)  * cat(m, 7) * cat(m, 13) - 
+						cat(m, 4)  * cat(m, 1) * cat(m, 15) + 
+						cat(m, 4)  * cat(m, 3) * cat(m, 13) + 
+						cat(m, 12) * cat(m, 1) * cat(m, 7) - 
+						cat(m, 12) * cat(m, 3) * cat(m, 5);
+
+				at(inv, 14) = -cat(m, 0)  * cat(m, 5) * cat(m, 14) + 
+						cat(m, 0)  * cat(m, 6) * cat(m, 13) + 
+						cat(m, 4)  * cat(m, 1) * cat(m, 14) - 
+						cat(m, 4)  * cat(m, 2) * cat(m, 13) - 
+						cat(m, 12) * cat(m, 1) * cat(m, 6) + 
+						cat(m, 12) * cat(m, 2) * cat(m, 5);
+
+				at(inv, 3) = -cat(m, 1) * cat(m, 6) * cat(m, 11) + 
+						cat(m, 1) * cat(m, 7) * cat(m, 10) + 
+						cat(m, 5) * cat(m, 2) * cat(m, 11) - 
+						cat(m, 5) * cat(m, 3) * cat(m, 10) - 
+						cat(m, 9) * cat(m, 2) * cat(m, 7) + 
+						cat(m, 9) * cat(m, 3) * cat(m, 6);
+
+				at(inv, 7) = cat(m, 0) * cat(m, 6) * cat(m, 11) - 
+						cat(m, 0) * cat(m, 7) * cat(m, 10) - 
+						cat(m, 4) * cat(m, 2) * cat(m, 11) + 
+						cat(m, 4) * cat(m, 3) * cat(m, 10) + 
+						cat(m, 8) * cat(m, 2) * cat(m, 7) - 
+						cat(m, 8) * cat(m, 3) * cat(m, 6);
+
+				at(inv, 11) = -cat(m, 0) * cat(m, 5) * cat(m, 11) + 
+						cat(m, 0) * cat(m, 7) * cat(m, 9) + 
+						cat(m, 4) * cat(m, 1) * cat(m, 11) - 
+						cat(m, 4) * cat(m, 3) * cat(m, 9) - 
+						cat(m, 8) * cat(m, 1) * cat(m, 7) + 
+						cat(m, 8) * cat(m, 3) * cat(m, 5);
+
+				at(inv, 15) = cat(m, 0) * cat(m, 5) * cat(m, 10) - 
+						cat(m, 0) * cat(m, 6) * cat(m, 9) - 
+						cat(m, 4) * cat(m, 1) * cat(m, 10) + 
+						cat(m, 4) * cat(m, 2) * cat(m, 9) + 
+						cat(m, 8) * cat(m, 1) * cat(m, 6) - 
+						cat(m, 8) * cat(m, 2) * cat(m, 5);
+
+				float determinant = cat(m, 0) * cat(inv, 0) + cat(m, 1) * cat(inv, 4) + cat(m, 2) * cat(inv, 8) + cat(m, 3) * cat(inv, 12);
+				topaz_assert(determinant != 0, "tz::geo::Matrix<T, ", R, ", ", C, ">::inverse(): Cannot get inverse because determinant is zero.");
+				determinant = 1.0f / determinant;
+				for(std::size_t i = 0; i < 16; i++)
+					at(inv, i) = cat(inv, i) * determinant;
+				return inv;
+			}
+		}
+	}
 }
\ No newline at end of file
@@ -1,17 +1,11 @@
 #include "geo/matrix_transform.hpp"
+#include "core/debug/assert.hpp"
+#include "algo/job_system.hpp"
+#include <algorithm>
 #include <cmath>
 
 namespace tz::geo
 {
-	Mat4 translate(Vec3 position)
-	{
-		Mat4 m = Mat4::identity();
-		m(0, 3) = position[0];
-		m(1, 3) = position[1];
-		m(2, 3) = position[2];
-		return m;
-	}
-
 	// http://www.opengl-tutorial.org/assets/faq_quaternions/index.html#Q28
 	/*
 	Q28. How do I generate a rotation matrix in the X-axis?
@@ -86,16 +80,6 @@ namespace tz::geo
 		return r;
 	}
 
-	Mat4 scale(Vec3 scale)
-	{
-		Mat4 m = Mat4::identity();
-		for(std::size_t i = 0; i < 3; i++)
-		{
-			m(i, i) = scale[i];
-		}
-		return m;
-	}
-
 	Mat4 model(Vec3 position, Vec3 rotation, Vec3 scale)
 	{
 		return translate(position) * rotate(rotation) * tz::geo::scale(scale);
@@ -103,7 +87,7 @@ namespace tz::geo
 
 	Mat4 view(Vec3 position, Vec3 rotation)
 	{
-		return (translate(position) * rotate(rotation)).inverse();
+		return rigid_inverse(translate(position) * rotate(rotation));
 	}
 
 	Mat4 perspective(float fov, float aspect_ratio, float near, float far)
@@ -121,17 +105,270 @@ namespace tz::geo
 		return m;
 	}
 
-	Mat4 orthographic(float left, float right, float top, float bottom, float near, float far)
+	namespace
 	{
-		Mat4 m = Mat4::identity();
-		m(0, 0) = 2.0f / (right - left);
-		m(1, 1) = 2.0f / (top - bottom);
-		m(2, 2) = -2.0f / (far - near);
-
-		Mat4::Row& bottom_row = m[2];
-		bottom_row[0] = -(right + left) / (right - left);
-		bottom_row[1] = -(top + bottom) / (top - bottom);
-		bottom_row[2] = -(far + near) / (far - near);
-		return m;
+	#if TOPAZ_DEBUG
+		bool is_affine(const Mat4& m)
+		{
+			return m(3, 0) == 0.0f && m(3, 1) == 0.0f && m(3, 2) == 0.0f && m(3, 3) == 1.0f;
+		}
+
+		bool is_orthonormal(const Mat4& m)
+		{
+			constexpr float tolerance = 1e-3f;
+			for(std::size_t i = 0; i < 3; i++)
+			{
+				for(std::size_t j = 0; j < 3; j++)
+				{
+					float dot = m(0, i) * m(0, j) + m(1, i) * m(1, j) + m(2, i) * m(2, j);
+					if(std::abs(dot - (i == j ? 1.0f : 0.0f)) > tolerance)
+						return false;
+				}
+			}
+			return true;
+		}
+	#endif
+
+	#if !TOPAZ_GEO_SIMD
+		Mat3 upper_left(const Mat4& m)
+		{
+			Mat3 a;
+			for(std::size_t row = 0; row < 3; row++)
+			{
+				for(std::size_t col = 0; col < 3; col++)
+				{
+					a(row, col) = m(row, col);
+				}
+			}
+			return a;
+		}
+
+		/// |A^-1 -(A^-1)t|
+		/// |0    1       |
+		Mat4 inverse_with_translation(const Mat3& inverse_a, const Mat4& m)
+		{
+			Mat4 inv = Mat4::identity();
+			for(std::size_t row = 0; row < 3; row++)
+			{
+				float translation = 0.0f;
+				for(std::size_t col = 0; col < 3; col++)
+				{
+					inv(row, col) = inverse_a(row, col);
+					translation -= inverse_a(row, col) * m(col, 3);
+				}
+				inv(row, 3) = translation;
+			}
+			return inv;
+		}
+	#endif
+	}
+
+	Mat4 affine_inverse(const Mat4& affine)
+	{
+	#if TOPAZ_DEBUG
+		topaz_assert(is_affine(affine), "tz::geo::affine_inverse(...): Matrix is not affine. Its bottom row must be {0, 0, 0, 1}.");
+	#endif
+	#if TOPAZ_GEO_SIMD
+		Mat4 inv;
+		tz::geo::simd::mat4_affine_inverse(affine.data(), inv.data());
+		return inv;
+	#else
+		return inverse_with_translation(upper_left(affine).inverse(), affine);
+	#endif
+	}
+
+	Mat4 rigid_inverse(const Mat4& rigid)
+	{
+	#if TOPAZ_DEBUG
+		topaz_assert(is_affine(rigid) && is_orthonormal(rigid), "tz::geo::rigid_inverse(...): Matrix is not a rigid-body transform. Its bottom row must be {0, 0, 0, 1} and its upper-left 3x3 must be a pure rotation.");
+	#endif
+	#if TOPAZ_GEO_SIMD
+		Mat4 inv;
+		tz::geo::simd::mat4_rigid_inverse(rigid.data(), inv.data());
+		return inv;
+	#else
+		return inverse_with_translation(upper_left(rigid).transpose(), rigid);
+	#endif
+	}
+
+	Mat3 normal_matrix(const Mat4& model)
+	{
+	#if TOPAZ_GEO_SIMD
+		Mat3 normal;
+		tz::geo::simd::mat4_normal_matrix(model.data(), normal.data());
+		return normal;
+	#else
+		return upper_left(model).inverse().transpose();
+	#endif
+	}
+
+	namespace
+	{
+		// Batched kernels read and write these types as tightly-packed floats.
+		static_assert(sizeof(Vec3) == 3 * sizeof(float));
+		static_assert(sizeof(Quaternion) == 4 * sizeof(float));
+		static_assert(sizeof(Mat4) == 16 * sizeof(float));
+
+		constexpr std::size_t batch_width = 4;
+		// Below this many transforms per chunk, queueing the chunk costs more than it saves.
+		constexpr std::size_t min_transforms_per_chunk = 4096;
+		constexpr std::size_t chunks_per_thread = 4;
+
+		/// Rotation matrix r[row][col] equivalent to rotate(rotation), i.e rotate_z * rotate_y * rotate_x multiplied out.
+		void rotation_matrix(const Vec3& rotation, float r[3][3])
+		{
+			const float sa = std::sin(rotation[0]), ca = std::cos(rotation[0]);
+			const float sb = std::sin(rotation[1]), cb = std::cos(rotation[1]);
+			const float sc = std::sin(rotation[2]), cc = std::cos(rotation[2]);
+			r[0][0] = cb * cc; r[0][1] = sa * sb * cc - ca * sc; r[0][2] = ca * sb * cc + sa * sc;
+			r[1][0] = cb * sc; r[1][1] = sa * sb * sc + ca * cc; r[1][2] = ca * sb * sc - sa * cc;
+			r[2][0] = -sb;     r[2][1] = sa * cb;                r[2][2] = ca * cb;
+		}
+
+		/// Rotation matrix r[row][col] equivalent to Mat4{rotation}.
+		void rotation_matrix(const Quaternion& rotation, float r[3][3])
+		{
+			const float* q = rotation.data();
+			const float inverse_length = 1.0f / std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+			const float x = q[0] * inverse_length, y = q[1] * inverse_length, z = q[2] * inverse_length, w = q[3] * inverse_length;
+			r[0][0] = 1.0f - 2.0f * (y * y + z * z); r[0][1] = 2.0f * (x * y + z * w);        r[0][2] = 2.0f * (x * z - y * w);
+			r[1][0] = 2.0f * (x * y - z * w);        r[1][1] = 1.0f - 2.0f * (x * x + z * z); r[1][2] = 2.0f * (y * z + x * w);
+			r[2][0] = 2.0f * (x * z + y * w);        r[2][1] = 2.0f * (y * z - x * w);        r[2][2] = 1.0f - 2.0f * (x * x + y * y);
+		}
+
+		/// translate(position) * rotation * scale(scale) only ever scales the rotation columns and sets the translation column, so write that directly.
+		void write_model(const Vec3& position, const float r[3][3], const Vec3& scale, Mat4& out)
+		{
+			float* m = out.data();
+			for(std::size_t col = 0; col < 3; col++)
+			{
+				for(std::size_t row = 0; row < 3; row++)
+				{
+					m[col * 4 + row] = r[row][col] * scale[col];
+				}
+				m[col * 4 + 3] = 0.0f;
+			}
+			m[12] = position[0];
+			m[13] = position[1];
+			m[14] = position[2];
+			m[15] = 1.0f;
+		}
+
+	#if TOPAZ_GEO_SIMD
+		// Four-wide equivalents of the above. Each register holds the same matrix entry for four consecutive transforms.
+
+		void rotation_matrix4(const Vec3* rotations, __m128 r[3][3])
+		{
+			using namespace tz::geo::simd::detail;
+			__m128 a, b, c;
+			load_transpose3x4(rotations->data(), a, b, c);
+			__m128 sa, ca, sb, cb, sc, cc;
+			sincos(a, sa, ca);
+			sincos(b, sb, cb);
+			sincos(c, sc, cc);
+			const __m128 sa_sb = _mm_mul_ps(sa, sb);
+			const __m128 ca_sb = _mm_mul_ps(ca, sb);
+			r[0][0] = _mm_mul_ps(cb, cc);
+			r[0][1] = _mm_sub_ps(_mm_mul_ps(sa_sb, cc), _mm_mul_ps(ca, sc));
+			r[0][2] = _mm_add_ps(_mm_mul_ps(ca_sb, cc), _mm_mul_ps(sa, sc));
+			r[1][0] = _mm_mul_ps(cb, sc);
+			r[1][1] = _mm_add_ps(_mm_mul_ps(sa_sb, sc), _mm_mul_ps(ca, cc));
+			r[1][2] = _mm_sub_ps(_mm_mul_ps(ca_sb, sc), _mm_mul_ps(sa, cc));
+			r[2][0] = _mm_xor_ps(sb, _mm_set1_ps(-0.0f));
+			r[2][1] = _mm_mul_ps(sa, cb);
+			r[2][2] = _mm_mul_ps(ca, cb);
+		}
+
+		void rotation_matrix4(const Quaternion* rotations, __m128 r[3][3])
+		{
+			using namespace tz::geo::simd::detail;
+			__m128 x, y, z, w;
+			load_transpose4(rotations->data(), x, y, z, w);
+			normalise4(x, y, z, w);
+			quaternion_rotation4(x, y, z, w, r);
+		}
+
+		void write_model4(const Vec3* positions, __m128 r[3][3], const Vec3* scales, Mat4* out)
+		{
+			using namespace tz::geo::simd::detail;
+			__m128 scale[3];
+			load_transpose3x4(scales->data(), scale[0], scale[1], scale[2]);
+			for(std::size_t col = 0; col < 3; col++)
+			{
+				__m128 c0 = _mm_mul_ps(r[0][col], scale[col]);
+				__m128 c1 = _mm_mul_ps(r[1][col], scale[col]);
+				__m128 c2 = _mm_mul_ps(r[2][col], scale[col]);
+				__m128 c3 = _mm_setzero_ps();
+				_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+				_mm_storeu_ps(out[0].data() + col * 4, c0);
+				_mm_storeu_ps(out[1].data() + col * 4, c1);
+				_mm_storeu_ps(out[2].data() + col * 4, c2);
+				_mm_storeu_ps(out[3].data() + col * 4, c3);
+			}
+			__m128 px, py, pz;
+			load_transpose3x4(positions->data(), px, py, pz);
+			__m128 pw = _mm_set1_ps(1.0f);
+			_MM_TRANSPOSE4_PS(px, py, pz, pw);
+			_mm_storeu_ps(out[0].data() + 12, px);
+			_mm_storeu_ps(out[1].data() + 12, py);
+			_mm_storeu_ps(out[2].data() + 12, pz);
+			_mm_storeu_ps(out[3].data() + 12, pw);
+		}
+	#endif
+
+		template<typename Rotation>
+		void model_range(const Vec3* positions, const Rotation* rotations, const Vec3* scales, Mat4* out, std::size_t count)
+		{
+			std::size_t i = 0;
+		#if TOPAZ_GEO_SIMD
+			for(; i + batch_width <= count; i += batch_width)
+			{
+				__m128 r[3][3];
+				rotation_matrix4(rotations + i, r);
+				write_model4(positions + i, r, scales + i, out + i);
+			}
+		#endif
+			for(; i < count; i++)
+			{
+				float r[3][3];
+				rotation_matrix(rotations[i], r);
+				write_model(positions[i], r, scales[i], out[i]);
+			}
+		}
+
+		template<typename Rotation>
+		void model_batch_impl(tz::mem::Span<const Vec3> positions, tz::mem::Span<const Rotation> rotations, tz::mem::Span<const Vec3> scales, tz::mem::Span<Mat4> out, tz::algo::JobSystem* job_system)
+		{
+			const std::size_t count = out.size();
+			topaz_assert(positions.size() == count && rotations.size() == count && scales.size() == count, "tz::geo::model_batch(...): Span sizes do not match. Positions: ", positions.size(), ", Rotations: ", rotations.size(), ", Scales: ", scales.size(), ", Output: ", count);
+			if(positions.size() != count || rotations.size() != count || scales.size() != count)
+				return;
+			std::size_t chunk_count = 1;
+			if(job_system != nullptr && job_system->worker_count() > 0)
+				chunk_count = std::clamp<std::size_t>(count / min_transforms_per_chunk, 1, (job_system->worker_count() + 1) * chunks_per_thread);
+			if(chunk_count == 1)
+			{
+				model_range(positions.data(), rotations.data(), scales.data(), out.data(), count);
+				return;
+			}
+			// Chunks are a multiple of the batch width so that only the final chunk has a scalar tail.
+			const std::size_t chunk = ((count / chunk_count) + batch_width - 1) / batch_width * batch_width;
+			chunk_count = (count + chunk - 1) / chunk;
+			job_system->wait(job_system->parallel_for(0, chunk_count, 1, [=](std::size_t c)
+			{
+				const std::size_t begin = c * chunk;
+				model_range(positions.data() + begin, rotations.data() + begin, scales.data() + begin, out.data() + begin, std::min(chunk, count - begin));
+			}));
+		}
+	}
+
+	void model_batch(tz::mem::Span<const Vec3> positions, tz::mem::Span<const Vec3> rotations, tz::mem::Span<const Vec3> scales, tz::mem::Span<Mat4> out, tz::algo::JobSystem* job_system)
+	{
+		model_batch_impl(positions, rotations, scales, out, job_system);
+	}
+
+	void model_batch(tz::mem::Span<const Vec3> positions, tz::mem::Span<const Quaternion> rotations, tz::mem::Span<const Vec3> scales, tz::mem::Span<Mat4> out, tz::algo::JobSystem* job_system)
+	{
+		model_batch_impl(positions, rotations, scales, out, job_system);
 	}
 }
\ No newline at end of file
@@ -6,6 +6,13 @@
 #define TOPAZ_GEO_MATRIX_TRANSFORM_HPP
 #include "geo/matrix.hpp"
 #include "geo/vector.hpp"
+#include "geo/quaternion.hpp"
+#include "memory/span.hpp"
+
+namespace tz::algo
+{
+	class JobSystem;
+}
 
 namespace tz::geo
 {
@@ -21,14 +28,64 @@ namespace tz::geo
 	 * @{
 	 */
 
-	Mat4 translate(Vec3 position);
+	/*
+	 * translate, scale and orthographic are constexpr, so fixed matrices (such as a shadow-map projection or bias matrix) can be computed at compile-time.
+	 */
+
+	constexpr Mat4 translate(Vec3 position);
 	Mat4 rotate(Vec3 rotation);
-	Mat4 scale(Vec3 scale);
+	constexpr Mat4 scale(Vec3 scale);
 
 	Mat4 model(Vec3 position, Vec3 rotation, Vec3 scale);
 	Mat4 view(Vec3 position, Vec3 rotation);
 	Mat4 perspective(float fov, float aspect_ratio, float near, float far);
-	Mat4 orthographic(float left, float right, float top, float bottom, float near, float far);
+	constexpr Mat4 orthographic(float left, float right, float top, float bottom, float near, float far);
+
+	/**
+	 * Invert an affine matrix, such as a model matrix. This is considerably cheaper than Mat4::inverse(), as only the upper-left 3x3 needs inverting.
+	 * Precondition: The bottom row of the matrix is (0, 0, 0, 1). Otherwise, this will assert and invoke UB.
+	 * Note: If the upper-left 3x3 is singular (e.g a zero scale), the result will contain infinities or NaNs.
+	 * @param affine Affine matrix to invert.
+	 * @return Inverse of the matrix.
+	 */
+	Mat4 affine_inverse(const Mat4& affine);
+	/**
+	 * Invert a rigid-body matrix, comprising only a rotation and translation (such as translate(p) * rotate(r)). This is cheaper still than affine_inverse, as the rotation is merely transposed.
+	 * Precondition: The bottom row of the matrix is (0, 0, 0, 1) and the upper-left 3x3 is orthonormal. Otherwise, this will assert and invoke UB.
+	 * @param rigid Rigid-body matrix to invert.
+	 * @return Inverse of the matrix.
+	 */
+	Mat4 rigid_inverse(const Mat4& rigid);
+	/**
+	 * Compute the matrix which correctly transforms normals by the given model matrix. This is the inverse-transpose of the upper-left 3x3, so non-uniform scales are handled properly.
+	 * Note: If the upper-left 3x3 is singular, the result will contain infinities or NaNs.
+	 * @param model Matrix which transforms positions.
+	 * @return Normal matrix.
+	 */
+	Mat3 normal_matrix(const Mat4& model);
+
+	/**
+	 * Compute a model matrix for every transform in a batch, such that out[i] == model(positions[i], rotations[i], scales[i]) up to floating-point error.
+	 * Inputs are structure-of-arrays, which is exactly what tz::mem::SoAPool<Vec3, Vec3, Vec3>::get<I>() provides. The destination may be any contiguous range of Mat4s, including a tz::mem::UniformPool<Mat4> over a persistently-mapped buffer.
+	 * Precondition: All spans have the same size. Otherwise, this will assert and invoke UB.
+	 * Note: Transforms are processed four at a time using SIMD where available (see tz::geo::simd::enabled).
+	 * @param positions Translation of each transform.
+	 * @param rotations Euler-angle rotation of each transform, in radians. These are applied in the same order as rotate(Vec3).
+	 * @param scales Scale of each transform.
+	 * @param out Destination of each model matrix. Must not overlap any of the inputs.
+	 * @param job_system If non-null, large batches are split across its workers. Small batches are always processed on the calling thread, as splitting them would cost more than it saves.
+	 */
+	void model_batch(tz::mem::Span<const Vec3> positions, tz::mem::Span<const Vec3> rotations, tz::mem::Span<const Vec3> scales, tz::mem::Span<Mat4> out, tz::algo::JobSystem* job_system = nullptr);
+	/**
+	 * Compute a model matrix for every transform in a batch, such that out[i] == translate(positions[i]) * Mat4{rotations[i]} * scale(scales[i]) up to floating-point error.
+	 * Precondition: All spans have the same size. Otherwise, this will assert and invoke UB.
+	 * @param positions Translation of each transform.
+	 * @param rotations Rotation of each transform. These need not be normalised.
+	 * @param scales Scale of each transform.
+	 * @param out Destination of each model matrix. Must not overlap any of the inputs.
+	 * @param job_system If non-null, large batches are split across its workers.
+	 */
+	void model_batch(tz::mem::Span<const Vec3> positions, tz::mem::Span<const Quaternion> rotations, tz::mem::Span<const Vec3> scales, tz::mem::Span<Mat4> out, tz::algo::JobSystem* job_system = nullptr);
 
 	/**
 	 * @}
@@ -38,4 +95,5 @@ namespace tz::geo
 	 */
 }
 
+#include "geo/matrix_transform.inl"
 #endif // TOPAZ_GEO_MATRIX_TRANSFORM_HPP
\ No newline at end of file
@@ -0,0 +1,35 @@
+namespace tz::geo
+{
+	constexpr Mat4 translate(Vec3 position)
+	{
+		Mat4 m = Mat4::identity();
+		m(0, 3) = position[0];
+		m(1, 3) = position[1];
+		m(2, 3) = position[2];
+		return m;
+	}
+
+	constexpr Mat4 scale(Vec3 scale)
+	{
+		Mat4 m = Mat4::identity();
+		for(std::size_t i = 0; i < 3; i++)
+		{
+			m(i, i) = scale[i];
+		}
+		return m;
+	}
+
+	constexpr Mat4 orthographic(float left, float right, float top, float bottom, float near, float far)
+	{
+		Mat4 m = Mat4::identity();
+		m(0, 0) = 2.0f / (right - left);
+		m(1, 1) = 2.0f / (top - bottom);
+		m(2, 2) = -2.0f / (far - near);
+
+		Mat4::Row& bottom_row = m[2];
+		bottom_row[0] = -(right + left) / (right - left);
+		bottom_row[1] = -(top + bottom) / (top - bottom);
+		bottom_row[2] = -(far + near) / (far - near);
+		return m;
+	}
+}
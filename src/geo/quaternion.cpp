@@ -91,6 +91,15 @@ namespace tz
 		return mat;
 	}
 
+	tz::Vec3 Quaternion::rotate(const tz::Vec3& vector) const
+	{
+		// v' = v + w * t + cross(q.xyz, t), where t = 2 * cross(q.xyz, v)
+		const Quaternion& q = *this;
+		const tz::Vec3 u{{q[0], q[1], q[2]}};
+		const tz::Vec3 t = tz::cross(u, vector) * 2.0f;
+		return vector + (t * q[3]) + tz::cross(u, t);
+	}
+
 	Quaternion& Quaternion::operator*=(const Quaternion& rhs)
 	{
 		Quaternion res = *this * rhs;
@@ -231,6 +240,35 @@ namespace tz
 		return static_cast<tz::Mat4>(*this);
 	}
 
+	/*static*/ Quaternion Quaternion::nlerp(const Quaternion& from, const Quaternion& to, float t)
+	{
+		// q and -q represent the same rotation. Flip one if necessary so that we interpolate along the shorter arc.
+		const float to_sign = from.dot(to) < 0.0f ? -1.0f : 1.0f;
+		const float a = 1.0f - t;
+		const float b = t * to_sign;
+		Quaternion res{(from[0] * a) + (to[0] * b), (from[1] * a) + (to[1] * b), (from[2] * a) + (to[2] * b), (from[3] * a) + (to[3] * b)};
+		res.normalise();
+		return res;
+	}
+
+	/*static*/ Quaternion Quaternion::slerp(const Quaternion& from, const Quaternion& to, float t)
+	{
+		float cos_angle = from.dot(to);
+		const float to_sign = cos_angle < 0.0f ? -1.0f : 1.0f;
+		cos_angle *= to_sign;
+		if(cos_angle > Quaternion::slerp_threshold)
+		{
+			return Quaternion::nlerp(from, to, t);
+		}
+		const float angle = std::acos(cos_angle);
+		const float inverse_sin_angle = 1.0f / std::sqrt(1.0f - (cos_angle * cos_angle));
+		const float a = std::sin((1.0f - t) * angle) * inverse_sin_angle;
+		const float b = std::sin(t * angle) * inverse_sin_angle * to_sign;
+		Quaternion res{(from[0] * a) + (to[0] * b), (from[1] * a) + (to[1] * b), (from[2] * a) + (to[2] * b), (from[3] * a) + (to[3] * b)};
+		res.normalise();
+		return res;
+	}
+
 	Quaternion::Quaternion(float x, float y, float z, float w): tz::Vec4{{{x, y, z, w}}}{}
 
 	/*static*/ void Quaternion::swap(Quaternion& lhs, Quaternion& rhs)
@@ -47,6 +47,13 @@ namespace tz
 		 * @return Rotation matrix representing identical transformation to this quaternion.
 		 */
 		explicit operator tz::Mat4() const;
+		/**
+		 * Rotate a vector by this quaternion. This is equivalent to (but much cheaper than) multiplying the vector by to_matrix().
+		 * Precondition: This quaternion is normalised. Otherwise, the result is also scaled.
+		 * @param vector Vector to rotate.
+		 * @return Rotated vector.
+		 */
+		tz::Vec3 rotate(const tz::Vec3& vector) const;
 
 		Quaternion& operator*=(const Quaternion& rhs);
 		Quaternion operator*(const Quaternion& rhs) const;
@@ -61,6 +68,31 @@ namespace tz
 
 		static Quaternion from_matrix(tz::Mat4 rotation);
 		tz::Mat4 to_matrix() const;
+
+		/**
+		 * Normalised linear interpolation between two rotations. This always takes the shortest path, but does not move at a constant angular velocity. For small angles (e.g animation blending between nearby keyframes), it is indistinguishable from slerp and much cheaper.
+		 * @param from Rotation at t == 0.
+		 * @param to Rotation at t == 1.
+		 * @param t Interpolation factor, typically within [0, 1].
+		 * @return Normalised interpolated rotation.
+		 */
+		static Quaternion nlerp(const Quaternion& from, const Quaternion& to, float t);
+		/**
+		 * Spherical linear interpolation between two rotations. This takes the shortest path at a constant angular velocity.
+		 * Note: If the rotations are almost identical, this falls back to nlerp to avoid dividing by a vanishing sine.
+		 * @param from Normalised rotation at t == 0.
+		 * @param to Normalised rotation at t == 1.
+		 * @param t Interpolation factor, typically within [0, 1].
+		 * @return Normalised interpolated rotation.
+		 */
+		static Quaternion slerp(const Quaternion& from, const Quaternion& to, float t);
+		/// Cosine of the angle between two quaternions above which slerp falls back to nlerp.
+		static constexpr float slerp_threshold = 0.9995f;
+		/**
+		 * Retrieve a pointer to the underlying components, in the order x, y, z, w.
+		 * Note: Quaternions are tightly packed, so a contiguous range of Quaternions can be treated as 4 floats each.
+		 */
+		using tz::Vec4::data;
 	private:
 		Quaternion(float x, float y, float z, float w);
 		static void swap(Quaternion& lhs, Quaternion& rhs);
@@ -0,0 +1,239 @@
+#include "geo/quaternion_batch.hpp"
+#include "core/debug/assert.hpp"
+
+namespace tz::geo
+{
+	namespace
+	{
+		// Batched kernels read and write these types as tightly-packed floats.
+		static_assert(sizeof(Vec3) == 3 * sizeof(float));
+		static_assert(sizeof(Quaternion) == 4 * sizeof(float));
+		static_assert(sizeof(Mat4) == 16 * sizeof(float));
+
+		constexpr std::size_t batch_width = 4;
+
+		/// Interpolation factors, either one per element or a single factor shared by all of them.
+		struct Weights
+		{
+			const float* data;
+			bool uniform;
+
+			float at(std::size_t i) const
+			{
+				return this->uniform ? this->data[0] : this->data[i];
+			}
+		#if TOPAZ_GEO_SIMD
+			__m128 at4(std::size_t i) const
+			{
+				return this->uniform ? _mm_set1_ps(this->data[0]) : _mm_loadu_ps(this->data + i);
+			}
+		#endif
+		};
+
+		enum class Interpolation
+		{
+			Linear,
+			Spherical
+		};
+
+		template<Interpolation I>
+		void interpolate_batch(tz::mem::Span<const Quaternion> from, tz::mem::Span<const Quaternion> to, Weights t, std::size_t weight_count, tz::mem::Span<Quaternion> out)
+		{
+			const std::size_t count = out.size();
+			topaz_assert(from.size() == count && to.size() == count && (t.uniform || weight_count == count), "tz::geo::", I == Interpolation::Linear ? "nlerp" : "slerp", "_batch(...): Span sizes do not match. From: ", from.size(), ", To: ", to.size(), ", Factors: ", weight_count, ", Output: ", count);
+			if(from.size() != count || to.size() != count || (!t.uniform && weight_count != count))
+				return;
+			std::size_t i = 0;
+		#if TOPAZ_GEO_SIMD
+			using namespace tz::geo::simd::detail;
+			const __m128 sign_bit = _mm_set1_ps(-0.0f);
+			const __m128 one = _mm_set1_ps(1.0f);
+			for(; i + batch_width <= count; i += batch_width)
+			{
+				__m128 ix, iy, iz, iw, ox, oy, oz, ow;
+				load_transpose4(from[i].data(), ix, iy, iz, iw);
+				load_transpose4(to[i].data(), ox, oy, oz, ow);
+				__m128 cos_angle = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ix, ox), _mm_mul_ps(iy, oy)), _mm_add_ps(_mm_mul_ps(iz, oz), _mm_mul_ps(iw, ow)));
+				// Flip 'to' wherever the dot product is negative, so that we interpolate along the shorter arc.
+				const __m128 to_sign = _mm_and_ps(cos_angle, sign_bit);
+				cos_angle = _mm_xor_ps(cos_angle, to_sign);
+				const __m128 weight = t.at4(i);
+				__m128 from_weight = _mm_sub_ps(one, weight);
+				__m128 to_weight = weight;
+				if constexpr(I == Interpolation::Spherical)
+				{
+					// Lanes which are almost identical keep the nlerp weights above.
+					const __m128 spherical = _mm_cmple_ps(cos_angle, _mm_set1_ps(Quaternion::slerp_threshold));
+					if(_mm_movemask_ps(spherical) != 0)
+					{
+						const __m128 angle = acos(_mm_min_ps(cos_angle, one));
+						const __m128 inverse_sin_angle = _mm_div_ps(one, _mm_sqrt_ps(_mm_sub_ps(one, _mm_mul_ps(cos_angle, cos_angle))));
+						__m128 sin_a, sin_b, unused;
+						sincos(_mm_mul_ps(from_weight, angle), sin_a, unused);
+						sincos(_mm_mul_ps(to_weight, angle), sin_b, unused);
+						from_weight = _mm_or_ps(_mm_and_ps(spherical, _mm_mul_ps(sin_a, inverse_sin_angle)), _mm_andnot_ps(spherical, from_weight));
+						to_weight = _mm_or_ps(_mm_and_ps(spherical, _mm_mul_ps(sin_b, inverse_sin_angle)), _mm_andnot_ps(spherical, to_weight));
+					}
+				}
+				to_weight = _mm_xor_ps(to_weight, to_sign);
+				__m128 x = _mm_add_ps(_mm_mul_ps(ix, from_weight), _mm_mul_ps(ox, to_weight));
+				__m128 y = _mm_add_ps(_mm_mul_ps(iy, from_weight), _mm_mul_ps(oy, to_weight));
+				__m128 z = _mm_add_ps(_mm_mul_ps(iz, from_weight), _mm_mul_ps(oz, to_weight));
+				__m128 w = _mm_add_ps(_mm_mul_ps(iw, from_weight), _mm_mul_ps(ow, to_weight));
+				normalise4(x, y, z, w);
+				store_transpose4(out[i].data(), x, y, z, w);
+			}
+		#endif
+			for(; i < count; i++)
+			{
+				if constexpr(I == Interpolation::Linear)
+				{
+					out[i] = Quaternion::nlerp(from[i], to[i], t.at(i));
+				}
+				else
+				{
+					out[i] = Quaternion::slerp(from[i], to[i], t.at(i));
+				}
+			}
+		}
+	}
+
+	void multiply_batch(tz::mem::Span<const Quaternion> lhs, tz::mem::Span<const Quaternion> rhs, tz::mem::Span<Quaternion> out)
+	{
+		const std::size_t count = out.size();
+		topaz_assert(lhs.size() == count && rhs.size() == count, "tz::geo::multiply_batch(...): Span sizes do not match. Lhs: ", lhs.size(), ", Rhs: ", rhs.size(), ", Output: ", count);
+		if(lhs.size() != count || rhs.size() != count)
+			return;
+		std::size_t i = 0;
+	#if TOPAZ_GEO_SIMD
+		using namespace tz::geo::simd::detail;
+		for(; i + batch_width <= count; i += batch_width)
+		{
+			__m128 x1, y1, z1, w1, x2, y2, z2, w2;
+			load_transpose4(lhs[i].data(), x1, y1, z1, w1);
+			load_transpose4(rhs[i].data(), x2, y2, z2, w2);
+			// Hamilton product, exactly as Quaternion::operator*.
+			const __m128 x = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(w1, x2), _mm_mul_ps(x1, w2)), _mm_mul_ps(y1, z2)), _mm_mul_ps(z1, y2));
+			const __m128 y = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(w1, y2), _mm_mul_ps(y1, w2)), _mm_mul_ps(z1, x2)), _mm_mul_ps(x1, z2));
+			const __m128 z = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(w1, z2), _mm_mul_ps(z1, w2)), _mm_mul_ps(x1, y2)), _mm_mul_ps(y1, x2));
+			const __m128 w = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(w1, w2), _mm_mul_ps(x1, x2)), _mm_mul_ps(y1, y2)), _mm_mul_ps(z1, z2));
+			store_transpose4(out[i].data(), x, y, z, w);
+		}
+	#endif
+		for(; i < count; i++)
+		{
+			out[i] = lhs[i] * rhs[i];
+		}
+	}
+
+	void normalise_batch(tz::mem::Span<Quaternion> quaternions)
+	{
+		const std::size_t count = quaternions.size();
+		std::size_t i = 0;
+	#if TOPAZ_GEO_SIMD
+		using namespace tz::geo::simd::detail;
+		for(; i + batch_width <= count; i += batch_width)
+		{
+			__m128 x, y, z, w;
+			load_transpose4(quaternions[i].data(), x, y, z, w);
+			normalise4(x, y, z, w);
+			store_transpose4(quaternions[i].data(), x, y, z, w);
+		}
+	#endif
+		for(; i < count; i++)
+		{
+			quaternions[i].normalise();
+		}
+	}
+
+	void nlerp_batch(tz::mem::Span<const Quaternion> from, tz::mem::Span<const Quaternion> to, tz::mem::Span<const float> t, tz::mem::Span<Quaternion> out)
+	{
+		interpolate_batch<Interpolation::Linear>(from, to, {t.data(), false}, t.size(), out);
+	}
+
+	void nlerp_batch(tz::mem::Span<const Quaternion> from, tz::mem::Span<const Quaternion> to, float t, tz::mem::Span<Quaternion> out)
+	{
+		interpolate_batch<Interpolation::Linear>(from, to, {&t, true}, 1, out);
+	}
+
+	void slerp_batch(tz::mem::Span<const Quaternion> from, tz::mem::Span<const Quaternion> to, tz::mem::Span<const float> t, tz::mem::Span<Quaternion> out)
+	{
+		interpolate_batch<Interpolation::Spherical>(from, to, {t.data(), false}, t.size(), out);
+	}
+
+	void slerp_batch(tz::mem::Span<const Quaternion> from, tz::mem::Span<const Quaternion> to, float t, tz::mem::Span<Quaternion> out)
+	{
+		interpolate_batch<Interpolation::Spherical>(from, to, {&t, true}, 1, out);
+	}
+
+	void rotate_batch(tz::mem::Span<const Quaternion> rotations, tz::mem::Span<const Vec3> vectors, tz::mem::Span<Vec3> out)
+	{
+		const std::size_t count = out.size();
+		topaz_assert(rotations.size() == count && vectors.size() == count, "tz::geo::rotate_batch(...): Span sizes do not match. Rotations: ", rotations.size(), ", Vectors: ", vectors.size(), ", Output: ", count);
+		if(rotations.size() != count || vectors.size() != count)
+			return;
+		std::size_t i = 0;
+	#if TOPAZ_GEO_SIMD
+		using namespace tz::geo::simd::detail;
+		const __m128 two = _mm_set1_ps(2.0f);
+		for(; i + batch_width <= count; i += batch_width)
+		{
+			__m128 qx, qy, qz, qw, vx, vy, vz;
+			load_transpose4(rotations[i].data(), qx, qy, qz, qw);
+			load_transpose3x4(vectors[i].data(), vx, vy, vz);
+			// c = 2 * cross(q.xyz, v)
+			const __m128 cx = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qy, vz), _mm_mul_ps(qz, vy)));
+			const __m128 cy = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qz, vx), _mm_mul_ps(qx, vz)));
+			const __m128 cz = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qx, vy), _mm_mul_ps(qy, vx)));
+			// v' = v + w * c + cross(q.xyz, c)
+			vx = _mm_add_ps(_mm_add_ps(vx, _mm_mul_ps(qw, cx)), _mm_sub_ps(_mm_mul_ps(qy, cz), _mm_mul_ps(qz, cy)));
+			vy = _mm_add_ps(_mm_add_ps(vy, _mm_mul_ps(qw, cy)), _mm_sub_ps(_mm_mul_ps(qz, cx), _mm_mul_ps(qx, cz)));
+			vz = _mm_add_ps(_mm_add_ps(vz, _mm_mul_ps(qw, cz)), _mm_sub_ps(_mm_mul_ps(qx, cy), _mm_mul_ps(qy, cx)));
+			store_transpose3x4(out[i].data(), vx, vy, vz);
+		}
+	#endif
+		for(; i < count; i++)
+		{
+			out[i] = rotations[i].rotate(vectors[i]);
+		}
+	}
+
+	void to_matrix_batch(tz::mem::Span<const Quaternion> rotations, tz::mem::Span<Mat4> out)
+	{
+		const std::size_t count = out.size();
+		topaz_assert(rotations.size() == count, "tz::geo::to_matrix_batch(...): Span sizes do not match. Rotations: ", rotations.size(), ", Output: ", count);
+		if(rotations.size() != count)
+			return;
+		std::size_t i = 0;
+	#if TOPAZ_GEO_SIMD
+		using namespace tz::geo::simd::detail;
+		const __m128 identity_column = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+		for(; i + batch_width <= count; i += batch_width)
+		{
+			__m128 x, y, z, w;
+			load_transpose4(rotations[i].data(), x, y, z, w);
+			normalise4(x, y, z, w);
+			__m128 r[3][3];
+			quaternion_rotation4(x, y, z, w, r);
+			for(std::size_t col = 0; col < 3; col++)
+			{
+				// Transpose back so that each register holds one column of one matrix. The fourth row is always zero.
+				__m128 c0 = r[0][col], c1 = r[1][col], c2 = r[2][col], c3 = _mm_setzero_ps();
+				_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+				_mm_storeu_ps(out[i + 0].data() + col * 4, c0);
+				_mm_storeu_ps(out[i + 1].data() + col * 4, c1);
+				_mm_storeu_ps(out[i + 2].data() + col * 4, c2);
+				_mm_storeu_ps(out[i + 3].data() + col * 4, c3);
+			}
+			for(std::size_t j = 0; j < batch_width; j++)
+			{
+				_mm_storeu_ps(out[i + j].data() + 12, identity_column);
+			}
+		}
+	#endif
+		for(; i < count; i++)
+		{
+			out[i] = rotations[i].to_matrix();
+		}
+	}
+}
@@ -0,0 +1,81 @@
+#ifndef TOPAZ_GEO_QUATERNION_BATCH_HPP
+#define TOPAZ_GEO_QUATERNION_BATCH_HPP
+#include "geo/quaternion.hpp"
+#include "memory/span.hpp"
+
+namespace tz::geo
+{
+	/**
+	 * \addtogroup tz_geo Topaz Geometry Library (tz::geo)
+	 * A collection of geometric data structures and mathematical types, such as vectors and matrices.
+	 * @{
+	 */
+
+	/**
+	 * \addtogroup tz_geo_quat_batch tz::geo Batched Quaternion Module
+	 * Quaternion operations over whole ranges at once, such as every bone of every animated skeleton in a frame.
+	 * Each is equivalent to calling the corresponding tz::Quaternion member for every element, up to floating-point error. Elements are processed four at a time using SIMD where available (see tz::geo::simd::enabled), by transposing them into structure-of-arrays registers.
+	 * Unless otherwise stated, all spans must have the same size (otherwise this will assert and do nothing), and the output may be the same span as any of the inputs.
+	 * @{
+	 */
+
+	/**
+	 * Compose rotations: out[i] = lhs[i] * rhs[i].
+	 * @param lhs Left-hand rotations.
+	 * @param rhs Right-hand rotations.
+	 * @param out Destination of each product.
+	 */
+	void multiply_batch(tz::mem::Span<const Quaternion> lhs, tz::mem::Span<const Quaternion> rhs, tz::mem::Span<Quaternion> out);
+	/**
+	 * Normalise every quaternion in-place.
+	 * @param quaternions Quaternions to normalise. None may have zero length.
+	 */
+	void normalise_batch(tz::mem::Span<Quaternion> quaternions);
+	/**
+	 * Normalised linear interpolation: out[i] = Quaternion::nlerp(from[i], to[i], t[i]).
+	 * @param from Rotations at t == 0.
+	 * @param to Rotations at t == 1.
+	 * @param t Interpolation factor of each element.
+	 * @param out Destination of each interpolated rotation.
+	 */
+	void nlerp_batch(tz::mem::Span<const Quaternion> from, tz::mem::Span<const Quaternion> to, tz::mem::Span<const float> t, tz::mem::Span<Quaternion> out);
+	/**
+	 * Normalised linear interpolation with the same factor for every element: out[i] = Quaternion::nlerp(from[i], to[i], t).
+	 */
+	void nlerp_batch(tz::mem::Span<const Quaternion> from, tz::mem::Span<const Quaternion> to, float t, tz::mem::Span<Quaternion> out);
+	/**
+	 * Spherical linear interpolation: out[i] = Quaternion::slerp(from[i], to[i], t[i]).
+	 * @param from Normalised rotations at t == 0.
+	 * @param to Normalised rotations at t == 1.
+	 * @param t Interpolation factor of each element.
+	 * @param out Destination of each interpolated rotation.
+	 */
+	void slerp_batch(tz::mem::Span<const Quaternion> from, tz::mem::Span<const Quaternion> to, tz::mem::Span<const float> t, tz::mem::Span<Quaternion> out);
+	/**
+	 * Spherical linear interpolation with the same factor for every element: out[i] = Quaternion::slerp(from[i], to[i], t).
+	 */
+	void slerp_batch(tz::mem::Span<const Quaternion> from, tz::mem::Span<const Quaternion> to, float t, tz::mem::Span<Quaternion> out);
+	/**
+	 * Rotate vectors: out[i] = rotations[i].rotate(vectors[i]).
+	 * @param rotations Normalised rotations.
+	 * @param vectors Vectors to rotate.
+	 * @param out Destination of each rotated vector. May be the same span as vectors.
+	 */
+	void rotate_batch(tz::mem::Span<const Quaternion> rotations, tz::mem::Span<const Vec3> vectors, tz::mem::Span<Vec3> out);
+	/**
+	 * Convert rotations to matrices: out[i] = rotations[i].to_matrix().
+	 * @param rotations Rotations to convert. These need not be normalised.
+	 * @param out Destination of each rotation matrix.
+	 */
+	void to_matrix_batch(tz::mem::Span<const Quaternion> rotations, tz::mem::Span<Mat4> out);
+
+	/**
+	 * @}
+	 */
+
+	/**
+	 * @}
+	 */
+}
+
+#endif // TOPAZ_GEO_QUATERNION_BATCH_HPP
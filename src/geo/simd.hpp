@@ -0,0 +1,135 @@
+#ifndef TOPAZ_GEO_SIMD_HPP
+#define TOPAZ_GEO_SIMD_HPP
+#include <cstddef>
+
+// Define TOPAZ_GEO_SIMD=0 to force the scalar fallback. Otherwise, SSE kernels are used wherever SSE2 is available (which is every x86-64 target).
+#ifndef TOPAZ_GEO_SIMD
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define TOPAZ_GEO_SIMD 1
+	#else
+		#define TOPAZ_GEO_SIMD 0
+	#endif
+#endif
+
+#if TOPAZ_GEO_SIMD
+	#include <immintrin.h>
+#endif
+
+namespace tz::geo::simd
+{
+	/**
+	 * \addtogroup tz_geo Topaz Geometry Library (tz::geo)
+	 * A collection of geometric data structures and mathematical types, such as vectors and matrices.
+	 * @{
+	 */
+
+	/// True if tz::Mat4, tz::Mat3 and tz::Vec4 operations use the SIMD kernels below. Otherwise, they use the generic scalar implementation.
+	/// Note: There is deliberately no 3x3 multiply kernel. Three-wide columns waste a lane and need awkward loads, so it never beat the compiler's auto-vectorised generic loop.
+	constexpr bool enabled = TOPAZ_GEO_SIMD;
+	/// True if the kernels may additionally use 256-bit AVX instructions. This depends upon the compiler flags (e.g -mavx).
+	#if TOPAZ_GEO_SIMD && defined(__AVX__)
+		constexpr bool avx = true;
+	#else
+		constexpr bool avx = false;
+	#endif
+
+	/**
+	 * Query whether the caller is being evaluated within a constant expression. Intrinsics cannot be evaluated at compile-time, so constexpr functions must use their scalar implementation whenever this is true.
+	 * Note: If the compiler cannot tell, this conservatively returns true. That is correct, but means SIMD kernels are never used by constexpr functions.
+	 * @return True if the call is being constant-evaluated.
+	 */
+	constexpr bool constant_evaluated()
+	{
+	#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+		return __builtin_is_constant_evaluated();
+	#else
+		return true;
+	#endif
+	}
+
+#if TOPAZ_GEO_SIMD
+	/*
+	 * All kernels operate on column-major storage, exactly as tz::Matrix lays it out.
+	 * None of the inputs need to be 16-byte aligned. Unless otherwise stated, the output may alias any of the inputs.
+	 */
+
+	/**
+	 * Multiply two 4x4 matrices: out = lhs * rhs.
+	 * @param lhs 16 floats representing the left-hand matrix.
+	 * @param rhs 16 floats representing the right-hand matrix.
+	 * @param out 16 floats to write the product into.
+	 */
+	inline void mat4_multiply(const float* lhs, const float* rhs, float* out);
+	/**
+	 * For each i, write the dot product of the i'th column of the matrix with the vector. This matches the semantics of tz::Matrix<T, R, C>::operator*(const Vector<T, C>&).
+	 * @param mat 16 floats representing the matrix.
+	 * @param vec 4 floats representing the vector.
+	 * @param out 4 floats to write the result into.
+	 */
+	inline void mat4_multiply_vec4(const float* mat, const float* vec, float* out);
+	/**
+	 * Transpose a 4x4 matrix.
+	 * @param mat 16 floats representing the matrix.
+	 * @param out 16 floats to write the transposed matrix into.
+	 */
+	inline void mat4_transpose(const float* mat, float* out);
+	/**
+	 * Invert a 4x4 matrix.
+	 * Note: If the matrix is singular, the output will contain infinities or NaNs.
+	 * @param mat 16 floats representing the matrix.
+	 * @param out 16 floats to write the inverse into.
+	 * @return Determinant of the input matrix.
+	 */
+	inline float mat4_inverse(const float* mat, float* out);
+	/**
+	 * Transpose a 3x3 matrix.
+	 * @param mat 9 floats representing the matrix.
+	 * @param out 9 floats to write the transposed matrix into.
+	 */
+	inline void mat3_transpose(const float* mat, float* out);
+	/**
+	 * Invert a 3x3 matrix.
+	 * Note: If the matrix is singular, the output will contain infinities or NaNs.
+	 * @param mat 9 floats representing the matrix.
+	 * @param out 9 floats to write the inverse into.
+	 * @return Determinant of the input matrix.
+	 */
+	inline float mat3_inverse(const float* mat, float* out);
+	/**
+	 * Invert a 4x4 affine matrix, whose bottom row is (0, 0, 0, 1). Only the upper-left 3x3 is inverted, and the translation is transformed by it.
+	 * Note: If the 3x3 is singular, the output will contain infinities or NaNs.
+	 * @param mat 16 floats representing the matrix.
+	 * @param out 16 floats to write the inverse into.
+	 * @return Determinant of the input matrix.
+	 */
+	inline float mat4_affine_inverse(const float* mat, float* out);
+	/**
+	 * Invert a 4x4 rigid-body matrix, whose upper-left 3x3 is a pure rotation and whose bottom row is (0, 0, 0, 1). The rotation is transposed rather than inverted.
+	 * @param mat 16 floats representing the matrix.
+	 * @param out 16 floats to write the inverse into.
+	 */
+	inline void mat4_rigid_inverse(const float* mat, float* out);
+	/**
+	 * Compute the normal matrix of a 4x4 matrix: The inverse-transpose of its upper-left 3x3.
+	 * Note: If the 3x3 is singular, the output will contain infinities or NaNs.
+	 * @param mat 16 floats representing the matrix.
+	 * @param out 9 floats to write the 3x3 normal matrix into. Must not overlap mat.
+	 * @return Determinant of the upper-left 3x3.
+	 */
+	inline float mat4_normal_matrix(const float* mat, float* out);
+	/**
+	 * Compute the dot product of two 4-component vectors.
+	 * @param lhs 4 floats.
+	 * @param rhs 4 floats.
+	 * @return Dot product.
+	 */
+	inline float vec4_dot(const float* lhs, const float* rhs);
+#endif
+
+	/**
+	 * @}
+	 */
+}
+
+#include "geo/simd.inl"
+#endif // TOPAZ_GEO_SIMD_HPP
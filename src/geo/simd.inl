@@ -0,0 +1,448 @@
+#if TOPAZ_GEO_SIMD
+namespace tz::geo::simd
+{
+	namespace detail
+	{
+		/// Shuffle mask where lane 0 of the result is taken from element X, lane 1 from Y and so on. This is the reverse order of _MM_SHUFFLE.
+		template<int X, int Y, int Z, int W>
+		constexpr int mask = X | (Y << 2) | (Z << 4) | (W << 6);
+
+		template<int X, int Y, int Z, int W>
+		inline __m128 swizzle(__m128 v)
+		{
+			return _mm_shuffle_ps(v, v, (mask<X, Y, Z, W>));
+		}
+
+		/// Lanes 0 and 1 are taken from a, lanes 2 and 3 from b.
+		template<int X, int Y, int Z, int W>
+		inline __m128 shuffle(__m128 a, __m128 b)
+		{
+			return _mm_shuffle_ps(a, b, (mask<X, Y, Z, W>));
+		}
+
+		inline __m128 horizontal_sum(__m128 v)
+		{
+			__m128 t = _mm_add_ps(v, swizzle<2, 3, 0, 1>(v));
+			return _mm_add_ps(t, swizzle<1, 0, 3, 2>(t));
+		}
+
+		/// Load the three columns of a 3x3 matrix. Lane 3 of each column is unspecified. Never reads outside of the 9 floats.
+		inline void load_columns3(const float* mat, __m128& c0, __m128& c1, __m128& c2)
+		{
+			c0 = _mm_loadu_ps(mat + 0);
+			c1 = _mm_loadu_ps(mat + 3);
+			c2 = swizzle<1, 2, 3, 3>(_mm_loadu_ps(mat + 5));
+		}
+
+		inline __m128 zero_w(__m128 v)
+		{
+			return _mm_and_ps(v, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0)));
+		}
+
+		/// Load a 3-component vector. Lane 3 is zero. Never reads outside of the 3 floats.
+		inline __m128 load3(const float* p)
+		{
+			return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(p)), _mm_load_ss(p + 2));
+		}
+
+		inline void store3(float* p, __m128 v)
+		{
+			_mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+			_mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+		}
+
+		inline __m128 cross3(__m128 a, __m128 b)
+		{
+			return _mm_sub_ps(_mm_mul_ps(swizzle<1, 2, 0, 3>(a), swizzle<2, 0, 1, 3>(b)), _mm_mul_ps(swizzle<2, 0, 1, 3>(a), swizzle<1, 2, 0, 3>(b)));
+		}
+
+		// 2x2 matrices packed into a single register as (m00, m01, m10, m11). Used by the block-wise 4x4 inverse.
+
+		/// a * b
+		inline __m128 mat2_multiply(__m128 a, __m128 b)
+		{
+			return _mm_add_ps(_mm_mul_ps(a, swizzle<0, 3, 0, 3>(b)), _mm_mul_ps(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+		}
+
+		/// adjugate(a) * b
+		inline __m128 mat2_adjugate_multiply(__m128 a, __m128 b)
+		{
+			return _mm_sub_ps(_mm_mul_ps(swizzle<3, 3, 0, 0>(a), b), _mm_mul_ps(swizzle<1, 1, 2, 2>(a), swizzle<2, 3, 0, 1>(b)));
+		}
+
+		/// a * adjugate(b)
+		inline __m128 mat2_multiply_adjugate(__m128 a, __m128 b)
+		{
+			return _mm_sub_ps(_mm_mul_ps(a, swizzle<3, 0, 3, 0>(b)), _mm_mul_ps(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+		}
+
+		/// Load four tightly-packed 3-component vectors (12 floats) and transpose them, so that x contains the first component of each vector and so on. Never reads outside of the 12 floats.
+		inline void load_transpose3x4(const float* vecs, __m128& x, __m128& y, __m128& z)
+		{
+			// a = (x0 y0 z0 x1), b = (y1 z1 x2 y2), c = (z2 x3 y3 z3)
+			__m128 a = _mm_loadu_ps(vecs + 0);
+			__m128 b = _mm_loadu_ps(vecs + 4);
+			__m128 c = _mm_loadu_ps(vecs + 8);
+			x = shuffle<0, 3, 0, 2>(a, shuffle<2, 2, 1, 1>(b, c));
+			y = shuffle<0, 2, 0, 2>(shuffle<1, 1, 0, 0>(a, b), shuffle<3, 3, 2, 2>(b, c));
+			z = shuffle<0, 2, 0, 3>(shuffle<2, 2, 1, 1>(a, b), c);
+		}
+
+		/// Load four tightly-packed 4-component values (such as tz::Quaternions) and transpose them, so that x contains the first component of each and so on.
+		inline void load_transpose4(const float* values, __m128& x, __m128& y, __m128& z, __m128& w)
+		{
+			x = _mm_loadu_ps(values + 0);
+			y = _mm_loadu_ps(values + 4);
+			z = _mm_loadu_ps(values + 8);
+			w = _mm_loadu_ps(values + 12);
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+		}
+
+		/// Inverse of load_transpose4.
+		inline void store_transpose4(float* values, __m128 x, __m128 y, __m128 z, __m128 w)
+		{
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			_mm_storeu_ps(values + 0, x);
+			_mm_storeu_ps(values + 4, y);
+			_mm_storeu_ps(values + 8, z);
+			_mm_storeu_ps(values + 12, w);
+		}
+
+		/// Inverse of load_transpose3x4.
+		inline void store_transpose3x4(float* vecs, __m128 x, __m128 y, __m128 z)
+		{
+			__m128 xy_lo = _mm_unpacklo_ps(x, y); // x0 y0 x1 y1
+			__m128 xy_hi = _mm_unpackhi_ps(x, y); // x2 y2 x3 y3
+			__m128 a = shuffle<0, 1, 0, 2>(xy_lo, shuffle<0, 0, 1, 1>(z, x));
+			__m128 b = shuffle<0, 2, 0, 1>(shuffle<1, 1, 1, 1>(y, z), xy_hi);
+			__m128 c = shuffle<0, 2, 0, 2>(shuffle<2, 2, 2, 2>(z, xy_hi), shuffle<3, 3, 3, 3>(y, z));
+			_mm_storeu_ps(vecs + 0, a);
+			_mm_storeu_ps(vecs + 4, b);
+			_mm_storeu_ps(vecs + 8, c);
+		}
+
+		/// Normalise four quaternions (or any 4-component values) held as x, y, z and w components.
+		inline void normalise4(__m128& x, __m128& y, __m128& z, __m128& w)
+		{
+			const __m128 length_squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_add_ps(_mm_mul_ps(z, z), _mm_mul_ps(w, w)));
+			// Full-precision division rather than _mm_rsqrt_ps, so that results match the scalar tz::Quaternion path.
+			const __m128 inverse_length = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(length_squared));
+			x = _mm_mul_ps(x, inverse_length);
+			y = _mm_mul_ps(y, inverse_length);
+			z = _mm_mul_ps(z, inverse_length);
+			w = _mm_mul_ps(w, inverse_length);
+		}
+
+		/// Compute the rotation matrices of four normalised quaternions. r[row][col] holds that entry of each matrix, matching tz::Quaternion's conversion to tz::Mat4.
+		inline void quaternion_rotation4(__m128 x, __m128 y, __m128 z, __m128 w, __m128 r[3][3])
+		{
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 two = _mm_set1_ps(2.0f);
+			const __m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+			const __m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+			const __m128 xw = _mm_mul_ps(x, w), yw = _mm_mul_ps(y, w), zw = _mm_mul_ps(z, w);
+			r[0][0] = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz)));
+			r[0][1] = _mm_mul_ps(two, _mm_add_ps(xy, zw));
+			r[0][2] = _mm_mul_ps(two, _mm_sub_ps(xz, yw));
+			r[1][0] = _mm_mul_ps(two, _mm_sub_ps(xy, zw));
+			r[1][1] = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz)));
+			r[1][2] = _mm_mul_ps(two, _mm_add_ps(yz, xw));
+			r[2][0] = _mm_mul_ps(two, _mm_add_ps(xz, yw));
+			r[2][1] = _mm_mul_ps(two, _mm_sub_ps(yz, xw));
+			r[2][2] = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy)));
+		}
+
+		/**
+		 * Compute the arc-cosine of four values in [-1, 1] at once.
+		 * This is the Cephes single-precision acosf approach, built upon the asinf polynomial which is accurate within [-0.5, 0.5]. Larger inputs use acos(x) = 2 * asin(sqrt((1 - x) / 2)).
+		 */
+		inline __m128 acos(__m128 x)
+		{
+			const __m128 sign_bit = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+			const __m128 negative = _mm_cmplt_ps(x, _mm_setzero_ps());
+			const __m128 a = _mm_andnot_ps(sign_bit, x);
+			const __m128 large = _mm_cmpgt_ps(a, _mm_set1_ps(0.5f));
+			// asin argument: a itself if small, otherwise sqrt((1 - a) / 2).
+			const __m128 large_arg = _mm_sqrt_ps(_mm_mul_ps(_mm_set1_ps(0.5f), _mm_sub_ps(_mm_set1_ps(1.0f), a)));
+			const __m128 s = _mm_or_ps(_mm_and_ps(large, large_arg), _mm_andnot_ps(large, a));
+			const __m128 z = _mm_mul_ps(s, s);
+			__m128 asin_poly = _mm_set1_ps(4.2163199048e-2f);
+			asin_poly = _mm_add_ps(_mm_mul_ps(asin_poly, z), _mm_set1_ps(2.4181311049e-2f));
+			asin_poly = _mm_add_ps(_mm_mul_ps(asin_poly, z), _mm_set1_ps(4.5470025998e-2f));
+			asin_poly = _mm_add_ps(_mm_mul_ps(asin_poly, z), _mm_set1_ps(7.4953002686e-2f));
+			asin_poly = _mm_add_ps(_mm_mul_ps(asin_poly, z), _mm_set1_ps(1.6666752422e-1f));
+			asin_poly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(asin_poly, z), s), s);
+			// acos(|x|) is pi/2 - asin(|x|) for small inputs, and 2 * asin(sqrt((1 - |x|) / 2)) for large ones.
+			const __m128 small_result = _mm_sub_ps(_mm_set1_ps(1.57079632679f), asin_poly);
+			const __m128 large_result = _mm_add_ps(asin_poly, asin_poly);
+			const __m128 result = _mm_or_ps(_mm_and_ps(large, large_result), _mm_andnot_ps(large, small_result));
+			// acos(-x) = pi - acos(x)
+			return _mm_or_ps(_mm_and_ps(negative, _mm_sub_ps(_mm_set1_ps(3.14159265359f), result)), _mm_andnot_ps(negative, result));
+		}
+
+		/**
+		 * Compute the sine and cosine of four angles at once.
+		 * This is the Cephes single-precision sinf/cosf approach: reduce the argument into [-pi/4, pi/4] in extended precision, then evaluate the minimax polynomials. Results are accurate to a few ULP for |angle| < 8192.
+		 */
+		inline void sincos(__m128 angle, __m128& sin, __m128& cos)
+		{
+			const __m128 sign_bit = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+			__m128 sin_sign = _mm_and_ps(angle, sign_bit);
+			__m128 x = _mm_andnot_ps(sign_bit, angle);
+			// Octant j, rounded up to even so that x - j*(pi/4) lies within [-pi/4, pi/4].
+			__m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));
+			j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+			__m128 y = _mm_cvtepi32_ps(j);
+			sin_sign = _mm_xor_ps(sin_sign, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29)));
+			__m128 cos_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+			// Lanes where the sine polynomial computes the sine (and the cosine polynomial the cosine). Otherwise, they swap.
+			__m128 use_sin_poly = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+
+			x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(0.78515625f)));
+			x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(2.4187564849853515625e-4f)));
+			x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(3.77489497744594108e-8f)));
+			__m128 z = _mm_mul_ps(x, x);
+
+			__m128 cos_poly = _mm_set1_ps(2.443315711809948e-5f);
+			cos_poly = _mm_add_ps(_mm_mul_ps(cos_poly, z), _mm_set1_ps(-1.388731625493765e-3f));
+			cos_poly = _mm_add_ps(_mm_mul_ps(cos_poly, z), _mm_set1_ps(4.166664568298827e-2f));
+			cos_poly = _mm_mul_ps(_mm_mul_ps(cos_poly, z), z);
+			cos_poly = _mm_add_ps(_mm_sub_ps(cos_poly, _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+
+			__m128 sin_poly = _mm_set1_ps(-1.9515295891e-4f);
+			sin_poly = _mm_add_ps(_mm_mul_ps(sin_poly, z), _mm_set1_ps(8.3321608736e-3f));
+			sin_poly = _mm_add_ps(_mm_mul_ps(sin_poly, z), _mm_set1_ps(-1.6666654611e-1f));
+			sin_poly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sin_poly, z), x), x);
+
+			sin = _mm_xor_ps(_mm_or_ps(_mm_and_ps(use_sin_poly, sin_poly), _mm_andnot_ps(use_sin_poly, cos_poly)), sin_sign);
+			cos = _mm_xor_ps(_mm_or_ps(_mm_and_ps(use_sin_poly, cos_poly), _mm_andnot_ps(use_sin_poly, sin_poly)), cos_sign);
+		}
+	}
+
+	inline void mat4_multiply(const float* lhs, const float* rhs, float* out)
+	{
+		// Each column of the product is a linear combination of the columns of lhs, weighted by the corresponding column of rhs.
+		// All of lhs is loaded up-front and each column of rhs is read before that column of out is written, so out may alias either input.
+		#if defined(__AVX__)
+			// Two columns of the product at once.
+			__m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 0));
+			__m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 4));
+			__m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 8));
+			__m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 12));
+			for(std::size_t j = 0; j < 4; j += 2)
+			{
+				__m256 b = _mm256_loadu_ps(rhs + (j * 4));
+				__m256 r = _mm256_mul_ps(a0, _mm256_shuffle_ps(b, b, 0x00));
+				r = _mm256_add_ps(r, _mm256_mul_ps(a1, _mm256_shuffle_ps(b, b, 0x55)));
+				r = _mm256_add_ps(r, _mm256_mul_ps(a2, _mm256_shuffle_ps(b, b, 0xAA)));
+				r = _mm256_add_ps(r, _mm256_mul_ps(a3, _mm256_shuffle_ps(b, b, 0xFF)));
+				_mm256_storeu_ps(out + (j * 4), r);
+			}
+		#else
+			__m128 a0 = _mm_loadu_ps(lhs + 0);
+			__m128 a1 = _mm_loadu_ps(lhs + 4);
+			__m128 a2 = _mm_loadu_ps(lhs + 8);
+			__m128 a3 = _mm_loadu_ps(lhs + 12);
+			for(std::size_t j = 0; j < 4; j++)
+			{
+				__m128 b = _mm_loadu_ps(rhs + (j * 4));
+				__m128 r = _mm_mul_ps(a0, detail::swizzle<0, 0, 0, 0>(b));
+				r = _mm_add_ps(r, _mm_mul_ps(a1, detail::swizzle<1, 1, 1, 1>(b)));
+				r = _mm_add_ps(r, _mm_mul_ps(a2, detail::swizzle<2, 2, 2, 2>(b)));
+				r = _mm_add_ps(r, _mm_mul_ps(a3, detail::swizzle<3, 3, 3, 3>(b)));
+				_mm_storeu_ps(out + (j * 4), r);
+			}
+		#endif
+	}
+
+	inline void mat4_multiply_vec4(const float* mat, const float* vec, float* out)
+	{
+		__m128 c0 = _mm_loadu_ps(mat + 0);
+		__m128 c1 = _mm_loadu_ps(mat + 4);
+		__m128 c2 = _mm_loadu_ps(mat + 8);
+		__m128 c3 = _mm_loadu_ps(mat + 12);
+		__m128 v = _mm_loadu_ps(vec);
+		// After transposing, lane i of cj holds element j of column i. So the sum below is the dot product of each column with the vector, all at once.
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		__m128 r = _mm_mul_ps(c0, detail::swizzle<0, 0, 0, 0>(v));
+		r = _mm_add_ps(r, _mm_mul_ps(c1, detail::swizzle<1, 1, 1, 1>(v)));
+		r = _mm_add_ps(r, _mm_mul_ps(c2, detail::swizzle<2, 2, 2, 2>(v)));
+		r = _mm_add_ps(r, _mm_mul_ps(c3, detail::swizzle<3, 3, 3, 3>(v)));
+		_mm_storeu_ps(out, r);
+	}
+
+	inline void mat4_transpose(const float* mat, float* out)
+	{
+		__m128 c0 = _mm_loadu_ps(mat + 0);
+		__m128 c1 = _mm_loadu_ps(mat + 4);
+		__m128 c2 = _mm_loadu_ps(mat + 8);
+		__m128 c3 = _mm_loadu_ps(mat + 12);
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		_mm_storeu_ps(out + 0, c0);
+		_mm_storeu_ps(out + 4, c1);
+		_mm_storeu_ps(out + 8, c2);
+		_mm_storeu_ps(out + 12, c3);
+	}
+
+	inline float mat4_inverse(const float* mat, float* out)
+	{
+		// Block-wise inversion using 2x2 sub-matrices:
+		// M = |A B|, inverse(M) = 1/|M| * |X Y|
+		//     |C D|                       |Z W|
+		// Written in terms of rows, but as inverse(transpose(M)) == transpose(inverse(M)), it works just as well on columns.
+		using namespace detail;
+		__m128 r0 = _mm_loadu_ps(mat + 0);
+		__m128 r1 = _mm_loadu_ps(mat + 4);
+		__m128 r2 = _mm_loadu_ps(mat + 8);
+		__m128 r3 = _mm_loadu_ps(mat + 12);
+
+		__m128 a = _mm_movelh_ps(r0, r1);
+		__m128 b = _mm_movehl_ps(r1, r0);
+		__m128 c = _mm_movelh_ps(r2, r3);
+		__m128 d = _mm_movehl_ps(r3, r2);
+
+		// (|A|, |B|, |C|, |D|)
+		__m128 det_sub = _mm_sub_ps(
+			_mm_mul_ps(shuffle<0, 2, 0, 2>(r0, r2), shuffle<1, 3, 1, 3>(r1, r3)),
+			_mm_mul_ps(shuffle<1, 3, 1, 3>(r0, r2), shuffle<0, 2, 0, 2>(r1, r3)));
+		__m128 det_a = swizzle<0, 0, 0, 0>(det_sub);
+		__m128 det_b = swizzle<1, 1, 1, 1>(det_sub);
+		__m128 det_c = swizzle<2, 2, 2, 2>(det_sub);
+		__m128 det_d = swizzle<3, 3, 3, 3>(det_sub);
+
+		__m128 d_c = mat2_adjugate_multiply(d, c);
+		__m128 a_b = mat2_adjugate_multiply(a, b);
+		// Adjugates of each block of the result.
+		__m128 x = _mm_sub_ps(_mm_mul_ps(det_d, a), mat2_multiply(b, d_c));
+		__m128 w = _mm_sub_ps(_mm_mul_ps(det_a, d), mat2_multiply(c, a_b));
+		__m128 y = _mm_sub_ps(_mm_mul_ps(det_b, c), mat2_multiply_adjugate(d, a_b));
+		__m128 z = _mm_sub_ps(_mm_mul_ps(det_c, b), mat2_multiply_adjugate(a, d_c));
+
+		// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+		__m128 det_m = _mm_add_ps(_mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c));
+		__m128 trace = horizontal_sum(_mm_mul_ps(a_b, swizzle<0, 2, 1, 3>(d_c)));
+		det_m = _mm_sub_ps(det_m, trace);
+
+		__m128 reciprocal = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det_m);
+		x = _mm_mul_ps(x, reciprocal);
+		y = _mm_mul_ps(y, reciprocal);
+		z = _mm_mul_ps(z, reciprocal);
+		w = _mm_mul_ps(w, reciprocal);
+
+		// Undo the adjugate and re-interleave the blocks in one go.
+		_mm_storeu_ps(out + 0, shuffle<3, 1, 3, 1>(x, y));
+		_mm_storeu_ps(out + 4, shuffle<2, 0, 2, 0>(x, y));
+		_mm_storeu_ps(out + 8, shuffle<3, 1, 3, 1>(z, w));
+		_mm_storeu_ps(out + 12, shuffle<2, 0, 2, 0>(z, w));
+		return _mm_cvtss_f32(det_m);
+	}
+
+	inline void mat3_transpose(const float* mat, float* out)
+	{
+		__m128 c0, c1, c2;
+		detail::load_columns3(mat, c0, c1, c2);
+		// Whatever was in lane 3 ends up in c3, which is discarded.
+		__m128 c3 = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		detail::store3(out + 0, c0);
+		detail::store3(out + 3, c1);
+		detail::store3(out + 6, c2);
+	}
+
+	inline float mat3_inverse(const float* mat, float* out)
+	{
+		// The rows of the inverse are the cross products of pairs of columns, divided by the determinant.
+		__m128 c0, c1, c2;
+		detail::load_columns3(mat, c0, c1, c2);
+		// Lane 3 must be zero so that it doesn't contribute to the determinant.
+		c0 = detail::zero_w(c0);
+		c1 = detail::zero_w(c1);
+		c2 = detail::zero_w(c2);
+		__m128 r0 = detail::cross3(c1, c2);
+		__m128 r1 = detail::cross3(c2, c0);
+		__m128 r2 = detail::cross3(c0, c1);
+		__m128 det = detail::horizontal_sum(_mm_mul_ps(c0, r0));
+		__m128 reciprocal = _mm_div_ps(_mm_set1_ps(1.0f), det);
+		r0 = _mm_mul_ps(r0, reciprocal);
+		r1 = _mm_mul_ps(r1, reciprocal);
+		r2 = _mm_mul_ps(r2, reciprocal);
+		__m128 r3 = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		detail::store3(out + 0, r0);
+		detail::store3(out + 3, r1);
+		detail::store3(out + 6, r2);
+		return _mm_cvtss_f32(det);
+	}
+
+	inline float mat4_affine_inverse(const float* mat, float* out)
+	{
+		// inverse(|A t|) = |inverse(A) -inverse(A)t|
+		//         |0 1|    |0          1           |
+		using namespace detail;
+		__m128 c0 = zero_w(_mm_loadu_ps(mat + 0));
+		__m128 c1 = zero_w(_mm_loadu_ps(mat + 4));
+		__m128 c2 = zero_w(_mm_loadu_ps(mat + 8));
+		__m128 t = _mm_loadu_ps(mat + 12);
+		// Rows of inverse(A), exactly as in mat3_inverse.
+		__m128 r0 = cross3(c1, c2);
+		__m128 r1 = cross3(c2, c0);
+		__m128 r2 = cross3(c0, c1);
+		__m128 det = horizontal_sum(_mm_mul_ps(c0, r0));
+		__m128 reciprocal = _mm_div_ps(_mm_set1_ps(1.0f), det);
+		r0 = _mm_mul_ps(r0, reciprocal);
+		r1 = _mm_mul_ps(r1, reciprocal);
+		r2 = _mm_mul_ps(r2, reciprocal);
+		__m128 r3 = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		// r0-r2 are now the columns of inverse(A), each with a zero w.
+		__m128 translation = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r0, swizzle<0, 0, 0, 0>(t)), _mm_mul_ps(r1, swizzle<1, 1, 1, 1>(t))), _mm_mul_ps(r2, swizzle<2, 2, 2, 2>(t)));
+		translation = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), translation);
+		_mm_storeu_ps(out + 0, r0);
+		_mm_storeu_ps(out + 4, r1);
+		_mm_storeu_ps(out + 8, r2);
+		_mm_storeu_ps(out + 12, translation);
+		return _mm_cvtss_f32(det);
+	}
+
+	inline void mat4_rigid_inverse(const float* mat, float* out)
+	{
+		// As mat4_affine_inverse, but inverse(R) == transpose(R).
+		using namespace detail;
+		__m128 c0 = zero_w(_mm_loadu_ps(mat + 0));
+		__m128 c1 = zero_w(_mm_loadu_ps(mat + 4));
+		__m128 c2 = zero_w(_mm_loadu_ps(mat + 8));
+		__m128 t = _mm_loadu_ps(mat + 12);
+		__m128 c3 = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		__m128 translation = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, swizzle<0, 0, 0, 0>(t)), _mm_mul_ps(c1, swizzle<1, 1, 1, 1>(t))), _mm_mul_ps(c2, swizzle<2, 2, 2, 2>(t)));
+		translation = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), translation);
+		_mm_storeu_ps(out + 0, c0);
+		_mm_storeu_ps(out + 4, c1);
+		_mm_storeu_ps(out + 8, c2);
+		_mm_storeu_ps(out + 12, translation);
+	}
+
+	inline float mat4_normal_matrix(const float* mat, float* out)
+	{
+		// The rows of inverse(A) are the columns of transpose(inverse(A)), so no transpose is necessary.
+		using namespace detail;
+		__m128 c0 = zero_w(_mm_loadu_ps(mat + 0));
+		__m128 c1 = zero_w(_mm_loadu_ps(mat + 4));
+		__m128 c2 = zero_w(_mm_loadu_ps(mat + 8));
+		__m128 r0 = cross3(c1, c2);
+		__m128 r1 = cross3(c2, c0);
+		__m128 r2 = cross3(c0, c1);
+		__m128 det = horizontal_sum(_mm_mul_ps(c0, r0));
+		__m128 reciprocal = _mm_div_ps(_mm_set1_ps(1.0f), det);
+		store3(out + 0, _mm_mul_ps(r0, reciprocal));
+		store3(out + 3, _mm_mul_ps(r1, reciprocal));
+		store3(out + 6, _mm_mul_ps(r2, reciprocal));
+		return _mm_cvtss_f32(det);
+	}
+
+	inline float vec4_dot(const float* lhs, const float* rhs)
+	{
+		return _mm_cvtss_f32(detail::horizontal_sum(_mm_mul_ps(_mm_loadu_ps(lhs), _mm_loadu_ps(rhs))));
+	}
+}
+#endif
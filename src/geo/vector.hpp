@@ -3,6 +3,9 @@
 #include "memory/align.hpp"
 #include "memory/block.hpp"
 #include "algo/static.hpp"
+#include "geo/simd.hpp"
+#include "geo/expression.hpp"
+#include <type_traits>
 
 namespace tz
 {
@@ -19,26 +22,29 @@ namespace tz
 		template<typename... Ts, typename = std::enable_if_t<tz::algo::static_find<T, Ts...>()>>
 		constexpr Vector(Ts&&... ts);
 		constexpr Vector(std::array<T, S> data);
+		/**
+		 * Evaluate an element-wise expression, such as (a + b) * 0.5f, directly into a new vector.
+		 * @param expression Expression producing a vector of this type.
+		 */
+		template<typename E, typename = std::enable_if_t<detail::is_expression_of<E, Vector<T, S>>>>
+		constexpr Vector(const E& expression);
 		Vector() = default;
 
-		const T& operator[](std::size_t idx) const;
-		T& operator[](std::size_t idx);
+		constexpr const T& operator[](std::size_t idx) const;
+		constexpr T& operator[](std::size_t idx);
 
-		Vector<T, S>& operator+=(const Vector<T, S>& rhs);
-		Vector<T, S> operator+(const Vector<T, S>& rhs) const;
-		Vector<T, S>& operator-=(const Vector<T, S>& rhs);
-		Vector<T, S> operator-(const Vector<T, S>& rhs) const;
-		Vector<T, S>& operator*=(T scalar);
-		Vector<T, S> operator*(T scalar) const;
-		Vector<T, S>& operator/=(T scalar);
-		Vector<T, S> operator/(T scalar) const;
+		// Note: Binary arithmetic operators (e.g +) are defined in geo/expression.hpp, and are evaluated lazily.
+		constexpr Vector<T, S>& operator+=(const Vector<T, S>& rhs);
+		constexpr Vector<T, S>& operator-=(const Vector<T, S>& rhs);
+		constexpr Vector<T, S>& operator*=(T scalar);
+		constexpr Vector<T, S>& operator/=(T scalar);
 
-		bool operator==(const Vector<T, S>& rhs) const;
+		constexpr bool operator==(const Vector<T, S>& rhs) const;
 
-		const T* data() const;
-		T* data();
+		constexpr const T* data() const;
+		constexpr T* data();
 
-		T dot(const Vector<T, S>& rhs) const;
+		constexpr T dot(const Vector<T, S>& rhs) const;
 		T length() const;
 		void normalise();
 		Vector<T, S> normalised() const;
@@ -51,7 +57,7 @@ namespace tz
 	using Vec4 = Vector<float, 4>;
 
 	template<typename T = float>
-	Vector<T, 3> cross(const Vector<T, 3>& lhs, const Vector<T, 3>& rhs);
+	constexpr Vector<T, 3> cross(const Vector<T, 3>& lhs, const Vector<T, 3>& rhs);
 
 	/**
 	 * @}
@@ -1,6 +1,7 @@
 #include "core/debug/assert.hpp"
 #include <utility>
 #include <cmath>
+#include <limits>
 
 namespace tz
 {
@@ -15,21 +16,29 @@ namespace tz
 	constexpr Vector<T, S>::Vector(std::array<T, S> data): vec(data){}
 
 	template<typename T, std::size_t S>
-	const T& Vector<T, S>::operator[](std::size_t idx) const
+	template<typename E, typename>
+	constexpr Vector<T, S>::Vector(const E& expression): vec{}
+	{
+		for(std::size_t i = 0; i < S; i++)
+			this->vec[i] = expression.element(i);
+	}
+
+	template<typename T, std::size_t S>
+	constexpr const T& Vector<T, S>::operator[](std::size_t idx) const
 	{
 		topaz_assert(idx < S, "Vector<T, ", S, ">::operator[", idx, "]: Index out of range!");
 		return this->vec[idx];
 	}
 
 	template<typename T, std::size_t S>
-	T& Vector<T, S>::operator[](std::size_t idx)
+	constexpr T& Vector<T, S>::operator[](std::size_t idx)
 	{
 		topaz_assert(idx < S, "Vector<T, ", S, ">::operator[", idx, "]: Index out of range!");
 		return this->vec[idx];
 	}
 
 	template<typename T, std::size_t S>
-	Vector<T, S>& Vector<T, S>::operator+=(const Vector<T, S>& rhs)
+	constexpr Vector<T, S>& Vector<T, S>::operator+=(const Vector<T, S>& rhs)
 	{
 		for(std::size_t i = 0; i < S; i++)
 			this->vec[i] += rhs.vec[i];
@@ -37,15 +46,7 @@ namespace tz
 	}
 
 	template<typename T, std::size_t S>
-	Vector<T, S> Vector<T, S>::operator+(const Vector<T, S>& rhs) const
-	{
-		Vector<T, S> copy = *this;
-		copy += rhs;
-		return std::move(copy);
-	}
-
-	template<typename T, std::size_t S>
-	Vector<T, S>& Vector<T, S>::operator-=(const Vector<T, S>& rhs)
+	constexpr Vector<T, S>& Vector<T, S>::operator-=(const Vector<T, S>& rhs)
 	{
 		for(std::size_t i = 0; i < S; i++)
 			this->vec[i] -= rhs.vec[i];
@@ -53,15 +54,7 @@ namespace tz
 	}
 
 	template<typename T, std::size_t S>
-	Vector<T, S> Vector<T, S>::operator-(const Vector<T, S>& rhs) const
-	{
-		Vector<T, S> copy = *this;
-		copy -= rhs;
-		return std::move(copy);
-	}
-
-	template<typename T, std::size_t S>
-	Vector<T, S>& Vector<T, S>::operator*=(T scalar)
+	constexpr Vector<T, S>& Vector<T, S>::operator*=(T scalar)
 	{
 		for(std::size_t i = 0; i < S; i++)
 			this->vec[i] *= scalar;
@@ -69,15 +62,7 @@ namespace tz
 	}
 
 	template<typename T, std::size_t S>
-	Vector<T, S> Vector<T, S>::operator*(T scalar) const
-	{
-		Vector<T, S> copy = *this;
-		copy *= scalar;
-		return std::move(copy);
-	}
-
-	template<typename T, std::size_t S>
-	Vector<T, S>& Vector<T, S>::operator/=(T scalar)
+	constexpr Vector<T, S>& Vector<T, S>::operator/=(T scalar)
 	{
 		for(std::size_t i = 0; i < S; i++)
 			this->vec[i] /= scalar;
@@ -85,39 +70,42 @@ namespace tz
 	}
 
 	template<typename T, std::size_t S>
-	Vector<T, S> Vector<T, S>::operator/(T scalar) const
-	{
-		Vector<T, S> copy = *this;
-		copy /= scalar;
-		return std::move(copy);
-	}
-
-	template<typename T, std::size_t S>
-	bool Vector<T, S>::operator==(const Vector<T, S>& rhs) const
+	constexpr bool Vector<T, S>::operator==(const Vector<T, S>& rhs) const
 	{
 		for(std::size_t i = 0; i < S; i++)
 		{
-			if(std::abs((*this)[i] - rhs[i]) >= std::numeric_limits<T>::epsilon())
+			// Not std::abs, as that isn't constexpr.
+			T difference = (*this)[i] - rhs[i];
+			if(difference < T{})
+				difference = -difference;
+			if(difference >= std::numeric_limits<T>::epsilon())
 				return false;
 		}
 		return true;
 	}
 
 	template<typename T, std::size_t S>
-	const T* Vector<T, S>::data() const
+	constexpr const T* Vector<T, S>::data() const
 	{
 		return this->vec.data();
 	}
 
 	template<typename T, std::size_t S>
-	T* Vector<T, S>::data()
+	constexpr T* Vector<T, S>::data()
 	{
 		return this->vec.data();
 	}
 
 	template<typename T, std::size_t S>
-	T Vector<T, S>::dot(const Vector<T, S>& rhs) const
+	constexpr T Vector<T, S>::dot(const Vector<T, S>& rhs) const
 	{
+		#if TOPAZ_GEO_SIMD
+			if constexpr(std::is_same_v<T, float> && S == 4)
+			{
+				if(!tz::geo::simd::constant_evaluated())
+					return tz::geo::simd::vec4_dot(this->data(), rhs.data());
+			}
+		#endif
 		T sum = T();
 		for(std::size_t i = 0; i < S; i++)
 		{
@@ -157,16 +145,16 @@ namespace tz
 	}
 
 	template<typename T>
-	Vector<T, 3> cross(const Vector<T, 3>& lhs, const Vector<T, 3>& rhs)
+	constexpr Vector<T, 3> cross(const Vector<T, 3>& lhs, const Vector<T, 3>& rhs)
 	{
-		Vector<T, 3> ret;
+		Vector<T, 3> ret{};
 		//cx = aybz − azby
 		ret[0] = (lhs[1] * rhs[2]) - (lhs[2] * rhs[1]);
 		//cy = azbx − axbz
 		ret[1] = (lhs[2] * rhs[0]) - (lhs[0] * rhs[2]);
 		//cz = axby − aybx
 		ret[2] = (lhs[0] * rhs[1]) - (lhs[1] * rhs[0]);
-		return std::move(ret);
+		return ret;
 	}
 
 }
\ No newline at end of file
@@ -4,37 +4,90 @@
 
 #include "gl/buffer.hpp"
 #include "core/debug/assert.hpp"
+#include "memory/tracking.hpp"
+#include <algorithm>
 #include <optional>
 
 namespace tz::gl
 {
-	IBuffer::IBuffer(): handle(0)
+	namespace
+	{
+		/// Whenever safe_resize needs a bigger data-store, the capacity is multiplied by at least this much.
+		constexpr std::size_t capacity_growth_factor = 2;
+		/// Access flags which terminal buffers are always mapped with, matching the flags their immutable data-store was created with.
+		constexpr GLbitfield terminal_mapping_access = GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		GLbitfield to_access(MappingPurpose purpose)
+		{
+			switch(purpose)
+			{
+				case MappingPurpose::ReadOnly:
+					return GL_MAP_READ_BIT;
+				break;
+				case MappingPurpose::WriteOnly:
+					return GL_MAP_WRITE_BIT;
+				break;
+				case MappingPurpose::ReadWrite:
+				default:
+					return GL_MAP_READ_BIT | GL_MAP_WRITE_BIT;
+				break;
+			}
+		}
+	}
+
+	MappingFlag operator|(MappingFlag lhs, MappingFlag rhs)
+	{
+		return static_cast<MappingFlag>(static_cast<GLbitfield>(lhs) | static_cast<GLbitfield>(rhs));
+	}
+
+	MappingFlag operator&(MappingFlag lhs, MappingFlag rhs)
+	{
+		return static_cast<MappingFlag>(static_cast<GLbitfield>(lhs) & static_cast<GLbitfield>(rhs));
+	}
+
+	IBuffer::IBuffer(): handle(0), size_bytes(0), capacity_bytes(0), usage(BufferUsage::StaticDraw), terminal(false), mapping(std::nullopt)
 	{
 		glGenBuffers(1, &this->handle);
 	}
 
-	IBuffer::IBuffer(IBuffer&& move): handle(move.handle)
+	IBuffer::IBuffer(IBuffer&& move): handle(move.handle), size_bytes(move.size_bytes), capacity_bytes(move.capacity_bytes), usage(move.usage), terminal(move.terminal), mapping(move.mapping)
 	{
 		move.handle = 0;
+		move.size_bytes = 0;
+		move.capacity_bytes = 0;
+		move.terminal = false;
+		move.mapping = std::nullopt;
 	}
 
 	IBuffer& IBuffer::operator=(IBuffer&& rhs)
 	{
 		std::swap(this->handle, rhs.handle);
+		std::swap(this->size_bytes, rhs.size_bytes);
+		std::swap(this->capacity_bytes, rhs.capacity_bytes);
+		std::swap(this->usage, rhs.usage);
+		std::swap(this->terminal, rhs.terminal);
+		std::swap(this->mapping, rhs.mapping);
 		return *this;
 	}
 
 	IBuffer::~IBuffer()
 	{
+		tz::mem::tracking::record_free(tz::mem::tracking::Tag::GL, this->capacity_bytes);
 		glDeleteBuffers(1, &this->handle);
 	}
 
 	std::size_t IBuffer::size() const
 	{
 		IBuffer::verify();
-		GLint param;
-		glGetNamedBufferParameteriv(this->handle, GL_BUFFER_SIZE, &param);
-		return static_cast<std::size_t>(param);
+		this->verify_state();
+		return this->size_bytes;
+	}
+
+	std::size_t IBuffer::capacity() const
+	{
+		IBuffer::verify();
+		this->verify_state();
+		return this->capacity_bytes;
 	}
 
 	bool IBuffer::empty() const
@@ -45,9 +98,8 @@ namespace tz::gl
 	bool IBuffer::is_terminal() const
 	{
 		IBuffer::verify();
-		GLint param;
-		glGetNamedBufferParameteriv(this->handle, GL_BUFFER_IMMUTABLE_STORAGE, &param);
-		return (param == GL_FALSE) ? false : true;
+		this->verify_state();
+		return this->terminal;
 	}
 
 	bool IBuffer::valid() const
@@ -62,6 +114,9 @@ namespace tz::gl
 		topaz_assert(!this->is_terminal(), "tz::gl::Buffer<T>::resize(", size_bytes, "): Cannot resize a terminal buffer.");
 		topaz_assert(!this->is_mapped(), "tz::gl::Buffer<T>::resize(", size_bytes, "): Cannot resize because this buffer is currently mapped.");
 		glNamedBufferData(this->handle, size_bytes, nullptr, static_cast<GLenum>(usage));
+		this->size_bytes = size_bytes;
+		this->set_capacity(size_bytes);
+		this->usage = usage;
 	}
 
 	void IBuffer::safe_resize(std::size_t size_bytes)
@@ -71,23 +126,20 @@ namespace tz::gl
 		IBuffer::verify();
 		topaz_assert(!this->is_mapped(), "tz::gl::Buffer<T>::safe_resize(", size_bytes, "): Cannot resize because this buffer is currently mapped.");
 		topaz_assert(!this->is_terminal(), "tz::gl::Buffer<T>::safe_resize(", size_bytes, "): Cannot safe-resize a terminal buffer if the new size parameter is not equal to its old size.");
-		std::size_t temp_size = this->size();
-		void* temp_data = std::malloc(temp_size);
-		this->retrieve_all(temp_data);
-		this->resize(size_bytes);
-		if(size_bytes > temp_size)
-		{
-			// if we now have extra space that is unused, just copy everything we have so far.
-			tz::mem::Block blk{temp_data, temp_size};
-			this->send(0, blk);
-			// remainder after this block is now undefined and is free to be overwritten.
-		}
-		else
-		{
-			// just send as much as it can take
-			this->send(temp_data);
-		}
-		std::free(temp_data);
+		if(size_bytes > this->capacity_bytes)
+			this->reallocate(std::max(size_bytes, this->capacity_bytes * capacity_growth_factor));
+		// Anything between the old size and the new size is undefined and is free to be overwritten.
+		this->size_bytes = size_bytes;
+	}
+
+	void IBuffer::reserve(std::size_t capacity_bytes)
+	{
+		if(capacity_bytes <= this->capacity())
+			return;
+		IBuffer::verify();
+		topaz_assert(!this->is_mapped(), "tz::gl::Buffer<T>::reserve(", capacity_bytes, "): Cannot reserve because this buffer is currently mapped.");
+		topaz_assert(!this->is_terminal(), "tz::gl::Buffer<T>::reserve(", capacity_bytes, "): Cannot grow the capacity of a terminal buffer.");
+		this->reallocate(capacity_bytes);
 	}
 
 	void IBuffer::retrieve(std::size_t offset, std::size_t size_bytes, void* input_data) const
@@ -130,6 +182,9 @@ namespace tz::gl
 		IBuffer::verify_nonterminal();
 		topaz_assert(!this->is_mapped(), "tz::gl::Buffer<T>::terminal_resize(", size_bytes, "): Cannot resize because this buffer is currently mapped.");
 		glNamedBufferStorage(this->handle, size_bytes, nullptr, GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+		this->size_bytes = size_bytes;
+		this->set_capacity(size_bytes);
+		this->terminal = true;
 	}
 
 	void IBuffer::make_terminal()
@@ -143,42 +198,81 @@ namespace tz::gl
 		this->retrieve(0, sz, data_store.begin);
 		glNamedBufferStorage(this->handle, sz, data_store.begin, GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
 		std::free(data_store.begin);
+		this->set_capacity(sz);
+		this->terminal = true;
 	}
 
 	tz::mem::Block IBuffer::map(MappingPurpose purpose)
 	{
-		static std::optional<tz::mem::Block> block_cache;
 		IBuffer::verify();
 		if(this->is_mapped())
 		{
-			topaz_assert(block_cache.has_value(), "tz::gl::Buffer<T>::map(...): Attempted to map but we are already mapped without any cached result.");
-			return block_cache.value();
+			const Mapping& existing = this->mapping.value();
+			const bool covers_buffer = existing.offset == 0 && existing.block.size() == this->size();
+			topaz_assert(covers_buffer, "tz::gl::Buffer<T>::map(...): Cannot map the whole buffer because a range of it (offset ", existing.offset, ", size ", existing.block.size(), ") is already mapped. Unmap it first.");
+			if(!covers_buffer)
+				return tz::mem::Block::null();
+			return existing.block;
 		}
 		// We know for sure that we have a valid handle, it is currently bound and we're definitely not yet mapped.
 		void* begin = nullptr;
 		if(this->is_terminal())
-			begin = glMapNamedBufferRange(this->handle, 0, this->size(), GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+			begin = glMapNamedBufferRange(this->handle, 0, this->size(), GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | terminal_mapping_access);
 		else
 			begin = glMapNamedBuffer(this->handle, static_cast<GLenum>(purpose));
 		tz::mem::Block blk{begin, this->size()};
-		block_cache = blk;
+		// If mapping failed, the driver doesn't consider the buffer mapped either.
+		topaz_assert(begin != nullptr || this->size() == 0, "tz::gl::Buffer<T>::map(...): Driver failed to map the buffer (size ", this->size(), ")");
+		if(begin != nullptr)
+			this->mapping = Mapping{blk, 0, MappingFlag::None};
 		return blk;
 	}
 
+	tz::mem::Block IBuffer::map_range(std::size_t offset, std::size_t size_bytes, MappingFlag flags, MappingPurpose purpose)
+	{
+		IBuffer::verify();
+		topaz_assert(!this->is_mapped(), "tz::gl::Buffer<T>::map_range(", offset, ", ", size_bytes, ", ...): Cannot map a range because this buffer is already mapped.");
+		topaz_assert(size_bytes > 0 && offset + size_bytes <= this->size(), "tz::gl::Buffer<T>::map_range(", offset, ", ", size_bytes, ", ...): Range is empty or does not fit within the buffer of size ", this->size());
+		const bool reads = purpose != MappingPurpose::WriteOnly;
+		const bool writes = purpose != MappingPurpose::ReadOnly;
+		topaz_assert(!reads || (flags & (MappingFlag::InvalidateRange | MappingFlag::InvalidateBuffer | MappingFlag::Unsynchronised)) == MappingFlag::None, "tz::gl::Buffer<T>::map_range(", offset, ", ", size_bytes, ", ...): Invalidated or unsynchronised mappings cannot be read from. Use MappingPurpose::WriteOnly.");
+		topaz_assert(writes || (flags & MappingFlag::FlushExplicit) == MappingFlag::None, "tz::gl::Buffer<T>::map_range(", offset, ", ", size_bytes, ", ...): Explicitly-flushed mappings must be written to.");
+		GLbitfield access = to_access(purpose) | static_cast<GLbitfield>(flags);
+		if(this->is_terminal())
+			access |= terminal_mapping_access;
+		void* begin = glMapNamedBufferRange(this->handle, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size_bytes), access);
+		topaz_assert(begin != nullptr, "tz::gl::Buffer<T>::map_range(", offset, ", ", size_bytes, ", ...): Driver failed to map the range");
+		tz::mem::Block blk{begin, size_bytes};
+		if(begin != nullptr)
+			this->mapping = Mapping{blk, offset, flags};
+		return blk;
+	}
+
+	void IBuffer::flush_range(std::size_t offset, std::size_t size_bytes)
+	{
+		IBuffer::verify();
+		topaz_assert(this->is_mapped() && (this->mapping.value().flags & MappingFlag::FlushExplicit) != MappingFlag::None, "tz::gl::Buffer<T>::flush_range(", offset, ", ", size_bytes, "): Buffer is not mapped with MappingFlag::FlushExplicit");
+		topaz_assert(offset + size_bytes <= this->mapping.value().block.size(), "tz::gl::Buffer<T>::flush_range(", offset, ", ", size_bytes, "): Subrange does not fit within the mapped range of size ", this->mapping.value().block.size());
+		glFlushMappedNamedBufferRange(this->handle, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size_bytes));
+	}
+
 	void IBuffer::unmap()
 	{
 		IBuffer::verify();
+		// Mapping an empty buffer may hand out a null block without mapping anything, in which case there's nothing to unmap.
+		if(!this->is_mapped() && this->size() == 0)
+			return;
 		topaz_assert(this->is_mapped(), "tz::gl::Buffer<T>::unmap(): Attempted to unmap but we weren't already mapped");
 		// We know for sure that we have a valid handle, it is currently bound and we're definitely mapped.
 		glUnmapNamedBuffer(this->handle);
+		this->mapping = std::nullopt;
 	}
 
 	bool IBuffer::is_mapped() const
 	{
 		IBuffer::verify();
-		GLint param;
-		glGetNamedBufferParameteriv(this->handle, GL_BUFFER_MAPPED, &param);
-		return param == GL_TRUE ? true : false;
+		this->verify_state();
+		return this->mapping.has_value();
 	}
 	
 	bool IBuffer::operator==(BufferHandle handle) const
@@ -205,6 +299,57 @@ namespace tz::gl
 		#endif
 	}
 
+	void IBuffer::verify_state() const
+	{
+		#if TOPAZ_GL_VERIFY_BUFFER_STATE
+			GLint size, immutable, mapped;
+			GLint64 map_offset, map_length;
+			glGetNamedBufferParameteriv(this->handle, GL_BUFFER_SIZE, &size);
+			glGetNamedBufferParameteriv(this->handle, GL_BUFFER_IMMUTABLE_STORAGE, &immutable);
+			glGetNamedBufferParameteriv(this->handle, GL_BUFFER_MAPPED, &mapped);
+			glGetNamedBufferParameteri64v(this->handle, GL_BUFFER_MAP_OFFSET, &map_offset);
+			glGetNamedBufferParameteri64v(this->handle, GL_BUFFER_MAP_LENGTH, &map_length);
+			topaz_assert(this->size_bytes <= this->capacity_bytes, "IBuffer::verify_state(): Tracked size (", this->size_bytes, " bytes) exceeds the tracked capacity (", this->capacity_bytes, " bytes).");
+			topaz_assert(static_cast<std::size_t>(size) == this->capacity_bytes, "IBuffer::verify_state(): Tracked capacity (", this->capacity_bytes, " bytes) does not match the driver (", size, " bytes). Was the buffer modified without going through tz::gl::IBuffer?");
+			topaz_assert((immutable != GL_FALSE) == this->terminal, "IBuffer::verify_state(): Tracked terminality (", this->terminal, ") does not match the driver (", immutable, "). Was the buffer modified without going through tz::gl::IBuffer?");
+			topaz_assert((mapped != GL_FALSE) == this->mapping.has_value(), "IBuffer::verify_state(): Tracked mapping state (", this->mapping.has_value(), ") does not match the driver (", mapped, "). Was the buffer modified without going through tz::gl::IBuffer?");
+			if(this->mapping.has_value())
+			{
+				// Mapping a non-terminal buffer in full maps its entire data-store, which may extend past the block's size.
+				const bool whole_store = this->mapping.value().offset == 0 && static_cast<std::size_t>(map_length) == this->capacity_bytes;
+				const bool range_matches = static_cast<std::size_t>(map_offset) == this->mapping.value().offset && static_cast<std::size_t>(map_length) == this->mapping.value().block.size();
+				topaz_assert(whole_store || range_matches, "IBuffer::verify_state(): Tracked mapped range (offset ", this->mapping.value().offset, ", ", this->mapping.value().block.size(), " bytes) does not match the driver (offset ", map_offset, ", ", map_length, " bytes).");
+			}
+		#endif
+	}
+
+	void IBuffer::reallocate(std::size_t capacity_bytes)
+	{
+		// Respecifying the data-store discards its contents, so park the data in use in a scratch buffer first. Both copies stay in VRAM. Reusing our own handle (rather than swapping in the scratch buffer) keeps any vertex array or indexed binding which refers to this buffer valid.
+		const std::size_t preserved_bytes = std::min(this->size_bytes, capacity_bytes);
+		BufferHandle scratch = 0;
+		if(preserved_bytes > 0)
+		{
+			glCreateBuffers(1, &scratch);
+			glNamedBufferStorage(scratch, static_cast<GLsizeiptr>(preserved_bytes), nullptr, 0);
+			glCopyNamedBufferSubData(this->handle, scratch, 0, 0, static_cast<GLsizeiptr>(preserved_bytes));
+		}
+		glNamedBufferData(this->handle, static_cast<GLsizeiptr>(capacity_bytes), nullptr, static_cast<GLenum>(this->usage));
+		if(preserved_bytes > 0)
+		{
+			glCopyNamedBufferSubData(scratch, this->handle, 0, 0, static_cast<GLsizeiptr>(preserved_bytes));
+			glDeleteBuffers(1, &scratch);
+		}
+		this->set_capacity(capacity_bytes);
+	}
+
+	void IBuffer::set_capacity(std::size_t capacity_bytes)
+	{
+		tz::mem::tracking::record_free(tz::mem::tracking::Tag::GL, this->capacity_bytes);
+		tz::mem::tracking::record_allocation(tz::mem::tracking::Tag::GL, capacity_bytes);
+		this->capacity_bytes = capacity_bytes;
+	}
+
 	// Remember: SSBO == Buffer<BufferType::ShaderStorage>
 	SSBO::Buffer(std::size_t layout_qualifier_id): IBuffer(), layout_qualifier_id(layout_qualifier_id)
 	{
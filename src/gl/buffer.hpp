@@ -6,6 +6,7 @@
 #define TOPAZ_GL_BUFFER_HPP
 #include "glad/glad.h"
 #include "memory/pool.hpp"
+#include <optional>
 
 namespace tz::gl
 {
@@ -54,6 +55,27 @@ namespace tz::gl
 		ReadWrite = GL_READ_WRITE
 	};
 
+	/**
+	 * Optional behaviours for mapping a range of a buffer via IBuffer::map_range. These can be combined with operator|.
+	 * In OpenGL nomenclature, these correspond to the GL_MAP_*_BIT access flags of glMapBufferRange.
+	 */
+	enum class MappingFlag : GLbitfield
+	{
+		/// Map the range with no additional behaviour.
+		None = 0,
+		/// The previous contents of the mapped range may be discarded, so the driver needn't copy them back to the mapping.
+		InvalidateRange = GL_MAP_INVALIDATE_RANGE_BIT,
+		/// The previous contents of the entire buffer may be discarded. This allows the driver to orphan the data-store rather than wait for pending draws to finish using it.
+		InvalidateBuffer = GL_MAP_INVALIDATE_BUFFER_BIT,
+		/// The driver will not wait for pending operations on the buffer before mapping. It is then the caller's responsibility not to modify data which is still in use.
+		Unsynchronised = GL_MAP_UNSYNCHRONIZED_BIT,
+		/// Writes are only guaranteed to reach the data-store once they are flushed via IBuffer::flush_range, rather than the entire range being flushed upon unmapping.
+		FlushExplicit = GL_MAP_FLUSH_EXPLICIT_BIT
+	};
+
+	MappingFlag operator|(MappingFlag lhs, MappingFlag rhs);
+	MappingFlag operator&(MappingFlag lhs, MappingFlag rhs);
+
 	using BufferHandle = GLuint;
 
 	/**
@@ -62,6 +84,11 @@ namespace tz::gl
 	 * 
 	 * There are many different types of buffers. This class only encompasses behaviour which is shared by all buffer types. All buffers can be bound, unbound, mapped, unmapped.
 	 * Note: This is not strictly true -- The concept of buffer size and resizing is only available to a few buffer types. This should be refactored out.
+	 *
+	 * Non-terminal buffers distinguish between their size (the number of bytes in use) and their capacity (the size of the data-store in VRAM). Growing a buffer via safe_resize grows its capacity geometrically and migrates the data GPU-side, so appending to a buffer piece by piece only copies a linear amount of data in total and never reads it back into system memory.
+	 *
+	 * The size, capacity, terminality and mapping state of the buffer are tracked CPU-side as they are changed, so querying them never waits on the driver. This relies on the buffer only ever being modified through this interface.
+	 * If TOPAZ_GL_VERIFY_BUFFER_STATE is enabled, every such query asserts that the tracked state matches the driver's state. This is slow, so is off by default.
 	 */
 	class IBuffer
 	{
@@ -93,10 +120,18 @@ namespace tz::gl
 		 * Note: This doesn't really belong in the interface. This will fail unless the BufferType is one of the following:
 		 * - BufferType::Array
 		 * - BufferType::Index
+		 * Note: This does not query the driver.
 		 * Precondition: Requires the buffer to be valid.
 		 * @return Size of the buffer, in bytes.
 		 */
 		std::size_t size() const;
+		/**
+		 * Retrieve the size of the data-store in VRAM, in bytes. The buffer can grow to this size via safe_resize without reallocating.
+		 * Note: This does not query the driver.
+		 * Precondition: Requires the buffer to be valid.
+		 * @return Capacity of the buffer, in bytes. This is never less than this->size().
+		 */
+		std::size_t capacity() const;
 		/**
 		 * Query as to whether the buffer is empty or not. Buffers are empty if their size is 0 bytes.
 		 * 
@@ -107,6 +142,7 @@ namespace tz::gl
 		/**
 		 * Query as to whether the buffer is terminal or not. Buffers are terminal if their underlying storage is immutable and thus cannot be resized.
 		 * Note: Once a buffer is terminal, it will remain terminal for the remainder of its lifetime. This means that any Buffer can become terminal, but terminal Buffers cannot become non-terminal.
+		 * Note: This does not query the driver.
 		 * Precondition: Requires the buffer to be valid.
 		 * @return True if the buffer is terminal, otherwise false.
 		 */
@@ -124,16 +160,28 @@ namespace tz::gl
 		 * 
 		 * Precondition: Requires the buffer to be valid, nonterminal and unmapped.
 		 * Note: This will not preserve any of the data within the buffer. You should use safe_resize for that.
+		 * Note: The data-store is reallocated to exactly this size, so afterwards the capacity is equal to the size.
 		 * @param size_bytes Desired new size of the buffer, in bytes.
+		 * @param usage Usage hint for the data-store. Any subsequent reallocations made by reserve or safe_resize use the same hint.
 		 */
 		void resize(std::size_t size_bytes, BufferUsage usage = BufferUsage::StaticDraw);
 		/**
 		 * Attempt to change the size of the buffer, whilst preserving all data within the buffer in the process.
 		 * 
 		 * Note: You can assume that this will early-out if size_bytes is equal to this->size().
+		 * Note: If size_bytes is no greater than this->capacity(), the data-store is left untouched and only the size changes. Otherwise, the capacity grows to at least double its previous value, and the existing data is copied GPU-side into the new data-store.
 		 * Precondition: Requires the buffer to be valid, nonterminal and unmapped. Note that it is not an error to call safe_resize on a terminal buffer if the size parameter is equal to this->size(). This behaviour is not shared by this->resize().
+		 * @param size_bytes Desired new size of the buffer, in bytes.
 		 */
 		void safe_resize(std::size_t size_bytes);
+		/**
+		 * Ensure that the buffer can grow to the given size via safe_resize without reallocating. This does not change the size of the buffer, and preserves all data within it.
+		 *
+		 * Note: This will early-out if capacity_bytes is no greater than this->capacity().
+		 * Precondition: Requires the buffer to be valid, nonterminal and unmapped.
+		 * @param capacity_bytes Minimum desired capacity of the buffer, in bytes.
+		 */
+		void reserve(std::size_t capacity_bytes);
 		/**
 		 * Retrieve a subset of the data-store.
 		 * 
@@ -204,18 +252,44 @@ namespace tz::gl
 		 * Make the Buffer terminal without affecting its size.
 		 * 
 		 * Precondition: Requires the buffer to be valid, bound, non-terminal and unmapped.
-		 * Note: This will preserve the data within the buffer.
+		 * Note: This will preserve the data within the buffer. Any spare capacity is released, as terminal buffers cannot grow.
 		 */
 		void make_terminal();
 		/**
 		 * Map the buffer, providing a contiguous data block that can be used from the calling code.
 		 * 
 		 * Precondition: Requires the buffer to be valid.
-		 * Note: When a buffer is mapped, the memory block is cached. If the buffer is mapped a second time without unmapping prior, the cached value is returned.
+		 * Precondition: If the buffer is already mapped, the existing mapping must cover the whole buffer, rather than a subrange mapped via IBuffer::map_range. Otherwise, this will assert and a null block is returned.
+		 * Note: When a buffer is mapped, the memory block is cached by the buffer. If the buffer is mapped a second time without unmapping prior, the cached value is returned.
+		 * Note: If the buffer is empty, the driver may refuse to map it. In this case, a null block is returned and the buffer is not considered mapped, but it is still safe to invoke IBuffer::unmap afterwards.
 		 * @param purpose Describes what the desired use for the data is. This is an optimisation measure. If you don't intend to edit the data, providing MappingPurpose::ReadOnly will be a performance boon. The default purpose allows reading + writing.
 		 * @return Memory Block containing arbitrary data. The properties of this data are not guaranteed to be consistent with that of normal RAM. For example, this might be order of magnitudes slower than normal RAM.
 		 */
 		tz::mem::Block map(MappingPurpose purpose = MappingPurpose::ReadWrite);
+		/**
+		 * Map a range of the buffer, providing a contiguous data block corresponding to that range.
+		 * 
+		 * Mapping only the range which is going to be updated means that the driver needn't synchronise the rest of the buffer. Any number of buffers may be mapped at once, but each buffer may only have one mapping at a time.
+		 * Precondition: Requires the buffer to be valid and unmapped.
+		 * Precondition: offset + size_bytes must be less than or equal to this->size(), and size_bytes must be non-zero. Otherwise, this will assert and invoke UB.
+		 * Precondition: MappingFlag::InvalidateRange, MappingFlag::InvalidateBuffer and MappingFlag::Unsynchronised cannot be combined with MappingPurpose::ReadOnly or MappingPurpose::ReadWrite, and MappingFlag::FlushExplicit requires a purpose which allows writing. Otherwise, this will assert and invoke UB.
+		 * Note: Terminal buffers are always mapped persistently and coherently, as with IBuffer::map.
+		 * @param offset Offset from the beginning of the data-store to the start of the range, in bytes.
+		 * @param size_bytes Size of the range, in bytes.
+		 * @param flags Additional behaviours for the mapping. See tz::gl::MappingFlag.
+		 * @param purpose Describes what the desired use for the data is. By default, the data can only be written to.
+		 * @return Memory Block corresponding to the mapped range. Its begin corresponds to the given offset within the data-store.
+		 */
+		tz::mem::Block map_range(std::size_t offset, std::size_t size_bytes, MappingFlag flags = MappingFlag::None, MappingPurpose purpose = MappingPurpose::WriteOnly);
+		/**
+		 * Indicate that a subrange of the current mapping has been written to, so that the driver sends it to the data-store.
+		 * 
+		 * Precondition: Requires the buffer to be mapped via IBuffer::map_range with MappingFlag::FlushExplicit. Otherwise, this will assert and invoke UB.
+		 * Precondition: offset + size_bytes must be less than or equal to the size of the mapped range. Otherwise, this will assert and invoke UB.
+		 * @param offset Offset from the beginning of the mapped range (not the data-store), in bytes.
+		 * @param size_bytes Size of the subrange to flush, in bytes.
+		 */
+		void flush_range(std::size_t offset, std::size_t size_bytes);
 		/**
 		 * Map the buffer, providing a memory pool to be used as an array of Ts.
 		 * 
@@ -229,13 +303,14 @@ namespace tz::gl
 		/**
 		 * Unmap the buffer, saving any edits to previously mapped data and sending it back to VRAM.
 		 * 
-		 * Precondition: Requires the buffer to be valid, bound and mapped.
+		 * Precondition: Requires the buffer to be valid, bound and mapped. Empty buffers need not be mapped, in which case this does nothing.
 		 * Note: This will also work for persistently-mapped-buffers (PMBs).
 		 */
 		void unmap();
 		/**
 		 * Query as to whether the buffer is currently mapped or not.
 		 * 
+		 * Note: This does not query the driver.
 		 * Precondition: Requires the buffer to be both valid and bound.
 		 * @return True if the buffer is mapped, otherwise false.
 		 */
@@ -244,12 +319,42 @@ namespace tz::gl
 		bool operator==(BufferHandle handle) const;
 		bool operator!=(BufferHandle handle) const;
 	protected:
+		/// Binds its buffer to targets other than that of the buffer's type.
+		friend class StreamingBuffer;
 		/// Asserts that the underlying handle is initialised.
 		void verify() const;
 		/// Asserts that this buffer is non-terminal.
 		void verify_nonterminal() const;
 
 		BufferHandle handle;
+	private:
+		/// Asserts that the tracked state matches the driver's state, if TOPAZ_GL_VERIFY_BUFFER_STATE is enabled. Otherwise, does nothing.
+		void verify_state() const;
+		/// Reallocate the data-store with the given capacity, preserving the data in use without it leaving VRAM.
+		void reallocate(std::size_t capacity_bytes);
+		/// Set the tracked capacity after the driver has allocated a new data-store, accounting the change to tz::mem::tracking::Tag::GL.
+		void set_capacity(std::size_t capacity_bytes);
+
+		/// Describes the current mapping of a buffer.
+		struct Mapping
+		{
+			/// Block returned to the caller.
+			tz::mem::Block block;
+			/// Offset of the mapped range from the beginning of the data-store, in bytes.
+			std::size_t offset;
+			MappingFlag flags;
+		};
+
+		/// Number of bytes of the data-store which are in use.
+		std::size_t size_bytes;
+		/// Size of the data-store, in bytes.
+		std::size_t capacity_bytes;
+		/// Usage hint passed to the driver whenever the data-store is reallocated.
+		BufferUsage usage;
+		/// Whether the data-store is immutable.
+		bool terminal;
+		/// The current mapping. If the buffer is not mapped, nullopt.
+		std::optional<Mapping> mapping;
 	};
 
 	/**
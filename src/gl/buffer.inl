@@ -36,12 +36,12 @@ namespace tz::gl
 	}
 
 	template<BufferType T>
-	Buffer<T>::Buffer(Buffer<T>&& move): IBuffer(move){}
+	Buffer<T>::Buffer(Buffer<T>&& move): IBuffer(std::move(move)){}
 
 	template<BufferType T>
 	Buffer<T>& Buffer<T>::operator=(Buffer<T>&& rhs)
 	{
-		return static_cast<Buffer<T>&>(IBuffer::operator=(rhs));
+		return static_cast<Buffer<T>&>(IBuffer::operator=(std::move(rhs)));
 	}
 
 	template<BufferType T>
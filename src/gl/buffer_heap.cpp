@@ -0,0 +1,104 @@
+#include "gl/buffer_heap.hpp"
+#include "gl/manager.hpp"
+#include "core/debug/assert.hpp"
+#include <cstring>
+
+namespace tz::gl
+{
+	BufferHeap::BufferHeap(std::size_t vertex_capacity, std::size_t index_capacity): o(), data_handle(o.emplace_buffer<tz::gl::BufferType::Array>()), index_handle(o.emplace_buffer<tz::gl::BufferType::Index>()), vertex_allocator(vertex_capacity), index_allocator(index_capacity), vertex_mapping(tz::mem::Block::null()), index_mapping(tz::mem::Block::null()), mesh_info_map()
+	{
+		tz::gl::detail::format_standard_vertex(this->o, this->data_handle);
+		tz::gl::VBO* vbo = this->o.get<tz::gl::BufferType::Array>(this->data_handle);
+		tz::gl::IBO* ibo = this->o.get<tz::gl::BufferType::Index>(this->index_handle);
+		vbo->terminal_resize(vertex_capacity * sizeof(tz::gl::Vertex));
+		ibo->terminal_resize(index_capacity * sizeof(tz::gl::Index));
+		// Terminal buffers are persistently mapped and coherent, so we can write straight into them for the rest of our lifetime.
+		this->vertex_mapping = vbo->map();
+		this->index_mapping = ibo->map();
+	}
+
+	std::optional<BufferHeap::Handle> BufferHeap::add_mesh(const tz::gl::IndexedMesh& data)
+	{
+		topaz_assert(!data.vertices.empty() && !data.indices.empty(), "tz::gl::BufferHeap::add_mesh(...): Mesh must have at least one vertex and index. Vertices: ", data.vertices.size(), ", Indices: ", data.indices.size());
+		if(data.vertices.empty() || data.indices.empty())
+			return std::nullopt;
+		std::optional<tz::mem::OffsetAllocation> vertices = this->vertex_allocator.allocate(data.vertices.size());
+		if(!vertices.has_value())
+			return std::nullopt;
+		std::optional<tz::mem::OffsetAllocation> indices = this->index_allocator.allocate(data.indices.size());
+		if(!indices.has_value())
+		{
+			this->vertex_allocator.free(vertices.value());
+			return std::nullopt;
+		}
+
+		auto* vertex_begin = static_cast<char*>(this->vertex_mapping.begin) + (vertices->offset * sizeof(tz::gl::Vertex));
+		std::memcpy(vertex_begin, data.vertices.data(), data.data_size_bytes());
+		auto* index_begin = static_cast<char*>(this->index_mapping.begin) + (indices->offset * sizeof(tz::gl::Index));
+		std::memcpy(index_begin, data.indices.data(), data.indices_size_bytes());
+
+		return this->mesh_info_map.emplace(MeshInfo{vertices.value(), indices.value()});
+	}
+
+	void BufferHeap::remove_mesh(Handle handle)
+	{
+		topaz_assert(this->mesh_info_map.contains(handle), "tz::gl::BufferHeap::remove_mesh(", handle, "): This heap has no knowledge of this handle.");
+		if(!this->mesh_info_map.contains(handle))
+			return;
+		const MeshInfo& info = this->mesh_info_map[handle];
+		this->vertex_allocator.free(info.vertices);
+		this->index_allocator.free(info.indices);
+		this->mesh_info_map.erase(handle);
+	}
+
+	std::size_t BufferHeap::get_vertices_offset(Handle handle) const
+	{
+		return this->info(handle).vertices.offset;
+	}
+
+	std::size_t BufferHeap::get_indices_offset(Handle handle) const
+	{
+		return this->info(handle).indices.offset;
+	}
+
+	std::size_t BufferHeap::get_number_of_vertices(Handle handle) const
+	{
+		return this->info(handle).vertices.size;
+	}
+
+	std::size_t BufferHeap::get_number_of_indices(Handle handle) const
+	{
+		return this->info(handle).indices.size;
+	}
+
+	tz::mem::OffsetAllocatorStats BufferHeap::vertex_stats() const
+	{
+		return this->vertex_allocator.stats();
+	}
+
+	tz::mem::OffsetAllocatorStats BufferHeap::index_stats() const
+	{
+		return this->index_allocator.stats();
+	}
+
+	tz::gl::Object& BufferHeap::operator*()
+	{
+		return this->o;
+	}
+
+	const tz::gl::Object& BufferHeap::operator*() const
+	{
+		return this->o;
+	}
+
+	std::size_t BufferHeap::get_indices() const
+	{
+		return this->index_handle;
+	}
+
+	const BufferHeap::MeshInfo& BufferHeap::info(Handle handle) const
+	{
+		topaz_assert(this->mesh_info_map.contains(handle), "tz::gl::BufferHeap: This heap has no knowledge of the handle ", handle, ". Cannot retrieve information about this handle...");
+		return this->mesh_info_map[handle];
+	}
+}
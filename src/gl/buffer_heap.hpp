@@ -0,0 +1,108 @@
+#ifndef TOPAZ_GL_BUFFER_HEAP_HPP
+#define TOPAZ_GL_BUFFER_HEAP_HPP
+#include "gl/object.hpp"
+#include "gl/mesh.hpp"
+#include "memory/offset_allocator.hpp"
+#include "memory/slot_map.hpp"
+#include <optional>
+
+namespace tz::gl
+{
+	/**
+	 * \addtogroup tz_gl Topaz Graphics Library (tz::gl)
+	 * @{
+	 */
+
+	/**
+	 * Shared geometry heap. Owns a single fixed-size terminal vertex-buffer and index-buffer, and sub-allocates ranges of them for individual meshes.
+	 * Unlike a tz::gl::Manager, meshes can be removed and their space re-used. All meshes in a heap can be drawn by a single MDI render-invocation.
+	 * Contains:
+	 * - Data Buffer (terminal)
+	 * - Indices Buffer (terminal)
+	 */
+	class BufferHeap
+	{
+	public:
+		/// Generational handle. See tz::mem::SlotMap.
+		using Handle = std::size_t;
+
+		/**
+		 * Construct a heap with the given fixed capacities. The underlying buffers are created, made terminal and mapped immediately.
+		 * @param vertex_capacity Maximum number of vertices which can reside in the heap at once.
+		 * @param index_capacity Maximum number of indices which can reside in the heap at once.
+		 */
+		BufferHeap(std::size_t vertex_capacity, std::size_t index_capacity);
+		/**
+		 * Copy the data of an indexed mesh into free space within the heap.
+		 * Note: Indices are not rebased. They remain relative to the mesh's first vertex; the vertex offset is applied at draw-time.
+		 * Precondition: The mesh has at least one vertex and one index. Otherwise, this will assert and return null.
+		 * @param data Indexed mesh data to copy into the heap.
+		 * @return Opaque handle corresponding to the copied mesh data. If there is not enough contiguous free space, null.
+		 */
+		std::optional<Handle> add_mesh(const tz::gl::IndexedMesh& data);
+		/**
+		 * Free the space occupied by the mesh data associated with the given handle. This space may be re-used by subsequent invocations of add_mesh(...).
+		 * Precondition: The given handle has previously been created by this heap and not yet removed. Otherwise, this will assert and do nothing.
+		 * Precondition: No in-flight render-invocation is still reading from the mesh. Otherwise, this will invoke UB without asserting.
+		 * @param handle Handle whose mesh data should be freed.
+		 */
+		void remove_mesh(Handle handle);
+		/**
+		 * Retrieve the number of vertices preceding the first vertex of the mesh data associated with the given handle.
+		 * @param handle Handle whose mesh data offset should be retrieved.
+		 * @return Vertex offset of the mesh data.
+		 */
+		std::size_t get_vertices_offset(Handle handle) const;
+		std::size_t get_indices_offset(Handle handle) const;
+		/**
+		 * Retrieve the number of vertices corresponding to the mesh data associated with the given handle.
+		 * @param handle Handle whose mesh data size should be retrieved.
+		 * @return Number of vertices comprising the mesh data.
+		 */
+		std::size_t get_number_of_vertices(Handle handle) const;
+		std::size_t get_number_of_indices(Handle handle) const;
+		/**
+		 * Retrieve statistics about the vertex-buffer sub-allocator. All quantities are in vertices.
+		 * @return Vertex allocator statistics.
+		 */
+		tz::mem::OffsetAllocatorStats vertex_stats() const;
+		/**
+		 * Retrieve statistics about the index-buffer sub-allocator. All quantities are in indices.
+		 * @return Index allocator statistics.
+		 */
+		tz::mem::OffsetAllocatorStats index_stats() const;
+		/**
+		 * Retrieve the underlying tz::gl::Object.
+		 * Note: Resizing, unmapping or erasing the heap's own buffers will invoke UB without asserting.
+		 */
+		tz::gl::Object& operator*();
+		const tz::gl::Object& operator*() const;
+		/**
+		 * Retrieve a handle corresponding to the internal index-buffer handle used by this heap.
+		 */
+		std::size_t get_indices() const;
+	private:
+		struct MeshInfo
+		{
+			tz::mem::OffsetAllocation vertices;
+			tz::mem::OffsetAllocation indices;
+		};
+
+		const MeshInfo& info(Handle handle) const;
+
+		tz::gl::Object o;
+		std::size_t data_handle;
+		std::size_t index_handle;
+		tz::mem::OffsetAllocator vertex_allocator;
+		tz::mem::OffsetAllocator index_allocator;
+		tz::mem::Block vertex_mapping;
+		tz::mem::Block index_mapping;
+		tz::mem::SlotMap<MeshInfo> mesh_info_map;
+	};
+
+	/**
+	 * @}
+	 */
+}
+
+#endif // TOPAZ_GL_BUFFER_HEAP_HPP
@@ -9,6 +9,8 @@ namespace tz::gl
 {
 	MDIDrawCommandList::MDIDrawCommandList(std::initializer_list<Command> cmds): cmds(cmds){}
 
+	MDIDrawCommandList::MDIDrawCommandList(std::pmr::memory_resource* resource): cmds(resource){}
+
 	const MDIDrawCommandList::Command* MDIDrawCommandList::data() const
 	{
 		return this->cmds.data();
@@ -47,6 +49,11 @@ namespace tz::gl
 		return this->cmds.size() - 1;
 	}
 
+	void MDIDrawCommandList::reserve(std::size_t capacity)
+	{
+		this->cmds.reserve(capacity);
+	}
+
 	void MDIDrawCommandList::erase(std::size_t idx)
 	{
 		topaz_assert(idx < this->cmds.size(), "MDIDrawCommandList::operator[", idx, "]: Index ", idx, " was out of range! Size: ", this->size());
@@ -3,6 +3,7 @@
 #include "glad/glad.h"
 #include <cstdint>
 #include <initializer_list>
+#include <memory_resource>
 #include <vector>
 
 namespace tz::gl
@@ -46,6 +47,11 @@ namespace tz::gl
 		 * @cmds Command list to begin with.
 		 */
 		MDIDrawCommandList(std::initializer_list<Command> cmds = {});
+		/**
+		 * Construct an empty command list whose storage is allocated from the given memory resource.
+		 * @param resource Memory resource to allocate commands from. Must outlive the list.
+		 */
+		MDIDrawCommandList(std::pmr::memory_resource* resource);
 		/**
 		 * Retrieve a pointer to the first element in the list.
 		 * 
@@ -95,6 +101,12 @@ namespace tz::gl
 		 * @return Index corresponding to the newly-created command in the list.
 		 */
 		std::size_t add(Command cmd);
+		/**
+		 * Ensure that the list can store at least the given number of commands without reallocating.
+		 * 
+		 * @param capacity Minimum number of commands to reserve storage for.
+		 */
+		void reserve(std::size_t capacity);
 		/**
 		 * Erase the command corresponding to the given index.
 		 * 
@@ -105,7 +117,7 @@ namespace tz::gl
 		 */
 		void erase(std::size_t idx);
 	private:
-		std::vector<Command> cmds;
+		std::pmr::vector<Command> cmds;
 	};
 
 	/**
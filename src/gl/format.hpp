@@ -21,10 +21,27 @@ namespace tz::gl
 		std::size_t num_components;
 		/// OpenGL enum type corresponding to the type of each component (such as GL_FLOAT).
 		GLenum component_type;
-		/// Size of one component type, in bytes.
+		/// Size of one component type, in bytes. For packed types (such as GL_INT_2_10_10_10_REV), this is instead the size of all components together.
 		std::size_t component_size;
 		/// Offset, in bytes, that the data starts from the beginning of the buffer.
 		std::ptrdiff_t offset;
+		/// Whether integer components are normalised into [0, 1] (unsigned) or [-1, 1] (signed) when read by the shader. Otherwise they are converted to floats directly. Ignored for float component types.
+		GLboolean normalised = GL_FALSE;
+		/// Distance, in bytes, between the start of consecutive elements. Zero means the elements are tightly packed, which is the case unless the data is interleaved with other attributes.
+		std::size_t stride = 0;
+
+		/**
+		 * Retrieve the size of a single element, in bytes.
+		 * @return Size of all components of one element.
+		 */
+		constexpr std::size_t element_size() const
+		{
+			if(this->component_type == GL_INT_2_10_10_10_REV || this->component_type == GL_UNSIGNED_INT_2_10_10_10_REV)
+			{
+				return this->component_size;
+			}
+			return this->num_components * this->component_size;
+		}
 	};
 
 	namespace fmt
@@ -32,6 +49,21 @@ namespace tz::gl
 		/// Pre-defined format comprised of a trio of three floats, starting from the beginning of the buffer data.
 		constexpr Format three_floats = Format{3, GL_FLOAT, sizeof(float), 0};
 		constexpr Format two_floats = Format{2, GL_FLOAT, sizeof(float), 0};
+
+		/*
+		 * Compact formats, for vertex attributes which don't need full float precision. See tz::gl::PackedVertex.
+		 */
+
+		/// Two half-precision floats.
+		constexpr Format two_halves = Format{2, GL_HALF_FLOAT, 2, 0};
+		/// Four half-precision floats.
+		constexpr Format four_halves = Format{4, GL_HALF_FLOAT, 2, 0};
+		/// Two 16-bit unsigned integers, read by the shader as floats within [0, 1].
+		constexpr Format two_unorm16 = Format{2, GL_UNSIGNED_SHORT, 2, 0, GL_TRUE};
+		/// Two 16-bit signed integers, read by the shader as floats within [-1, 1].
+		constexpr Format two_snorm16 = Format{2, GL_SHORT, 2, 0, GL_TRUE};
+		/// Three 10-bit and one 2-bit signed integers packed into 32 bits, read by the shader as a vec4 within [-1, 1].
+		constexpr Format snorm_10_10_10_2 = Format{4, GL_INT_2_10_10_10_REV, 4, 0, GL_TRUE};
 	}
 
 	/**
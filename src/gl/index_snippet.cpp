@@ -5,6 +5,7 @@ namespace tz::gl
 {
 	IndexSnippet::IndexSnippet(std::size_t begin, std::size_t end, std::size_t offset): begin(begin), end(end), index_offset(offset){}
 	IndexSnippet::IndexSnippet(const tz::gl::Manager& manager, tz::gl::Manager::Handle mesh_handle): IndexSnippet(manager.get_indices_offset(mesh_handle), manager.get_indices_offset(mesh_handle) + manager.get_number_of_indices(mesh_handle), manager.get_vertices_offset(mesh_handle)){}
+	IndexSnippet::IndexSnippet(const tz::gl::BufferHeap& heap, tz::gl::BufferHeap::Handle mesh_handle): IndexSnippet(heap.get_indices_offset(mesh_handle), heap.get_indices_offset(mesh_handle) + heap.get_number_of_indices(mesh_handle) - 1, heap.get_vertices_offset(mesh_handle)){}
 
 	gpu::DrawElementsIndirectCommand IndexSnippet::mdi() const
 	{
@@ -44,9 +45,16 @@ namespace tz::gl
 		return this->snippets.size() - 1;
 	}
 
-	tz::gl::MDIDrawCommandList IndexSnippetList::get_command_list() const
+	std::size_t IndexSnippetList::emplace_range(const tz::gl::BufferHeap& heap, tz::gl::BufferHeap::Handle mesh_handle)
 	{
-		tz::gl::MDIDrawCommandList cmds;
+		this->snippets.emplace_back(heap, mesh_handle);
+		return this->snippets.size() - 1;
+	}
+
+	tz::gl::MDIDrawCommandList IndexSnippetList::get_command_list(std::pmr::memory_resource* resource) const
+	{
+		tz::gl::MDIDrawCommandList cmds{resource};
+		cmds.reserve(this->snippets.size());
 		for(const IndexSnippet& snippet : this->snippets)
 		{
 			cmds.add(snippet.mdi());
@@ -1,10 +1,12 @@
 #ifndef TOPAZ_GL_INDEX_SNIPPET_HPP
 #define TOPAZ_GL_INDEX_SNIPPET_HPP
 #include <cstdint>
+#include <memory_resource>
 #include <utility>
 #include <vector>
 #include "gl/draw_command.hpp"
 #include "gl/manager.hpp"
+#include "gl/buffer_heap.hpp"
 
 namespace tz::gl
 {
@@ -17,6 +19,7 @@ namespace tz::gl
 	{
 		IndexSnippet(std::size_t begin, std::size_t end, std::size_t offset);
 		IndexSnippet(const tz::gl::Manager& manager, tz::gl::Manager::Handle mesh_handle);
+		IndexSnippet(const tz::gl::BufferHeap& heap, tz::gl::BufferHeap::Handle mesh_handle);
 
 		gpu::DrawElementsIndirectCommand mdi() const;
 		
@@ -60,11 +63,13 @@ namespace tz::gl
 		std::size_t emplace_range(std::size_t begin, std::size_t end);
 		std::size_t emplace_range(std::size_t begin, std::size_t end, std::size_t index_offset);
 		std::size_t emplace_range(const tz::gl::Manager& manager, tz::gl::Manager::Handle mesh_handle);
+		std::size_t emplace_range(const tz::gl::BufferHeap& heap, tz::gl::BufferHeap::Handle mesh_handle);
 		/**
 		 * Using the current ranges within this command-list, retrieve an MDI command list which can be used in a render-invocation.
+		 * @param resource Memory resource from which the command list's storage is allocated. By default, this is the global heap.
 		 * @return Render-ready MDI command list.
 		 */
-		tz::gl::MDIDrawCommandList get_command_list() const;
+		tz::gl::MDIDrawCommandList get_command_list(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
 		/**
 		 * Retrieve the nth index snippet.
 		 * Precondition: idx < this->size(). Otherwise, this will assert and invoke UB.
@@ -73,7 +78,7 @@ namespace tz::gl
 		 */
 		const IndexSnippet& operator[](std::size_t idx) const;
 	private:
-		std::vector<IndexSnippet> snippets;
+		std::pmr::vector<IndexSnippet> snippets;
 	};
 
 	/**
@@ -2,21 +2,19 @@
 
 namespace tz::gl
 {
+	namespace
+	{
+		tz::geo::Bounds bound_vertices(const tz::gl::Vertex* first, std::size_t count)
+		{
+			if(count == 0)
+				return tz::geo::bound(nullptr, 0, sizeof(tz::gl::Vertex));
+			return tz::geo::bound(&first->position, count, sizeof(tz::gl::Vertex));
+		}
+	}
+
 	Manager::Manager(): o(), data_handle(o.emplace_buffer<tz::gl::BufferType::Array>()), index_handle(o.emplace_buffer<tz::gl::BufferType::Index>())
 	{
-		// We have custom formats now.
-		std::size_t vertex_stride_bytes = sizeof(tz::gl::Vertex);
-		auto to_ptr = [](std::size_t offset)->const void*{return reinterpret_cast<const void*>(offset);};
-		// Position
-		o.format_custom(this->data_handle, 3, GL_FLOAT, GL_FALSE, vertex_stride_bytes, to_ptr(0));
-		// Texcoord
-		o.format_custom(this->data_handle, 2, GL_FLOAT, GL_FALSE, vertex_stride_bytes, to_ptr(sizeof(tz::Vec3)));
-		// Normal
-		o.format_custom(this->data_handle, 3, GL_FLOAT, GL_TRUE, vertex_stride_bytes, to_ptr(sizeof(tz::Vec3) + sizeof(tz::Vec2)));
-		// Tangent
-		o.format_custom(this->data_handle, 3, GL_FLOAT, GL_TRUE, vertex_stride_bytes, to_ptr(sizeof(tz::Vec3) + sizeof(tz::Vec2) + sizeof(tz::Vec3)));
-		// Bitangent
-		o.format_custom(this->data_handle, 3, GL_FLOAT, GL_TRUE, vertex_stride_bytes, to_ptr(sizeof(tz::Vec3) + sizeof(tz::Vec2) + sizeof(tz::Vec3) + sizeof(tz::Vec3)));
+		tz::gl::detail::format_standard_vertex(this->o, this->data_handle);
 	}
 
 	Manager::Handle Manager::add_mesh(tz::gl::IndexedMesh data)
@@ -56,41 +54,54 @@ namespace tz::gl
 		}
 
 		// Make sure we start tracking this properly.
-		MeshInfo info{cur_offset_vertices, indices_offset_indices, mesh_size_vertices, mesh_size_indices};
-		Handle handle = this->mesh_info_map.size();
-		this->mesh_info_map.emplace(handle, info);
-
-		return handle;
+		MeshInfo info{cur_offset_vertices, indices_offset_indices, mesh_size_vertices, mesh_size_indices, bound_vertices(data.vertices.data(), data.vertices.size())};
+		return this->mesh_info_map.emplace(info);
 	}
 
 	std::size_t Manager::get_vertices_offset(Handle handle) const
 	{
-		topaz_assert(this->mesh_info_map.count(handle) == 1, "tz::gl::Manager::get_vertices_offset(Handle): This Manager has no knowledge of this handle ", handle, ". Cannot retrieve information about this handle...");
-		return this->mesh_info_map.at(handle).offset_vertices;
+		topaz_assert(this->mesh_info_map.contains(handle), "tz::gl::Manager::get_vertices_offset(Handle): This Manager has no knowledge of this handle ", handle, ". Cannot retrieve information about this handle...");
+		return this->mesh_info_map[handle].offset_vertices;
 	}
 
 	std::size_t Manager::get_indices_offset(Handle handle) const
 	{
-		topaz_assert(this->mesh_info_map.count(handle) == 1, "tz::gl::Manager::get_indices_offset(Handle): This Manager has no knowledge of this handle ", handle, ". Cannot retrieve information about this handle...");
-		return this->mesh_info_map.at(handle).offset_indices;
+		topaz_assert(this->mesh_info_map.contains(handle), "tz::gl::Manager::get_indices_offset(Handle): This Manager has no knowledge of this handle ", handle, ". Cannot retrieve information about this handle...");
+		return this->mesh_info_map[handle].offset_indices;
 	}
 
 	std::size_t Manager::get_number_of_vertices(Handle handle) const
 	{
-		topaz_assert(this->mesh_info_map.count(handle) == 1, "tz::gl::Manager::get_number_of_vertices(Handle): This Manager has no knowledge of this handle ", handle, ". Cannot retrieve information about this handle...");
-		return this->mesh_info_map.at(handle).size_vertices;
+		topaz_assert(this->mesh_info_map.contains(handle), "tz::gl::Manager::get_number_of_vertices(Handle): This Manager has no knowledge of this handle ", handle, ". Cannot retrieve information about this handle...");
+		return this->mesh_info_map[handle].size_vertices;
 	}
 
 	std::size_t Manager::get_number_of_indices(Handle handle) const
 	{
-		topaz_assert(this->mesh_info_map.count(handle) == 1, "tz::gl::Manager::get_number_of_indices(Handle): This Manager has no knowledge of this handle ", handle, ". Cannot retrieve information about this handle...");
-		return this->mesh_info_map.at(handle).size_indices;
+		topaz_assert(this->mesh_info_map.contains(handle), "tz::gl::Manager::get_number_of_indices(Handle): This Manager has no knowledge of this handle ", handle, ". Cannot retrieve information about this handle...");
+		return this->mesh_info_map[handle].size_indices;
+	}
+
+	const tz::geo::Bounds& Manager::get_bounds(Handle handle) const
+	{
+		topaz_assert(this->mesh_info_map.contains(handle), "tz::gl::Manager::get_bounds(Handle): This Manager has no knowledge of this handle ", handle, ". Cannot retrieve information about this handle...");
+		return this->mesh_info_map[handle].bounds;
 	}
 
 	typename Manager::Handle Manager::partition(Handle handle, std::size_t vertex_offset)
+	{
+		topaz_assert(this->mesh_info_map.contains(handle), "tz::gl::Manager::partition(", handle, ", ", vertex_offset, "): Manager does not know about handle '", handle, "' -- So cannot partition!");
+		std::vector<tz::gl::Vertex> vertices = this->retrieve_vertices(handle);
+		Handle remainder = this->partition_range(handle, vertex_offset);
+		this->mesh_info_map[handle].bounds = bound_vertices(vertices.data(), vertex_offset);
+		this->mesh_info_map[remainder].bounds = bound_vertices(vertices.data() + vertex_offset, vertices.size() - vertex_offset);
+		return remainder;
+	}
+
+	typename Manager::Handle Manager::partition_range(Handle handle, std::size_t vertex_offset)
 	{
 		// We require the given handle to already be managed.
-		topaz_assert(this->mesh_info_map.find(handle) != this->mesh_info_map.end(), "tz::gl::Manager::partition(", handle, ", ", vertex_offset, "): Manager does not know about handle '", handle, "' -- So cannot partition!");
+		topaz_assert(this->mesh_info_map.contains(handle), "tz::gl::Manager::partition(", handle, ", ", vertex_offset, "): Manager does not know about handle '", handle, "' -- So cannot partition!");
 		MeshInfo& info = this->mesh_info_map[handle];
 		std::size_t original_vertices_size = info.size_vertices;
 		std::size_t original_indices_size = info.size_indices;
@@ -99,15 +110,13 @@ namespace tz::gl
 		// Essentially we set our size to be equal to the offset, so that the new handle can manage the remainder of the vertices.
 		info.size_vertices = vertex_offset;
 		info.size_indices = vertex_offset;
-		Handle new_handle = this->mesh_info_map.size();
 		std::size_t new_offset_vertices = info.offset_vertices + info.size_vertices;
 		std::size_t new_offset_indices = info.offset_indices + info.size_indices;
 		// All the vertices which the first handle no longer owns, we will take.
 		std::size_t new_vertices_size = original_vertices_size - info.size_vertices;
 		std::size_t new_indices_size = original_indices_size - info.size_indices;
-		MeshInfo new_info{new_offset_vertices, new_offset_indices, new_vertices_size, new_indices_size};
-		this->mesh_info_map.emplace(new_handle, new_info);
-		return new_handle;
+		MeshInfo new_info{new_offset_vertices, new_offset_indices, new_vertices_size, new_indices_size, info.bounds};
+		return this->mesh_info_map.emplace(new_info);
 	}
 
 	std::vector<typename Manager::Handle> Manager::split(Handle handle, std::size_t stride_vertices)
@@ -120,10 +129,16 @@ namespace tz::gl
 		std::vector<typename Manager::Handle> daughter_handles;
 		daughter_handles.reserve(split_amount);
 		daughter_handles.push_back(handle);
+		// Read the vertices back once up-front. Partitioning one at a time would read back the whole remainder for every daughter.
+		std::vector<tz::gl::Vertex> vertices = this->retrieve_vertices(handle);
 		// Partition the main handle until we have an equal split in all.
 		for(std::size_t i = 0; i < split_amount - 1; i++)
 		{
-			daughter_handles.push_back(this->partition(daughter_handles.back(), stride_vertices));
+			daughter_handles.push_back(this->partition_range(daughter_handles.back(), stride_vertices));
+		}
+		for(std::size_t i = 0; i < split_amount; i++)
+		{
+			this->mesh_info_map[daughter_handles[i]].bounds = bound_vertices(vertices.data() + (i * stride_vertices), stride_vertices);
 		}
 		return std::move(daughter_handles);
 	}
@@ -143,6 +158,17 @@ namespace tz::gl
 		return this->index_handle;
 	}
 
+	std::vector<tz::gl::Vertex> Manager::retrieve_vertices(Handle handle) const
+	{
+		const MeshInfo& info = this->mesh_info_map[handle];
+		std::vector<tz::gl::Vertex> vertices(info.size_vertices);
+		if(!vertices.empty())
+		{
+			this->data()->retrieve(info.offset_vertices * sizeof(tz::gl::Vertex), info.size_vertices * sizeof(tz::gl::Vertex), vertices.data());
+		}
+		return vertices;
+	}
+
 	tz::gl::VBO* Manager::data()
 	{
 		return this->o.get<tz::gl::BufferType::Array>(this->data_handle);
@@ -162,4 +188,24 @@ namespace tz::gl
 	{
 		return this->o.get<tz::gl::BufferType::Index>(this->index_handle);
 	}
-}
\ No newline at end of file
+
+	namespace detail
+	{
+		void format_standard_vertex(tz::gl::Object& object, std::size_t data_handle)
+		{
+			// We have custom formats now.
+			std::size_t vertex_stride_bytes = sizeof(tz::gl::Vertex);
+			auto to_ptr = [](std::size_t offset)->const void*{return reinterpret_cast<const void*>(offset);};
+			// Position
+			object.format_custom(data_handle, 3, GL_FLOAT, GL_FALSE, vertex_stride_bytes, to_ptr(0));
+			// Texcoord
+			object.format_custom(data_handle, 2, GL_FLOAT, GL_FALSE, vertex_stride_bytes, to_ptr(sizeof(tz::Vec3)));
+			// Normal
+			object.format_custom(data_handle, 3, GL_FLOAT, GL_TRUE, vertex_stride_bytes, to_ptr(sizeof(tz::Vec3) + sizeof(tz::Vec2)));
+			// Tangent
+			object.format_custom(data_handle, 3, GL_FLOAT, GL_TRUE, vertex_stride_bytes, to_ptr(sizeof(tz::Vec3) + sizeof(tz::Vec2) + sizeof(tz::Vec3)));
+			// Bitangent
+			object.format_custom(data_handle, 3, GL_FLOAT, GL_TRUE, vertex_stride_bytes, to_ptr(sizeof(tz::Vec3) + sizeof(tz::Vec2) + sizeof(tz::Vec3) + sizeof(tz::Vec3)));
+		}
+	}
+}
@@ -6,7 +6,8 @@
 #define TOPAZ_GL_MANAGER_HPP
 #include "gl/object.hpp"
 #include "gl/mesh.hpp"
-#include <unordered_map>
+#include "geo/bounds.hpp"
+#include "memory/slot_map.hpp"
 
 namespace tz::gl
 {
@@ -25,6 +26,7 @@ namespace tz::gl
 	class Manager
 	{
 	public:
+		/// Generational handle. See tz::mem::SlotMap.
 		using Handle = std::size_t;
 
 		/**
@@ -33,6 +35,7 @@ namespace tz::gl
 		Manager();
 		/**
 		 * Copy the data of an indexed mesh into the Manager's internal buffers and retrieve a handle which can be used to ascertain the location of the data.
+		 * The bounding volumes of the mesh are computed at the same time. See get_bounds(Handle).
 		 * @param data Indexed mesh data to copy into the internal buffers.
 		 * @return Opaque handle corresponding to the copied mesh data.
 		 */
@@ -51,11 +54,19 @@ namespace tz::gl
 		 */
 		std::size_t get_number_of_vertices(Handle handle) const;
 		std::size_t get_number_of_indices(Handle handle) const;
+		/**
+		 * Retrieve the bounding volumes of the vertex positions corresponding to the indexed mesh data associated with the given handle.
+		 * Note: Bounds are computed from the data when it is added or partitioned. If you write to the data buffer directly, they will not be updated.
+		 * @param handle Handle whose mesh bounds should be retrieved.
+		 * @return Bounding box and sphere enclosing every vertex owned by the handle.
+		 */
+		const tz::geo::Bounds& get_bounds(Handle handle) const;
 		/**
 		 * Relinquish a handle's ownership of some or all of its internal mesh data.
 		 * 
 		 * Precondition: The given handle has previously been created by this Manager. Otherwise, this will assert and invoke UB.
 		 * Precondition: The vertex offset provided is smaller than the number of vertices occupied by the handle. Otherwise, this will assert and invoke UB.
+		 * Precondition: The data buffer is unmapped. The bounds of both handles are recomputed by reading back the vertices. Otherwise, this will assert and invoke UB.
 		 * Example Scenario:
 		 * [0, 1, 2, 3, 4, 5, 6, 7, 8, 9]
 		 * |----------------------------|
@@ -79,6 +90,7 @@ namespace tz::gl
 		 * Note: The daughter handles will also contain the initial handle. This is guaranteed to be its first element.
 		 * Precondition: Number of vertices occupied by the given handle is divisible by the stride. This is necessary to ensure that all daughters have the same vertex quantity. If not, this will assert and invoke UB.
 		 * Precondition: Stride must be greater than 0. Otherwise, this will invoke UB without asserting.
+		 * Precondition: The data buffer is unmapped. The bounds of every daughter are recomputed by reading back the vertices once. Otherwise, this will assert and invoke UB.
 		 * 
 		 * Example Scenario:
 		 * [0, 1, 2, 3, 4, 5]
@@ -127,6 +139,10 @@ namespace tz::gl
 		const tz::gl::VBO* data() const;
 		tz::gl::IBO* indices();
 		const tz::gl::IBO* indices() const;
+		/// Partition the handle's range without recomputing any bounds. Both handles keep the original bounds until the caller recomputes them.
+		Handle partition_range(Handle handle, std::size_t vertex_offset);
+		/// Read back every vertex owned by the handle from the data buffer.
+		std::vector<tz::gl::Vertex> retrieve_vertices(Handle handle) const;
 
 		struct MeshInfo
 		{
@@ -134,15 +150,24 @@ namespace tz::gl
 			std::size_t offset_indices;
 			std::size_t size_vertices;
 			std::size_t size_indices;
+			tz::geo::Bounds bounds;
 		};
 
 		tz::gl::Object o;
 		
 		std::size_t data_handle;
 		std::size_t index_handle;
-		std::unordered_map<Handle, MeshInfo> mesh_info_map;
+		tz::mem::SlotMap<MeshInfo> mesh_info_map;
 	};
 
+	namespace detail
+	{
+		/**
+		 * Format the vertex attributes of the given Object such that the buffer at data_handle is interpreted as an array of tz::gl::Vertex.
+		 */
+		void format_standard_vertex(tz::gl::Object& object, std::size_t data_handle);
+	}
+
 	/**
 	 * @}
 	 */
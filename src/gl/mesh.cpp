@@ -0,0 +1,225 @@
+#include "gl/mesh.hpp"
+#include "algo/job_system.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+namespace tz::gl
+{
+	namespace
+	{
+		/// Meshes with fewer triangles than this are always sorted on the calling thread.
+		constexpr std::size_t min_parallel_triangles = 1 << 16;
+		/// When sorting across a job system, each thread gets about this many chunks so that stealing can balance the load.
+		constexpr std::size_t chunks_per_thread = 4;
+		/// Meshes with this few triangles are comparison-sorted, as clearing the radix histograms would dominate.
+		constexpr std::size_t max_comparison_sort_triangles = 64;
+		/// Keys are 32-bit and sorted 11 bits at a time, so three passes cover them.
+		constexpr std::size_t digit_bits = 11;
+		constexpr std::size_t digit_count = 1 << digit_bits;
+		constexpr std::size_t pass_count = 3;
+
+		struct Entry
+		{
+			/// Bit pattern of the squared distance. Squared distances are never negative, so their bit patterns sort in the same order as their values.
+			std::uint32_t key;
+			std::uint32_t triangle;
+		};
+
+		using Histogram = std::array<std::uint32_t, digit_count>;
+
+		/// Splits a range of triangles into chunks, which are processed across a job system if one is worthwhile.
+		class Chunks
+		{
+		public:
+			Chunks(std::size_t triangle_count, tz::algo::JobSystem* job_system): triangle_count(triangle_count), chunk_count(1), job_system(job_system)
+			{
+				if(job_system != nullptr && job_system->worker_count() > 0 && triangle_count >= min_parallel_triangles)
+					this->chunk_count = (job_system->worker_count() + 1) * chunks_per_thread;
+			}
+
+			std::size_t count() const
+			{
+				return this->chunk_count;
+			}
+
+			std::size_t begin(std::size_t chunk) const
+			{
+				return (this->triangle_count * chunk) / this->chunk_count;
+			}
+
+			std::size_t end(std::size_t chunk) const
+			{
+				return this->begin(chunk + 1);
+			}
+
+			/// Invoke function(chunk) for every chunk and wait for them all to finish.
+			template<typename Function>
+			void for_each(Function function) const
+			{
+				if(this->chunk_count == 1)
+				{
+					function(0);
+					return;
+				}
+				this->job_system->wait(this->job_system->parallel_for(0, this->chunk_count, 1, function));
+			}
+		private:
+			std::size_t triangle_count;
+			std::size_t chunk_count;
+			tz::algo::JobSystem* job_system;
+		};
+
+		/// Retrieve the key of each triangle, in the order that they currently appear in the mesh.
+		std::vector<Entry> get_entries(const IndexedMesh& mesh, tz::Vec3 closest_to, const Chunks& chunks)
+		{
+			std::vector<Entry> entries(mesh.indices.size() / 3);
+			// Comparing three times the centroid against three times the point orders triangles the same way as comparing the centroid against the point, without dividing.
+			const float point[3] = {closest_to[0] * 3.0f, closest_to[1] * 3.0f, closest_to[2] * 3.0f};
+			chunks.for_each([&mesh, &entries, &point, &chunks](std::size_t chunk)
+			{
+				for(std::size_t i = chunks.begin(chunk); i < chunks.end(chunk); i++)
+				{
+					const tz::Vec3& a = mesh.vertices[mesh.indices[i * 3]].position;
+					const tz::Vec3& b = mesh.vertices[mesh.indices[(i * 3) + 1]].position;
+					const tz::Vec3& c = mesh.vertices[mesh.indices[(i * 3) + 2]].position;
+					float distance_squared = 0.0f;
+					for(std::size_t axis = 0; axis < 3; axis++)
+					{
+						const float difference = point[axis] - (a[axis] + b[axis] + c[axis]);
+						distance_squared += difference * difference;
+					}
+					entries[i].triangle = static_cast<std::uint32_t>(i);
+					std::memcpy(&entries[i].key, &distance_squared, sizeof(float));
+				}
+			});
+			return entries;
+		}
+
+		/// Stable least-significant-digit radix sort by key.
+		void radix_sort(std::vector<Entry>& entries, const Chunks& chunks)
+		{
+			if(entries.size() <= max_comparison_sort_triangles)
+			{
+				std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b){return a.key < b.key;});
+				return;
+			}
+			std::vector<Entry> scratch(entries.size());
+			std::vector<Histogram> histograms(chunks.count());
+			Entry* source = entries.data();
+			Entry* destination = scratch.data();
+			for(std::size_t pass = 0; pass < pass_count; pass++)
+			{
+				const std::size_t shift = pass * digit_bits;
+				auto digit_of = [shift](const Entry& entry){return (entry.key >> shift) & (digit_count - 1);};
+				chunks.for_each([source, &histograms, &chunks, digit_of](std::size_t chunk)
+				{
+					Histogram& histogram = histograms[chunk];
+					histogram.fill(0);
+					for(std::size_t i = chunks.begin(chunk); i < chunks.end(chunk); i++)
+					{
+						histogram[digit_of(source[i])]++;
+					}
+				});
+				// If every key has the same digit, this pass wouldn't move anything. This is common for the high digits, as nearby distances share their exponent.
+				std::size_t first_digit_count = 0;
+				for(const Histogram& histogram : histograms)
+				{
+					first_digit_count += histogram[digit_of(source[0])];
+				}
+				if(first_digit_count == entries.size())
+					continue;
+				// Each chunk scatters its entries after every entry with a smaller digit, and after the entries with the same digit in earlier chunks.
+				std::uint32_t offset = 0;
+				for(std::size_t digit = 0; digit < digit_count; digit++)
+				{
+					for(Histogram& histogram : histograms)
+					{
+						const std::uint32_t count = histogram[digit];
+						histogram[digit] = offset;
+						offset += count;
+					}
+				}
+				chunks.for_each([source, destination, &histograms, &chunks, digit_of](std::size_t chunk)
+				{
+					Histogram& offsets = histograms[chunk];
+					for(std::size_t i = chunks.begin(chunk); i < chunks.end(chunk); i++)
+					{
+						destination[offsets[digit_of(source[i])]++] = source[i];
+					}
+				});
+				std::swap(source, destination);
+			}
+			if(source != entries.data())
+				entries.swap(scratch);
+		}
+
+		/**
+		 * Insertion sort by key, which is linear if the entries are nearly sorted already.
+		 * @return Number of entries which were moved, or nullopt if more than max_moves would need to be. In that case, the entries are left partially sorted.
+		 */
+		std::optional<std::size_t> insertion_sort(std::vector<Entry>& entries, std::size_t max_moves)
+		{
+			std::size_t moves = 0;
+			for(std::size_t i = 1; i < entries.size(); i++)
+			{
+				if(entries[i - 1].key <= entries[i].key)
+					continue;
+				const Entry entry = entries[i];
+				std::size_t j = i;
+				for(; j > 0 && entries[j - 1].key > entry.key; j--)
+				{
+					entries[j] = entries[j - 1];
+				}
+				entries[j] = entry;
+				moves += i - j;
+				if(moves > max_moves)
+					return std::nullopt;
+			}
+			return moves;
+		}
+
+		/// Reorder the triangles of the mesh to match the entries.
+		void apply(IndexedMesh& mesh, const std::vector<Entry>& entries, const Chunks& chunks)
+		{
+			const std::vector<tz::gl::Index> original{mesh.indices.begin(), mesh.indices.begin() + (entries.size() * 3)};
+			chunks.for_each([&mesh, &entries, &original, &chunks](std::size_t chunk)
+			{
+				for(std::size_t i = chunks.begin(chunk); i < chunks.end(chunk); i++)
+				{
+					const std::size_t source = static_cast<std::size_t>(entries[i].triangle) * 3;
+					mesh.indices[i * 3] = original[source];
+					mesh.indices[(i * 3) + 1] = original[source + 1];
+					mesh.indices[(i * 3) + 2] = original[source + 2];
+				}
+			});
+		}
+	}
+
+	void sort_indices(IndexedMesh& mesh, tz::Vec3 closest_to, tz::algo::JobSystem* job_system)
+	{
+		const Chunks chunks{mesh.indices.size() / 3, job_system};
+		std::vector<Entry> entries = get_entries(mesh, closest_to, chunks);
+		if(entries.size() < 2)
+			return;
+		radix_sort(entries, chunks);
+		apply(mesh, entries, chunks);
+	}
+
+	void resort_indices(IndexedMesh& mesh, tz::Vec3 closest_to, tz::algo::JobSystem* job_system)
+	{
+		const Chunks chunks{mesh.indices.size() / 3, job_system};
+		std::vector<Entry> entries = get_entries(mesh, closest_to, chunks);
+		if(entries.size() < 2)
+			return;
+		// Allow about as much shuffling as one radix pass would do. Beyond that, the full sort is cheaper.
+		const std::optional<std::size_t> moves = insertion_sort(entries, entries.size());
+		if(moves.has_value() && moves.value() == 0)
+			return;
+		if(!moves.has_value())
+			radix_sort(entries, chunks);
+		apply(mesh, entries, chunks);
+	}
+}
@@ -1,8 +1,14 @@
 #ifndef TOPAZ_GL_MESH_HPP
 #define TOPAZ_GL_MESH_HPP
 #include "gl/vertex.hpp"
+#include <memory_resource>
 #include <vector>
 
+namespace tz::algo
+{
+	class JobSystem;
+}
+
 namespace tz::gl
 {
 	/**
@@ -17,8 +23,15 @@ namespace tz::gl
 
 	struct IndexedMesh
 	{
-		std::vector<tz::gl::Vertex> vertices;
-		std::vector<tz::gl::Index> indices;
+		IndexedMesh() = default;
+		/**
+		 * Construct an empty mesh whose vertices and indices are allocated from the given memory resource.
+		 * @param resource Memory resource to allocate from. Must outlive the mesh.
+		 */
+		IndexedMesh(std::pmr::memory_resource* resource): vertices(resource), indices(resource){}
+
+		std::pmr::vector<tz::gl::Vertex> vertices;
+		std::pmr::vector<tz::gl::Index> indices;
 
 		std::size_t data_size_bytes() const
 		{
@@ -31,48 +44,23 @@ namespace tz::gl
 		}
 	};
 
-	inline void sort_indices(IndexedMesh& mesh, tz::Vec3 closest_to)
-	{
-		// Sorts triangles based upon their euclidean distance to closest_to.
-		struct Triangle
-		{
-			Triangle(unsigned int a, unsigned int b, unsigned int c): a(a), b(b), c(c){}
-			unsigned int a, b, c;
-		};
-		auto get_pos = [&mesh](unsigned int index)->tz::Vec3{return mesh.vertices[index].position;};
-		auto get_triangle_pos = [&mesh, get_pos](const Triangle& t)
-		{
-			return (get_pos(t.a) + get_pos(t.b) + get_pos(t.c)) / 3.0f;
-		};
-
-		// Get a list of triangles instead, and sort that (keeps indices grouped together in 3s)
-		std::vector<Triangle> triangles;
-		triangles.reserve(mesh.indices.size() / 3);
-		for(std::size_t i = 0; i < mesh.indices.size(); i += 3)
-		{
-			triangles.emplace_back(mesh.indices[i], mesh.indices[i + 1], mesh.indices[i + 2]);
-		}
-
-		// Utility lambdas for getting the distance between a triangle and another position vector.
-		auto dist = [closest_to](tz::Vec3 position){return (closest_to - position).length();};
-		auto triangle_less = [get_triangle_pos, dist](Triangle lhs, Triangle rhs)
-		{
-			return dist(get_triangle_pos(lhs)) < dist(get_triangle_pos(rhs));
-		};
-
-		// Perform the sort via the utility lambda.
-		std::sort(triangles.begin(), triangles.end(), triangle_less);
-		{
-			std::size_t i = 0;
-			for(std::size_t j = 0; j < mesh.indices.size(); j += 3)
-			{
-				const Triangle& cur_tri = triangles[i++];
-				mesh.indices[j] = cur_tri.a;
-				mesh.indices[j + 1] = cur_tri.b;
-				mesh.indices[j + 2] = cur_tri.c;
-			}
-		}
-	}
+	/**
+	 * Sort the triangles of the mesh by the distance of their centroids from a point, nearest first. Each triangle's indices stay together and in the same winding order. Triangles at equal distances keep their relative order.
+	 * Distances are computed once per triangle and then radix-sorted, so this is linear in the number of triangles.
+	 * @param mesh Mesh whose indices should be sorted. Vertices are not modified.
+	 * @param closest_to Point to sort by, typically the camera position in the mesh's space.
+	 * @param job_system If non-null, large meshes are sorted across its workers. Small meshes are always sorted on the calling thread, as splitting them would cost more than it saves.
+	 */
+	void sort_indices(IndexedMesh& mesh, tz::Vec3 closest_to, tz::algo::JobSystem* job_system = nullptr);
+	/**
+	 * Sort the triangles of a mesh whose indices were sorted by a nearby point, such as last frame's camera position. See sort_indices(...).
+	 * If the mesh is still nearly sorted, the triangles are only nudged into place, which is far cheaper than sorting from scratch. Otherwise, this falls back to a full sort, having wasted at most a pass over the triangles.
+	 * Note: The result is identical to sort_indices(...), except that the order of triangles at equal distances may differ.
+	 * @param mesh Mesh whose indices should be sorted. Vertices are not modified.
+	 * @param closest_to Point to sort by, typically the camera position in the mesh's space.
+	 * @param job_system If non-null, large meshes are sorted across its workers where possible.
+	 */
+	void resort_indices(IndexedMesh& mesh, tz::Vec3 closest_to, tz::algo::JobSystem* job_system = nullptr);
 
 	/**
 	 * @}
@@ -0,0 +1,92 @@
+#include "gl/mesh_bvh.hpp"
+#include "core/debug/assert.hpp"
+#include <algorithm>
+
+namespace tz::gl
+{
+	namespace
+	{
+		std::vector<tz::Vec3> triangle_positions(const tz::gl::IndexedMesh& mesh)
+		{
+			topaz_assert(mesh.indices.size() % 3 == 0, "tz::gl::MeshBVH::MeshBVH(...): Mesh has ", mesh.indices.size(), " indices, which is not a whole number of triangles. Trailing indices are ignored.");
+			const std::size_t index_count = mesh.indices.size() - (mesh.indices.size() % 3);
+			std::vector<tz::Vec3> positions;
+			positions.reserve(index_count);
+			for(std::size_t i = 0; i < index_count; i++)
+			{
+				positions.push_back(mesh.vertices[mesh.indices[i]].position);
+			}
+			return positions;
+		}
+
+		std::vector<tz::geo::AABB> triangle_bounds(const std::vector<tz::Vec3>& positions)
+		{
+			std::vector<tz::geo::AABB> bounds;
+			bounds.reserve(positions.size() / 3);
+			for(std::size_t i = 0; i < positions.size(); i += 3)
+			{
+				tz::geo::AABB box{positions[i], positions[i]};
+				for(std::size_t j = 1; j < 3; j++)
+				{
+					for(std::size_t axis = 0; axis < 3; axis++)
+					{
+						box.min[axis] = std::min(box.min[axis], positions[i + j][axis]);
+						box.max[axis] = std::max(box.max[axis], positions[i + j][axis]);
+					}
+				}
+				bounds.push_back(box);
+			}
+			return bounds;
+		}
+	}
+
+	MeshBVH::MeshBVH(const tz::gl::IndexedMesh& mesh): positions(triangle_positions(mesh)), hierarchy()
+	{
+		const std::vector<tz::geo::AABB> bounds = triangle_bounds(this->positions);
+		this->hierarchy = tz::geo::BVH{{bounds.data(), bounds.size()}};
+	}
+
+	std::size_t MeshBVH::get_number_of_triangles() const
+	{
+		return this->positions.size() / 3;
+	}
+
+	bool MeshBVH::raycast(const tz::geo::Ray& ray, float max_distance) const
+	{
+		return this->hierarchy.raycast(ray, max_distance, [this, &ray](std::size_t triangle, float max)
+		{
+			const tz::Vec3* vertices = this->positions.data() + (triangle * 3);
+			return tz::geo::intersect(ray, vertices[0], vertices[1], vertices[2], max);
+		});
+	}
+
+	std::optional<tz::geo::RayHit> MeshBVH::closest_hit(const tz::geo::Ray& ray, float max_distance) const
+	{
+		return this->hierarchy.closest_hit(ray, max_distance, [this, &ray](std::size_t triangle, float max)
+		{
+			const tz::Vec3* vertices = this->positions.data() + (triangle * 3);
+			return tz::geo::intersect(ray, vertices[0], vertices[1], vertices[2], max);
+		});
+	}
+
+	std::vector<std::size_t> MeshBVH::overlap(const tz::geo::AABB& box) const
+	{
+		return this->hierarchy.overlap(box);
+	}
+
+	const tz::geo::BVH& MeshBVH::get_hierarchy() const
+	{
+		return this->hierarchy;
+	}
+
+	tz::geo::BVH build_bvh(const tz::gl::Manager& manager, tz::mem::Span<const tz::gl::Manager::Handle> handles)
+	{
+		std::vector<tz::geo::AABB> bounds;
+		bounds.reserve(handles.size());
+		for(tz::gl::Manager::Handle handle : handles)
+		{
+			bounds.push_back(manager.get_bounds(handle).box);
+		}
+		return tz::geo::BVH{{bounds.data(), bounds.size()}};
+	}
+}
@@ -0,0 +1,75 @@
+#ifndef TOPAZ_GL_MESH_BVH_HPP
+#define TOPAZ_GL_MESH_BVH_HPP
+#include "geo/bvh.hpp"
+#include "gl/mesh.hpp"
+#include "gl/manager.hpp"
+
+namespace tz::gl
+{
+	/**
+	 * \addtogroup tz_gl Topaz Graphics Library (tz::gl)
+	 * @{
+	 */
+
+	/**
+	 * Bounding volume hierarchy over the triangles of an indexed mesh, for queries such as editor picking. See tz::geo::BVH.
+	 * The triangles are copied out of the mesh, so the mesh need not outlive this. If the mesh changes, this must be rebuilt.
+	 */
+	class MeshBVH
+	{
+	public:
+		/**
+		 * Build a hierarchy over every triangle of the mesh.
+		 * Precondition: The number of indices is a multiple of 3. Otherwise, this will assert and ignore the trailing indices.
+		 * @param mesh Triangle list to build over.
+		 */
+		MeshBVH(const tz::gl::IndexedMesh& mesh);
+		/**
+		 * Retrieve the number of triangles in the hierarchy.
+		 */
+		std::size_t get_number_of_triangles() const;
+		/**
+		 * Query as to whether the ray hits any triangle.
+		 * @param ray Ray to cast, in the mesh's space.
+		 * @param max_distance Hits further along the ray than this are ignored.
+		 * @return True if the ray hits any triangle. Otherwise false.
+		 */
+		bool raycast(const tz::geo::Ray& ray, float max_distance) const;
+		/**
+		 * Find the first triangle along the ray.
+		 * @param ray Ray to cast, in the mesh's space.
+		 * @param max_distance Hits further along the ray than this are ignored.
+		 * @return Closest hit, where the primitive is the index of the triangle (whose indices are mesh.indices[3 * primitive] onwards). If the ray hits nothing, nullopt.
+		 */
+		std::optional<tz::geo::RayHit> closest_hit(const tz::geo::Ray& ray, float max_distance) const;
+		/**
+		 * Find every triangle whose box overlaps the given box. This is conservative: Some of the triangles may not actually intersect the box.
+		 * @param box Box to test, in the mesh's space.
+		 * @return Index of each overlapping triangle, in no particular order.
+		 */
+		std::vector<std::size_t> overlap(const tz::geo::AABB& box) const;
+		/**
+		 * Retrieve the underlying hierarchy, whose primitives are the triangles.
+		 */
+		const tz::geo::BVH& get_hierarchy() const;
+	private:
+		/// Three positions per triangle.
+		std::vector<tz::Vec3> positions;
+		tz::geo::BVH hierarchy;
+	};
+
+	/**
+	 * Build a bounding volume hierarchy over the bounds of some of a Manager's meshes (see tz::gl::Manager::get_bounds(Handle)), for scene-level queries such as line-of-sight.
+	 * Note: Manager bounds are in the space of the mesh data, so this is only meaningful for meshes which are not transformed further when rendered.
+	 * @param manager Manager owning the meshes.
+	 * @param handles Handles of the meshes to build over. Primitive i of the hierarchy corresponds to handles[i].
+	 * @return Hierarchy over the bounds of each mesh.
+	 */
+	tz::geo::BVH build_bvh(const tz::gl::Manager& manager, tz::mem::Span<const tz::gl::Manager::Handle> handles);
+
+	/**
+	 * @}
+	 */
+}
+
+#endif // TOPAZ_GL_MESH_BVH_HPP
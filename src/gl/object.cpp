@@ -1,4 +1,5 @@
 #include "gl/object.hpp"
+#include "gl/streaming_buffer.hpp"
 #include "core/debug/assert.hpp"
 #include <algorithm>
 
@@ -40,16 +41,17 @@ namespace tz::gl
 
 	std::size_t Object::size() const
 	{
-		return this->buffers.size();
+		return this->buffers.slot_count();
 	}
 
 	std::size_t Object::element_size() const
 	{
-		std::size_t sz = 0;
-		for(const auto& child_ptr : this->buffers)
-			if(child_ptr != nullptr)
-				sz++;
-		return sz;
+		return this->buffers.size();
+	}
+
+	std::size_t Object::handle_at(std::size_t element_index) const
+	{
+		return this->buffers.handle_at(element_index);
 	}
 
 	bool Object::operator==(ObjectHandle handle) const
@@ -72,23 +74,23 @@ namespace tz::gl
 		return this->vao != rhs.vao;
 	}
 
-	BufferHandle Object::add_buffer(std::unique_ptr<tz::gl::IBuffer> buffer)
+	std::size_t Object::add_buffer(std::unique_ptr<tz::gl::IBuffer> buffer)
 	{
 		auto find_result = std::find(this->buffers.begin(), this->buffers.end(), buffer);
 		if(find_result == this->buffers.end())
 		{
-			// We don't contain this. Create it and return the index.
-			this->buffers.push_back(std::move(buffer));
-			return (this->buffers.size() - 1);
+			// We don't contain this. Create it and return the handle.
+			return this->buffers.emplace(std::move(buffer));
 		}
 		else
 		{
-			// We do contain this. Return the dist.
-			return std::distance(this->buffers.begin(), find_result);
+			// We do contain this. We already own it, so drop the duplicate ownership and return the existing handle.
+			buffer.release();
+			return this->buffers.handle_at(std::distance(this->buffers.begin(), find_result));
 		}
 	}
 
-	BufferHandle Object::add_index_buffer(std::unique_ptr<tz::gl::IBuffer> index_buffer)
+	std::size_t Object::add_index_buffer(std::unique_ptr<tz::gl::IBuffer> index_buffer)
 	{
 		std::size_t id = this->add_buffer(std::move(index_buffer));
 		this->index_buffer_ids.push_back(id);
@@ -97,7 +99,8 @@ namespace tz::gl
 
 	void Object::format(std::size_t idx, tz::gl::Format fmt)
 	{
-		this->format_custom(idx, fmt.num_components, fmt.component_type, GL_FALSE, fmt.num_components * fmt.component_size, reinterpret_cast<const void*>(fmt.offset));
+		const std::size_t stride = fmt.stride != 0 ? fmt.stride : fmt.element_size();
+		this->format_custom(idx, fmt.num_components, fmt.component_type, fmt.normalised, stride, reinterpret_cast<const void*>(fmt.offset));
 	}
 
 	void Object::format_custom(std::size_t idx, GLint size, GLenum type, GLboolean normalised, GLsizei stride, const void* ptr)
@@ -110,32 +113,39 @@ namespace tz::gl
 
 	tz::gl::IBuffer* Object::operator[](std::size_t idx)
 	{
-		topaz_assert(idx < this->size(), "tz::gl::Object::operator[", idx, "] was out of range. Size = ", this->size());
-		return this->buffers[idx].get();
+		std::unique_ptr<tz::gl::IBuffer>* child = this->buffers.find(idx);
+		return child != nullptr ? child->get() : nullptr;
 	}
 
 	const tz::gl::IBuffer* Object::operator[](std::size_t idx) const
 	{
-		topaz_assert(idx < this->size(), "tz::gl::Object::operator[", idx, "] was out of range. Size = ", this->size());
-		return this->buffers[idx].get();
+		const std::unique_ptr<tz::gl::IBuffer>* child = this->buffers.find(idx);
+		return child != nullptr ? child->get() : nullptr;
 	}
 
 	void Object::bind_child(std::size_t idx) const
 	{
+		topaz_assert(this->buffers.contains(idx), "tz::gl::Object::bind_child(", idx, "): Handle is stale or invalid.");
 		glBindVertexArray(this->vao);
 		(*this)[idx]->bind();
 	}
 
 	void Object::erase(std::size_t idx)
 	{
-		topaz_assert(idx < this->size(), "tz::gl::Object::erase(", idx, "): Index ", idx, " was out of range! Size: ", this->size());
-		this->buffers[idx] = nullptr;
+		topaz_assert(this->buffers.contains(idx), "tz::gl::Object::erase(", idx, "): Handle is stale or invalid.");
+		if(!this->buffers.contains(idx))
+			return;
+		this->buffers.erase(idx);
 	}
 
 	std::unique_ptr<tz::gl::IBuffer> Object::release(std::size_t idx)
 	{
-		topaz_assert(idx < this->size(), "tz::gl::Object::release(", idx, "): Index ", idx, " was out of range! Size: ", this->size());
-		return std::move(this->buffers[idx]);
+		topaz_assert(this->buffers.contains(idx), "tz::gl::Object::release(", idx, "): Handle is stale or invalid.");
+		if(!this->buffers.contains(idx))
+			return nullptr;
+		std::unique_ptr<tz::gl::IBuffer> buffer = std::move(this->buffers[idx]);
+		this->buffers.erase(idx);
+		return buffer;
 	}
 
 	void Object::render(std::size_t ibo_id) const
@@ -145,7 +155,7 @@ namespace tz::gl
 		glDrawElements(GL_TRIANGLES, (*this)[ibo_id]->size() / sizeof(unsigned int), GL_UNSIGNED_INT, nullptr);
 	}
 
-	void Object::multi_render(std::size_t ibo_id, tz::gl::MDIDrawCommandList cmd_list) const
+	void Object::multi_render(std::size_t ibo_id, const tz::gl::MDIDrawCommandList& cmd_list) const
 	{
 		if(cmd_list.empty())
 			return;
@@ -156,6 +166,23 @@ namespace tz::gl
 		glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, cmd_list.size(), sizeof(tz::gl::gpu::DrawElementsIndirectCommand));
 	}
 
+	void Object::multi_render(std::size_t ibo_id, const tz::gl::MDIDrawCommandList& cmd_list, tz::gl::StreamingBuffer& stream) const
+	{
+		if(cmd_list.empty())
+			return;
+		std::optional<tz::gl::StreamAllocation> commands = stream.push<tz::gl::MDIDrawCommandList::Command>({cmd_list.data(), cmd_list.size()});
+		topaz_assert(commands.has_value(), "tz::gl::Object::multi_render(", ibo_id, ", ...): Streaming buffer has no space left this frame for ", cmd_list.size(), " commands.");
+		if(!commands.has_value())
+		{
+			this->multi_render(ibo_id, cmd_list);
+			return;
+		}
+		this->verify();
+		this->bind_child(ibo_id);
+		stream.bind(tz::gl::BufferType::IndirectCommandArgument);
+		glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, reinterpret_cast<const void*>(commands->offset), cmd_list.size(), sizeof(tz::gl::gpu::DrawElementsIndirectCommand));
+	}
+
 	void Object::verify() const
 	{
 		topaz_assert(this->vao != 0, "tz::gl::Object::verify(): Verification failed");
@@ -7,6 +7,7 @@
 #include "gl/buffer.hpp"
 #include "gl/format.hpp"
 #include "gl/draw_command.hpp"
+#include "memory/slot_map.hpp"
 #include <vector>
 #include <memory>
 
@@ -19,6 +20,7 @@ namespace tz::gl
 	 */
 
 	using ObjectHandle = GLuint;
+	class StreamingBuffer;
 
 	/**
 	 * tz::gl::Objects represent arbitrary Objects stored in VRAM. In OpenGL nomenclature, it is little more than a glorified VAO.
@@ -49,21 +51,28 @@ namespace tz::gl
 		 */
 		void unbind() const;
 		/**
-		 * Retrieve the number of Buffers that this Object owns, including null entries.
+		 * Retrieve the number of Buffer slots in this Object, including empty slots.
 		 * 
-		 * Note: This includes null entries, which are created via release or erase invocations.
-		 * Note: To retrieve the number of non-null owned Buffers, see this->element_size().
-		 * @return Number of child buffers.
+		 * Note: This includes empty slots, which are created via release or erase invocations. Empty slots are re-used by subsequent add_buffer or emplace_buffer invocations.
+		 * Note: To retrieve the number of owned Buffers, see this->element_size().
+		 * @return Number of child buffer slots.
 		 */
 		std::size_t size() const;
 		/**
-		 * Retrieve the number of Buffers that this Object owns, excluding null entries.
+		 * Retrieve the number of Buffers that this Object owns, excluding empty slots.
 		 * 
-		 * Note: This excludes null entries, which are created via release or erase invocations.
-		 * Note: To retrieve the number of owned Buffers (including null entries), see this->size().
+		 * Note: This excludes empty slots, which are created via release or erase invocations.
+		 * Note: To retrieve the number of slots (including empty ones), see this->size().
 		 * @return Number of used child buffers.
 		 */
 		std::size_t element_size() const;
+		/**
+		 * Retrieve the handle of one of the Buffers that this Object owns. Use this to visit every Buffer, as handles are generational and so aren't the same as slot indices.
+		 * Precondition: element_index < this->element_size(). Otherwise, this will assert and invoke UB.
+		 * @param element_index Position of the Buffer, between 0 and element_size(). This has nothing to do with the order in which Buffers were added.
+		 * @return Handle ID of the Buffer.
+		 */
+		std::size_t handle_at(std::size_t element_index) const;
 
 		bool operator==(ObjectHandle handle) const;
 		bool operator==(const Object& rhs) const;
@@ -78,7 +87,7 @@ namespace tz::gl
 		 * @param buffer The buffer to take ownership of.
 		 * @return Handle ID of the now-owned Buffer.
 		 */
-		BufferHandle add_buffer(std::unique_ptr<tz::gl::IBuffer> buffer);
+		std::size_t add_buffer(std::unique_ptr<tz::gl::IBuffer> buffer);
 		/**
 		 * Take ownership of an existing Buffer and retrieve an opaque ID handle corresponding to that Buffer. Also, interpret the Buffer as an index-buffer.
 		 * 
@@ -87,7 +96,7 @@ namespace tz::gl
 		 * @param buffer The buffer to take ownership of.
 		 * @return Handle ID of the now-owned Buffer.
 		 */
-		BufferHandle add_index_buffer(std::unique_ptr<tz::gl::IBuffer> index_buffer);
+		std::size_t add_index_buffer(std::unique_ptr<tz::gl::IBuffer> index_buffer);
 		/**
 		 * Create a new Buffer in-place and retrieve an opaque ID handle corresponding to the new Buffer.
 		 * 
@@ -98,7 +107,7 @@ namespace tz::gl
 		 * @return Handle ID of the newly-created and owned Buffer.
 		 */
 		template<tz::gl::BufferType Type, typename... Args>
-		BufferHandle emplace_buffer(Args&&... args);
+		std::size_t emplace_buffer(Args&&... args);
 		/**
 		 * Format a vertex attribute with the given index and standardised format specifier.
 		 */
@@ -110,8 +119,7 @@ namespace tz::gl
 		/**
 		 * Retrieve a pointer to an existing Buffer using its Handle ID.
 		 * 
-		 * Note: This can return nullptr if the Buffer at this index was previously erased or released.
-		 * Precondition: The given index must be in-range (0 <= idx <= this->size()). Otherwise this will assert and invoke UB.
+		 * Note: This returns nullptr if the Buffer at this handle was previously erased or released. Handles are generational, so this remains true even if the slot has since been re-used by another Buffer.
 		 * @param idx Handle ID whose corresponding Buffer should be retrieved.
 		 * @return Pointer to the existing Buffer if it exists. Otherwise nullptr.
 		 */
@@ -119,8 +127,7 @@ namespace tz::gl
 		/**
 		 * Retrieve a pointer to an existing IBuffer using its Handle ID. This will return the underlying interface.
 		 * 
-		 * Note: This can return nullptr if the Buffer at this index was previously erased or released.
-		 * Precondition: The given index must be in-range (0 <= idx <= this->size()). Otherwise this will assert and invoke UB.
+		 * Note: This returns nullptr if the Buffer at this handle was previously erased or released. Handles are generational, so this remains true even if the slot has since been re-used by another Buffer.
 		 * @param idx Handle ID whose corresponding Buffer should be retrieved.
 		 * @return Pointer to the existing Buffer if it exists. Otherwise nullptr.
 		 */
@@ -129,16 +136,15 @@ namespace tz::gl
 		/**
 		 * Bind this Object, and then bind the child at the given index. This corresponds to the handle ID used when creating or taking ownership of the Buffer.
 		 * Precondition: See IBuffer::bind()
-		 * Precondition: The given index must be in-range (0 <= idx <= this->size()). Otherwise this will assert and invoke UB.
+		 * Precondition: The given handle must correspond to an existing Buffer. Otherwise this will assert and invoke UB.
 		 * @param idx Handle ID whose corresponding Buffer should be bound.
 		 */
 		void bind_child(std::size_t idx) const;
 		/**
 		 * Retrieve a pointer to an existing IBuffer using its Handle ID. This will return the underlying interface.
 		 * 
-		 * Note: This can return nullptr if the Buffer at this index was previously erased or released.
+		 * Note: This returns nullptr if the Buffer at this handle was previously erased or released.
 		 * Note: If the underlying type o the Buffer is not known, you can instead retrieve a pointer to the interface via this->operator[].
-		 * Precondition: The given index must be in-range (0 <= idx <= this->size()). Otherwise this will assert and invoke UB.
 		 * Precondition: The Buffer at the given index must have underlying type matching Type. Otherwise this will invoke UB without asserting.
 		 * @tparam Type Underlying type of the Buffer at the given index.
 		 * @param idx Handle ID whose corresponding Buffer should be retrieved.
@@ -149,9 +155,8 @@ namespace tz::gl
 		/**
 		 * Retrieve a pointer to an existing IBuffer using its Handle ID. This will return the underlying interface.
 		 * 
-		 * Note: This can return nullptr if the Buffer at this index was previously erased or released.
+		 * Note: This returns nullptr if the Buffer at this handle was previously erased or released.
 		 * Note: If the underlying type of the Buffer is not known, you can instead retrieve a pointer to the interface via this->operator[].
-		 * Precondition: The given index must be in-range (0 <= idx <= this->size()). Otherwise this will assert and invoke UB.
 		 * Precondition: The Buffer at the given index must have underlying type matching Type. Otherwise this will invoke UB without asserting.
 		 * @tparam Type Underlying type of the Buffer at the given index.
 		 * @param idx Handle ID whose corresponding Buffer should be retrieved.
@@ -160,11 +165,11 @@ namespace tz::gl
 		template<tz::gl::BufferType Type>
 		const tz::gl::Buffer<Type>* get(std::size_t idx) const;
 		/**
-		 * Erase the Buffer at the given index, and construct a replacement Buffer in-place at that same index.
+		 * Destroy the Buffer at the given handle, and construct a replacement Buffer in-place. The handle remains valid and refers to the replacement.
 		 * 
-		 * Note: This will destroy the previous entry. You can use this->swap(...) to extract the previous entry.
-		 * Note: It is safe to invoke this if the index is in range but the element at the index is null (Such as from a previous erasure).
-		 * Precondition: The given index must be in-range (0 <= idx <= this->size()). Otherwise this will assert and invoke UB.
+		 * Note: This will destroy the previous entry. You can use this->release(...) to extract the previous entry first, but the handle will then be stale.
+		 * Note: Handles which have been erased or released are stale, so this cannot re-use their slot. Use emplace_buffer or add_buffer instead, which may re-use the slot under a new handle.
+		 * Precondition: The given handle must correspond to an existing Buffer. Otherwise this will assert and do nothing.
 		 * @tparam Type Underlying type fo the Buffer to be constructed at the given index.
 		 * @tparam Args Types of the arguments for the new Buffer's construction.
 		 * @param idx Handle ID at which the Buffer should be set.
@@ -173,20 +178,20 @@ namespace tz::gl
 		template<tz::gl::BufferType Type, typename... Args>
 		void set(std::size_t idx, Args&&... args);
 		/**
-		 * Erase the Buffer at the given index.
+		 * Erase the Buffer at the given handle. Afterwards, the handle is stale.
 		 * 
-		 * Note: The index will not be re-used in subsequent emplace_buffer or add_buffer invocations. The only way to re-use this index is to invoke this->set(...) at this index.
-		 * Precondition: The given index must be in-range (0 <= idx <= this->size()). Otherwise this will assert and invoke UB.
+		 * Note: The slot may be re-used by subsequent emplace_buffer or add_buffer invocations, but they will never return this same handle.
+		 * Precondition: The given handle must correspond to an existing Buffer. Otherwise this will assert and do nothing.
 		 * @param idx The index at which the Buffer should be erased.
 		 */
 		void erase(std::size_t idx);
 		/**
 		 * Relinquish ownership of the Buffer at the given index, yielding it to calling code. This is essentially a retrieve-and-erase. The result can trivially be added to another Object.
 		 * 
-		 * Note: After releasing at the index, expect the Buffer at the index to be nullptr.
-		 * Note: If the result of this invocation is discarded, the behaviour is identical to that of erasure at this index.
+		 * Note: After releasing at the handle, the handle is stale and expect the Buffer at the handle to be nullptr.
+		 * Note: If the result of this invocation is discarded, the behaviour is identical to that of erasure at this handle.
 		 * Note: The result of this method has important RAII semantics. If you allow it to go out of scope, it will destroy the Buffer. Either keep ahold of it sensibly or pass it into a new Object ASAP.
-		 * Precondition: The given index must be in-range (0 <= idx <= this->size()). Otherwise this will assert and invoke UB.
+		 * Precondition: The given handle must correspond to an existing Buffer. Otherwise this will assert and return nullptr.
 		 * @param idx Index at which the existing Buffer should be retrieved.
 		 * @return Smart-pointer to the resultant Buffer.
 		 */
@@ -209,7 +214,19 @@ namespace tz::gl
 		 * @param ibo_id ID Handle corresponding to an existing idnex-buffer within this object.
 		 * @param cmd_list List of glDrawElementsInstancedBaseInstanceBaseVertex commands.
 		 */
-		void multi_render(std::size_t ibo_id, tz::gl::MDIDrawCommandList cmd_list) const;
+		void multi_render(std::size_t ibo_id, const tz::gl::MDIDrawCommandList& cmd_list) const;
+		/**
+		 * Invoke a multi-render invocation using MDI via the given index-buffer, streaming the command-list through the given streaming buffer.
+		 * 
+		 * Note: Unlike multi_render(std::size_t, const tz::gl::MDIDrawCommandList&), this does not resize and re-send the object's own draw buffer, which would implicitly synchronise with the driver. Use this for command-lists which change every frame.
+		 * Note: This will early-out in the case that the command-list is empty.
+		 * Precondition: Identical to that of multi_render(std::size_t, const tz::gl::MDIDrawCommandList&).
+		 * Precondition: The current frame of the streaming buffer must have enough space left for the command-list. Otherwise, this will assert and fall back to the object's own draw buffer.
+		 * @param ibo_id ID Handle corresponding to an existing index-buffer within this object.
+		 * @param cmd_list List of glDrawElementsInstancedBaseInstanceBaseVertex commands.
+		 * @param stream Streaming buffer to copy the command-list into.
+		 */
+		void multi_render(std::size_t ibo_id, const tz::gl::MDIDrawCommandList& cmd_list, tz::gl::StreamingBuffer& stream) const;
 	private:
 		void verify() const;
 		void verify_bound() const;
@@ -217,7 +234,7 @@ namespace tz::gl
 		void set_draw_data(const tz::gl::MDIDrawCommandList& cmd_list) const;
 
 		ObjectHandle vao;
-		std::vector<std::unique_ptr<tz::gl::IBuffer>> buffers;
+		tz::mem::SlotMap<std::unique_ptr<tz::gl::IBuffer>> buffers;
 		mutable tz::gl::DIBO draw_buffer;
 		std::vector<std::size_t> index_buffer_ids;
 		std::size_t format_count;
@@ -2,7 +2,7 @@
 namespace tz::gl
 {
 	template<tz::gl::BufferType Type, typename... Args>
-	BufferHandle Object::emplace_buffer(Args&&... args)
+	std::size_t Object::emplace_buffer(Args&&... args)
 	{
 		this->bind();
 		auto buffer_ptr = std::make_unique<tz::gl::Buffer<Type>>(std::forward<Args>(args)...);
@@ -28,10 +28,9 @@ namespace tz::gl
 	void Object::set(std::size_t idx, Args&&... args)
 	{
 		this->verify();
-		topaz_assert(idx < this->size(), "tz::gl::Object::set(", idx, ", ...): Index given to set was not in range. Given an index ", idx, " which must be less-than (", this->size(), ")");
-		// TODO: Implement
-		this->erase(idx);
-		topaz_assert((*this)[idx] == nullptr, "tz::gl::Object::set(", idx, ", ...): Previous element at the index ", idx, " wasn't erased properly.");
+		topaz_assert(this->buffers.contains(idx), "tz::gl::Object::set(", idx, ", ...): Handle given to set is stale or invalid.");
+		if(!this->buffers.contains(idx))
+			return;
 		this->buffers[idx] = std::make_unique<tz::gl::Buffer<Type>>(std::forward<Args>(args)...);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,467 @@
+#include "gl/packed_vertex.hpp"
+#include "core/debug/assert.hpp"
+#include "geo/simd.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace tz::gl
+{
+	namespace
+	{
+		static_assert(sizeof(Vertex) == 14 * sizeof(float), "tz::gl::Vertex must be tightly packed for the SIMD kernels below.");
+		static_assert(sizeof(PackedVertex) == 24, "tz::gl::PackedVertex must be 24 bytes, matching tz::gl::fmt::packed_vertex.");
+
+		constexpr std::size_t batch_width = 4;
+		constexpr float unorm16_max = 65535.0f;
+		constexpr float snorm16_max = 32767.0f;
+		constexpr float snorm10_max = 511.0f;
+
+		std::uint32_t float_bits(float value)
+		{
+			std::uint32_t bits;
+			std::memcpy(&bits, &value, sizeof(float));
+			return bits;
+		}
+
+		float bits_float(std::uint32_t bits)
+		{
+			float value;
+			std::memcpy(&value, &bits, sizeof(float));
+			return value;
+		}
+
+		/*
+		 * Half conversion constants. See Fabian Giesen's "float->half variants" for the derivation.
+		 */
+
+		// Floats at or above this become infinity (or NaN).
+		constexpr std::uint32_t half_overflow = 0x47800000u;
+		// Floats below this (2^-14) become denormal halves.
+		constexpr std::uint32_t half_denormal = 0x38800000u;
+		// Adding this float to a tiny value leaves its half mantissa in the low bits, correctly rounded.
+		constexpr std::uint32_t half_denormal_magic = ((127 - 15) + (23 - 10) + 1) << 23;
+		// Re-biases the exponent from float to half, and pre-rounds the mantissa (the final bit of rounding, towards even, is added separately).
+		constexpr std::uint32_t half_rebias_round = 0xFFFu - (static_cast<std::uint32_t>(127 - 15) << 23);
+
+		float sign_not_zero(float value)
+		{
+			return value >= 0.0f ? 1.0f : -1.0f;
+		}
+
+		float bitangent_sign(const Vertex& vertex)
+		{
+			return tz::cross(vertex.normal, vertex.tangent).dot(vertex.bitangent) < 0.0f ? -1.0f : 1.0f;
+		}
+
+		std::int32_t to_snorm10(float value)
+		{
+			return static_cast<std::int32_t>(std::lrint(std::clamp(value, -1.0f, 1.0f) * snorm10_max));
+		}
+
+		float from_snorm10(std::int32_t value)
+		{
+			return std::max(static_cast<float>(value) * (1.0f / snorm10_max), -1.0f);
+		}
+
+	#if TOPAZ_GEO_SIMD
+		__m128 clamp4(__m128 value, float min, float max)
+		{
+			return _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(min)), _mm_set1_ps(max));
+		}
+
+		__m128 select4(__m128 mask, __m128 if_true, __m128 if_false)
+		{
+			return _mm_or_ps(_mm_and_ps(mask, if_true), _mm_andnot_ps(mask, if_false));
+		}
+
+		__m128 sign_not_zero4(__m128 value)
+		{
+			return select4(_mm_cmpge_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f), _mm_set1_ps(-1.0f));
+		}
+
+		__m128 abs4(__m128 value)
+		{
+			return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+		}
+
+		/// Four-wide to_half. Each lane of the result holds one half in its low 16 bits.
+		__m128i to_half4(__m128 value)
+		{
+			const __m128i bits = _mm_castps_si128(value);
+			const __m128i sign = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+			const __m128i f = _mm_xor_si128(bits, sign);
+			// f is non-negative, so signed comparisons are fine.
+			const __m128i overflow = _mm_cmpgt_epi32(f, _mm_set1_epi32(static_cast<int>(half_overflow - 1)));
+			const __m128i nan = _mm_cmpgt_epi32(f, _mm_set1_epi32(0x7F800000));
+			const __m128i overflow_result = _mm_or_si128(_mm_and_si128(nan, _mm_set1_epi32(0x7E00)), _mm_andnot_si128(nan, _mm_set1_epi32(0x7C00)));
+			const __m128i denormal = _mm_cmplt_epi32(f, _mm_set1_epi32(static_cast<int>(half_denormal)));
+			const __m128i magic = _mm_set1_epi32(static_cast<int>(half_denormal_magic));
+			const __m128i denormal_result = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(f), _mm_castsi128_ps(magic))), magic);
+			const __m128i mantissa_odd = _mm_and_si128(_mm_srli_epi32(f, 13), _mm_set1_epi32(1));
+			const __m128i normal_result = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(f, _mm_set1_epi32(static_cast<int>(half_rebias_round))), mantissa_odd), 13);
+			__m128i result = _mm_or_si128(_mm_and_si128(denormal, denormal_result), _mm_andnot_si128(denormal, normal_result));
+			result = _mm_or_si128(_mm_and_si128(overflow, overflow_result), _mm_andnot_si128(overflow, result));
+			return _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+		}
+
+		/// Four-wide from_half. Each lane of the input holds one half in its low 16 bits.
+		__m128 from_half4(__m128i half)
+		{
+			const __m128i shifted_exponent = _mm_set1_epi32(0x7C00 << 13);
+			__m128i bits = _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x7FFF)), 13);
+			const __m128i exponent = _mm_and_si128(bits, shifted_exponent);
+			bits = _mm_add_epi32(bits, _mm_set1_epi32((127 - 15) << 23));
+			const __m128i infinite = _mm_cmpeq_epi32(exponent, shifted_exponent);
+			const __m128i denormal = _mm_cmpeq_epi32(exponent, _mm_setzero_si128());
+			const __m128i infinite_result = _mm_add_epi32(bits, _mm_set1_epi32((128 - 16) << 23));
+			const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+			const __m128i denormal_result = _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(1 << 23))), magic));
+			bits = _mm_or_si128(_mm_and_si128(infinite, infinite_result), _mm_andnot_si128(infinite, bits));
+			bits = _mm_or_si128(_mm_and_si128(denormal, denormal_result), _mm_andnot_si128(denormal, bits));
+			return _mm_castsi128_ps(_mm_or_si128(bits, _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x8000)), 16)));
+		}
+
+		/// Four-wide octahedral_decode.
+		void octahedral_decode4(__m128 ex, __m128 ey, __m128& x, __m128& y, __m128& z)
+		{
+			x = ex;
+			y = ey;
+			z = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), abs4(ex)), abs4(ey));
+			const __m128 t = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps());
+			x = _mm_sub_ps(x, _mm_mul_ps(t, sign_not_zero4(x)));
+			y = _mm_sub_ps(y, _mm_mul_ps(t, sign_not_zero4(y)));
+			const __m128 inverse_length = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z))));
+			x = _mm_mul_ps(x, inverse_length);
+			y = _mm_mul_ps(y, inverse_length);
+			z = _mm_mul_ps(z, inverse_length);
+		}
+
+		__m128i to_snorm10_4(__m128 value)
+		{
+			return _mm_and_si128(_mm_cvtps_epi32(_mm_mul_ps(clamp4(value, -1.0f, 1.0f), _mm_set1_ps(snorm10_max))), _mm_set1_epi32(0x3FF));
+		}
+
+		__m128 from_snorm10_4(__m128i bits, int shift)
+		{
+			// Shift the 10-bit field to the top, then arithmetic-shift it back down to sign-extend it.
+			const __m128i value = _mm_srai_epi32(_mm_slli_epi32(bits, 22 - shift), 22);
+			return _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(value), _mm_set1_ps(1.0f / snorm10_max)), _mm_set1_ps(-1.0f));
+		}
+
+		void pack4(const Vertex* vertices, PackedVertex* out)
+		{
+			// Each load overruns the field into the next one (which is always within the same Vertex). Transposing then gives one register per component.
+			__m128 u = _mm_loadu_ps(vertices[0].texcoord.data()), v = _mm_loadu_ps(vertices[1].texcoord.data()), unused0 = _mm_loadu_ps(vertices[2].texcoord.data()), unused1 = _mm_loadu_ps(vertices[3].texcoord.data());
+			_MM_TRANSPOSE4_PS(u, v, unused0, unused1);
+			__m128 nx = _mm_loadu_ps(vertices[0].normal.data()), ny = _mm_loadu_ps(vertices[1].normal.data()), nz = _mm_loadu_ps(vertices[2].normal.data()), unused2 = _mm_loadu_ps(vertices[3].normal.data());
+			_MM_TRANSPOSE4_PS(nx, ny, nz, unused2);
+			__m128 tangent_x = _mm_loadu_ps(vertices[0].tangent.data()), tangent_y = _mm_loadu_ps(vertices[1].tangent.data()), tangent_z = _mm_loadu_ps(vertices[2].tangent.data()), unused3 = _mm_loadu_ps(vertices[3].tangent.data());
+			_MM_TRANSPOSE4_PS(tangent_x, tangent_y, tangent_z, unused3);
+			// The bitangent is the final field, so load from one float earlier instead.
+			__m128 unused4 = _mm_loadu_ps(vertices[0].bitangent.data() - 1), bx = _mm_loadu_ps(vertices[1].bitangent.data() - 1), by = _mm_loadu_ps(vertices[2].bitangent.data() - 1), bz = _mm_loadu_ps(vertices[3].bitangent.data() - 1);
+			_MM_TRANSPOSE4_PS(unused4, bx, by, bz);
+
+			const __m128i texcoord_u = _mm_cvtps_epi32(_mm_mul_ps(clamp4(u, 0.0f, 1.0f), _mm_set1_ps(unorm16_max)));
+			const __m128i texcoord_v = _mm_cvtps_epi32(_mm_mul_ps(clamp4(v, 0.0f, 1.0f), _mm_set1_ps(unorm16_max)));
+
+			// Octahedral encoding, exactly as octahedral_encode.
+			const __m128 l1_norm = _mm_add_ps(_mm_add_ps(abs4(nx), abs4(ny)), abs4(nz));
+			const __m128 inverse_norm = _mm_and_ps(_mm_cmpgt_ps(l1_norm, _mm_setzero_ps()), _mm_div_ps(_mm_set1_ps(1.0f), l1_norm));
+			__m128 ex = _mm_mul_ps(nx, inverse_norm);
+			__m128 ey = _mm_mul_ps(ny, inverse_norm);
+			const __m128 lower = _mm_cmplt_ps(nz, _mm_setzero_ps());
+			const __m128 folded_x = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), abs4(ey)), sign_not_zero4(ex));
+			const __m128 folded_y = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), abs4(ex)), sign_not_zero4(ey));
+			ex = select4(lower, folded_x, ex);
+			ey = select4(lower, folded_y, ey);
+			const __m128i normal_x = _mm_cvtps_epi32(_mm_mul_ps(clamp4(ex, -1.0f, 1.0f), _mm_set1_ps(snorm16_max)));
+			const __m128i normal_y = _mm_cvtps_epi32(_mm_mul_ps(clamp4(ey, -1.0f, 1.0f), _mm_set1_ps(snorm16_max)));
+
+			// Handedness: sign of dot(cross(n, t), b).
+			const __m128 cx = _mm_sub_ps(_mm_mul_ps(ny, tangent_z), _mm_mul_ps(nz, tangent_y));
+			const __m128 cy = _mm_sub_ps(_mm_mul_ps(nz, tangent_x), _mm_mul_ps(nx, tangent_z));
+			const __m128 cz = _mm_sub_ps(_mm_mul_ps(nx, tangent_y), _mm_mul_ps(ny, tangent_x));
+			const __m128 handedness = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, bx), _mm_mul_ps(cy, by)), _mm_mul_ps(cz, bz));
+			// -1 is 0b11 in 2 bits. +1 is 0b01.
+			const __m128i w = _mm_or_si128(_mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(handedness, _mm_setzero_ps())), _mm_set1_epi32(3)), _mm_set1_epi32(1));
+			__m128i tangent = to_snorm10_4(tangent_x);
+			tangent = _mm_or_si128(tangent, _mm_slli_epi32(to_snorm10_4(tangent_y), 10));
+			tangent = _mm_or_si128(tangent, _mm_slli_epi32(to_snorm10_4(tangent_z), 20));
+			tangent = _mm_or_si128(tangent, _mm_slli_epi32(w, 30));
+
+			alignas(16) std::int32_t texcoords[2][batch_width];
+			alignas(16) std::int32_t normals[2][batch_width];
+			alignas(16) std::uint32_t tangents[batch_width];
+			_mm_store_si128(reinterpret_cast<__m128i*>(texcoords[0]), texcoord_u);
+			_mm_store_si128(reinterpret_cast<__m128i*>(texcoords[1]), texcoord_v);
+			_mm_store_si128(reinterpret_cast<__m128i*>(normals[0]), normal_x);
+			_mm_store_si128(reinterpret_cast<__m128i*>(normals[1]), normal_y);
+			_mm_store_si128(reinterpret_cast<__m128i*>(tangents), tangent);
+			for(std::size_t i = 0; i < batch_width; i++)
+			{
+				out[i].position = vertices[i].position;
+				out[i].texcoord[0] = static_cast<std::uint16_t>(texcoords[0][i]);
+				out[i].texcoord[1] = static_cast<std::uint16_t>(texcoords[1][i]);
+				out[i].normal[0] = static_cast<std::int16_t>(normals[0][i]);
+				out[i].normal[1] = static_cast<std::int16_t>(normals[1][i]);
+				out[i].tangent = tangents[i];
+			}
+		}
+
+		void unpack4(const PackedVertex* packed, Vertex* out)
+		{
+			const __m128 u = _mm_mul_ps(_mm_cvtepi32_ps(_mm_setr_epi32(packed[0].texcoord[0], packed[1].texcoord[0], packed[2].texcoord[0], packed[3].texcoord[0])), _mm_set1_ps(1.0f / unorm16_max));
+			const __m128 v = _mm_mul_ps(_mm_cvtepi32_ps(_mm_setr_epi32(packed[0].texcoord[1], packed[1].texcoord[1], packed[2].texcoord[1], packed[3].texcoord[1])), _mm_set1_ps(1.0f / unorm16_max));
+			const __m128 ex = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_setr_epi32(packed[0].normal[0], packed[1].normal[0], packed[2].normal[0], packed[3].normal[0])), _mm_set1_ps(1.0f / snorm16_max)), _mm_set1_ps(-1.0f));
+			const __m128 ey = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_setr_epi32(packed[0].normal[1], packed[1].normal[1], packed[2].normal[1], packed[3].normal[1])), _mm_set1_ps(1.0f / snorm16_max)), _mm_set1_ps(-1.0f));
+			__m128 nx, ny, nz;
+			octahedral_decode4(ex, ey, nx, ny, nz);
+			const __m128i tangent = _mm_setr_epi32(static_cast<int>(packed[0].tangent), static_cast<int>(packed[1].tangent), static_cast<int>(packed[2].tangent), static_cast<int>(packed[3].tangent));
+			const __m128 tangent_x = from_snorm10_4(tangent, 0);
+			const __m128 tangent_y = from_snorm10_4(tangent, 10);
+			const __m128 tangent_z = from_snorm10_4(tangent, 20);
+			const __m128 w = _mm_cvtepi32_ps(_mm_srai_epi32(tangent, 30));
+			__m128 bx = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(ny, tangent_z), _mm_mul_ps(nz, tangent_y)), w);
+			__m128 by = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(nz, tangent_x), _mm_mul_ps(nx, tangent_z)), w);
+			__m128 bz = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(nx, tangent_y), _mm_mul_ps(ny, tangent_x)), w);
+
+			// Transpose back, such that each store also writes the correct value into whichever field it overruns into.
+			__m128 r0 = u, r1 = v, r2 = nx, r3 = ny;
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			__m128 s0 = nx, s1 = ny, s2 = nz, s3 = tangent_x;
+			_MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+			__m128 t0 = tangent_x, t1 = tangent_y, t2 = tangent_z, t3 = bx;
+			_MM_TRANSPOSE4_PS(t0, t1, t2, t3);
+			__m128 b0 = tangent_z, b1 = bx, b2 = by, b3 = bz;
+			_MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+			const __m128 texcoord_rows[] = {r0, r1, r2, r3};
+			const __m128 normal_rows[] = {s0, s1, s2, s3};
+			const __m128 tangent_rows[] = {t0, t1, t2, t3};
+			const __m128 bitangent_rows[] = {b0, b1, b2, b3};
+			for(std::size_t i = 0; i < batch_width; i++)
+			{
+				out[i].position = packed[i].position;
+				_mm_storeu_ps(out[i].texcoord.data(), texcoord_rows[i]);
+				_mm_storeu_ps(out[i].normal.data(), normal_rows[i]);
+				_mm_storeu_ps(out[i].tangent.data(), tangent_rows[i]);
+				_mm_storeu_ps(out[i].bitangent.data() - 1, bitangent_rows[i]);
+			}
+		}
+	#endif
+	}
+
+	PackedVertex pack(const Vertex& vertex)
+	{
+		PackedVertex packed;
+		packed.position = vertex.position;
+		packed.texcoord[0] = to_unorm16(vertex.texcoord[0]);
+		packed.texcoord[1] = to_unorm16(vertex.texcoord[1]);
+		const tz::Vec2 normal = octahedral_encode(vertex.normal);
+		packed.normal[0] = to_snorm16(normal[0]);
+		packed.normal[1] = to_snorm16(normal[1]);
+		packed.tangent = to_snorm_10_10_10_2({{vertex.tangent[0], vertex.tangent[1], vertex.tangent[2], bitangent_sign(vertex)}});
+		return packed;
+	}
+
+	Vertex unpack(const PackedVertex& packed)
+	{
+		Vertex vertex;
+		vertex.position = packed.position;
+		vertex.texcoord = {{from_unorm16(packed.texcoord[0]), from_unorm16(packed.texcoord[1])}};
+		vertex.normal = octahedral_decode({{from_snorm16(packed.normal[0]), from_snorm16(packed.normal[1])}});
+		const tz::Vec4 tangent = from_snorm_10_10_10_2(packed.tangent);
+		vertex.tangent = {{tangent[0], tangent[1], tangent[2]}};
+		vertex.bitangent = tz::cross(vertex.normal, vertex.tangent) * tangent[3];
+		return vertex;
+	}
+
+	void pack(tz::mem::Span<const Vertex> vertices, tz::mem::Span<PackedVertex> out)
+	{
+		const std::size_t count = out.size();
+		topaz_assert(vertices.size() == count, "tz::gl::pack(...): Span sizes do not match. Vertices: ", vertices.size(), ", Output: ", count);
+		if(vertices.size() != count)
+			return;
+		std::size_t i = 0;
+	#if TOPAZ_GEO_SIMD
+		for(; i + batch_width <= count; i += batch_width)
+		{
+			pack4(&vertices[i], &out[i]);
+		}
+	#endif
+		for(; i < count; i++)
+		{
+			out[i] = pack(vertices[i]);
+		}
+	}
+
+	void unpack(tz::mem::Span<const PackedVertex> packed, tz::mem::Span<Vertex> out)
+	{
+		const std::size_t count = out.size();
+		topaz_assert(packed.size() == count, "tz::gl::unpack(...): Span sizes do not match. Packed: ", packed.size(), ", Output: ", count);
+		if(packed.size() != count)
+			return;
+		std::size_t i = 0;
+	#if TOPAZ_GEO_SIMD
+		for(; i + batch_width <= count; i += batch_width)
+		{
+			unpack4(&packed[i], &out[i]);
+		}
+	#endif
+		for(; i < count; i++)
+		{
+			out[i] = unpack(packed[i]);
+		}
+	}
+
+	Half to_half(float value)
+	{
+		const std::uint32_t bits = float_bits(value);
+		const std::uint32_t sign = bits & 0x80000000u;
+		const std::uint32_t f = bits ^ sign;
+		std::uint32_t result;
+		if(f >= half_overflow)
+		{
+			// Infinity stays infinity, and NaN becomes a quiet NaN.
+			result = f > 0x7F800000u ? 0x7E00u : 0x7C00u;
+		}
+		else if(f < half_denormal)
+		{
+			result = float_bits(bits_float(f) + bits_float(half_denormal_magic)) - half_denormal_magic;
+		}
+		else
+		{
+			const std::uint32_t mantissa_odd = (f >> 13) & 1u;
+			result = (f + half_rebias_round + mantissa_odd) >> 13;
+		}
+		return static_cast<Half>(result | (sign >> 16));
+	}
+
+	float from_half(Half value)
+	{
+		constexpr std::uint32_t shifted_exponent = 0x7C00u << 13;
+		std::uint32_t bits = (value & 0x7FFFu) << 13;
+		const std::uint32_t exponent = bits & shifted_exponent;
+		bits += (127 - 15) << 23;
+		if(exponent == shifted_exponent)
+		{
+			// Infinity or NaN.
+			bits += (128 - 16) << 23;
+		}
+		else if(exponent == 0)
+		{
+			// Zero or denormal. Renormalise via the FPU.
+			bits = float_bits(bits_float(bits + (1u << 23)) - bits_float(113u << 23));
+		}
+		return bits_float(bits | ((value & 0x8000u) << 16));
+	}
+
+	void to_half(tz::mem::Span<const float> values, tz::mem::Span<Half> out)
+	{
+		const std::size_t count = out.size();
+		topaz_assert(values.size() == count, "tz::gl::to_half(...): Span sizes do not match. Values: ", values.size(), ", Output: ", count);
+		if(values.size() != count)
+			return;
+		std::size_t i = 0;
+	#if TOPAZ_GEO_SIMD
+		for(; i + (batch_width * 2) <= count; i += batch_width * 2)
+		{
+			const __m128i lo = to_half4(_mm_loadu_ps(&values[i]));
+			const __m128i hi = to_half4(_mm_loadu_ps(&values[i + batch_width]));
+			// There is no unsigned saturating pack in SSE2, so bias into signed range, pack, then unbias.
+			const __m128i bias = _mm_set1_epi32(0x8000);
+			const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(lo, bias), _mm_sub_epi32(hi, bias));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]), _mm_xor_si128(packed, _mm_set1_epi16(static_cast<short>(0x8000))));
+		}
+	#endif
+		for(; i < count; i++)
+		{
+			out[i] = to_half(values[i]);
+		}
+	}
+
+	void from_half(tz::mem::Span<const Half> values, tz::mem::Span<float> out)
+	{
+		const std::size_t count = out.size();
+		topaz_assert(values.size() == count, "tz::gl::from_half(...): Span sizes do not match. Values: ", values.size(), ", Output: ", count);
+		if(values.size() != count)
+			return;
+		std::size_t i = 0;
+	#if TOPAZ_GEO_SIMD
+		for(; i + (batch_width * 2) <= count; i += batch_width * 2)
+		{
+			const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&values[i]));
+			const __m128i zero = _mm_setzero_si128();
+			_mm_storeu_ps(&out[i], from_half4(_mm_unpacklo_epi16(halves, zero)));
+			_mm_storeu_ps(&out[i + batch_width], from_half4(_mm_unpackhi_epi16(halves, zero)));
+		}
+	#endif
+		for(; i < count; i++)
+		{
+			out[i] = from_half(values[i]);
+		}
+	}
+
+	std::uint16_t to_unorm16(float value)
+	{
+		return static_cast<std::uint16_t>(std::lrint(std::clamp(value, 0.0f, 1.0f) * unorm16_max));
+	}
+
+	float from_unorm16(std::uint16_t value)
+	{
+		return static_cast<float>(value) * (1.0f / unorm16_max);
+	}
+
+	std::int16_t to_snorm16(float value)
+	{
+		return static_cast<std::int16_t>(std::lrint(std::clamp(value, -1.0f, 1.0f) * snorm16_max));
+	}
+
+	float from_snorm16(std::int16_t value)
+	{
+		// Both -32768 and -32767 represent -1, as in OpenGL 4.2 onwards.
+		return std::max(static_cast<float>(value) * (1.0f / snorm16_max), -1.0f);
+	}
+
+	std::uint32_t to_snorm_10_10_10_2(const tz::Vec4& value)
+	{
+		const std::uint32_t x = static_cast<std::uint32_t>(to_snorm10(value[0])) & 0x3FFu;
+		const std::uint32_t y = static_cast<std::uint32_t>(to_snorm10(value[1])) & 0x3FFu;
+		const std::uint32_t z = static_cast<std::uint32_t>(to_snorm10(value[2])) & 0x3FFu;
+		const std::uint32_t w = static_cast<std::uint32_t>(std::lrint(std::clamp(value[3], -1.0f, 1.0f))) & 0x3u;
+		return x | (y << 10) | (z << 20) | (w << 30);
+	}
+
+	tz::Vec4 from_snorm_10_10_10_2(std::uint32_t value)
+	{
+		// Sign-extend each field by shifting it to the top of a signed integer and back down.
+		auto field = [value](int shift, int bits)->std::int32_t
+		{
+			return static_cast<std::int32_t>(value << (32 - shift - bits)) >> (32 - bits);
+		};
+		return {{from_snorm10(field(0, 10)), from_snorm10(field(10, 10)), from_snorm10(field(20, 10)), std::max(static_cast<float>(field(30, 2)), -1.0f)}};
+	}
+
+	tz::Vec2 octahedral_encode(const tz::Vec3& unit)
+	{
+		const float l1_norm = (std::abs(unit[0]) + std::abs(unit[1])) + std::abs(unit[2]);
+		const float inverse_norm = l1_norm > 0.0f ? 1.0f / l1_norm : 0.0f;
+		const float x = unit[0] * inverse_norm;
+		const float y = unit[1] * inverse_norm;
+		if(unit[2] < 0.0f)
+		{
+			// Fold the lower hemisphere over the diagonals.
+			return {{(1.0f - std::abs(y)) * sign_not_zero(x), (1.0f - std::abs(x)) * sign_not_zero(y)}};
+		}
+		return {{x, y}};
+	}
+
+	tz::Vec3 octahedral_decode(const tz::Vec2& encoded)
+	{
+		tz::Vec3 v{{encoded[0], encoded[1], (1.0f - std::abs(encoded[0])) - std::abs(encoded[1])}};
+		const float t = std::max(-v[2], 0.0f);
+		v[0] -= t * sign_not_zero(v[0]);
+		v[1] -= t * sign_not_zero(v[1]);
+		return v.normalised();
+	}
+}
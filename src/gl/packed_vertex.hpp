@@ -0,0 +1,133 @@
+#ifndef TOPAZ_GL_PACKED_VERTEX_HPP
+#define TOPAZ_GL_PACKED_VERTEX_HPP
+#include "gl/vertex.hpp"
+#include "gl/format.hpp"
+#include "memory/span.hpp"
+#include <cstdint>
+
+namespace tz::gl
+{
+	/**
+	 * \addtogroup tz_gl Topaz Graphics Library (tz::gl)
+	 * @{
+	 */
+
+	/// IEEE 754 half-precision float, as read by GL_HALF_FLOAT attributes.
+	using Half = std::uint16_t;
+
+	/**
+	 * A tz::gl::Vertex quantised into 24 bytes (rather than 56), for meshes whose draw cost is dominated by vertex fetch.
+	 * - Position remains full-precision, as half floats visibly wobble beyond a few hundred units from the origin.
+	 * - Texcoord is unorm16, so it must lie within [0, 1]. Texcoords outside of this range (e.g tiling) are clamped; such meshes should keep using tz::gl::Vertex.
+	 * - Normal is octahedral-encoded into two snorm16s.
+	 * - Tangent is snorm 10_10_10_2. The 2-bit w component holds the handedness of the bitangent, which is reconstructed as cross(normal, tangent) * w.
+	 *
+	 * Shaders receive the normal as a vec2, and must decode it:
+	 * \code{.glsl}
+	 * vec3 octahedral_decode(vec2 e)
+	 * {
+	 *     vec3 v = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	 *     float t = max(-v.z, 0.0);
+	 *     v.xy += vec2(v.x >= 0.0 ? -t : t, v.y >= 0.0 ? -t : t);
+	 *     return normalize(v);
+	 * }
+	 * \endcode
+	 */
+	struct PackedVertex
+	{
+		tz::Vec3 position;
+		std::uint16_t texcoord[2];
+		std::int16_t normal[2];
+		std::uint32_t tangent;
+	};
+
+	/**
+	 * Quantise a single vertex.
+	 * @param vertex Vertex to pack. Its normal and tangent should be normalised.
+	 * @return Packed equivalent of the vertex.
+	 */
+	PackedVertex pack(const Vertex& vertex);
+	/**
+	 * Expand a packed vertex back into full-precision. The result is within quantisation error of the vertex that was originally packed.
+	 * Note: A zero normal cannot be encoded, and unpacks as (0, 0, 1).
+	 * @param packed Vertex to unpack.
+	 * @return Unpacked vertex.
+	 */
+	Vertex unpack(const PackedVertex& packed);
+	/**
+	 * Pack many vertices at once. Vertices are processed four at a time using SIMD where available (see tz::geo::simd::enabled).
+	 * Precondition: Both spans have the same size. Otherwise, this will assert and do nothing.
+	 * @param vertices Vertices to pack.
+	 * @param out Destination of each packed vertex.
+	 */
+	void pack(tz::mem::Span<const Vertex> vertices, tz::mem::Span<PackedVertex> out);
+	/**
+	 * Unpack many vertices at once. Vertices are processed four at a time using SIMD where available (see tz::geo::simd::enabled).
+	 * Precondition: Both spans have the same size. Otherwise, this will assert and do nothing.
+	 * @param packed Vertices to unpack.
+	 * @param out Destination of each unpacked vertex.
+	 */
+	void unpack(tz::mem::Span<const PackedVertex> packed, tz::mem::Span<Vertex> out);
+
+	/*
+	 * Individual encodings, for custom vertex layouts.
+	 */
+
+	/**
+	 * Convert a float to half-precision, rounding to nearest-even. Values too large for a half become infinity.
+	 */
+	Half to_half(float value);
+	/**
+	 * Convert a half-precision float back to single-precision. This is exact.
+	 */
+	float from_half(Half value);
+	/**
+	 * Convert many floats to half-precision at once. Equivalent to to_half(float) for each element.
+	 * Precondition: Both spans have the same size. Otherwise, this will assert and do nothing.
+	 */
+	void to_half(tz::mem::Span<const float> values, tz::mem::Span<Half> out);
+	/**
+	 * Convert many half-precision floats to single-precision at once. Equivalent to from_half(Half) for each element.
+	 * Precondition: Both spans have the same size. Otherwise, this will assert and do nothing.
+	 */
+	void from_half(tz::mem::Span<const Half> values, tz::mem::Span<float> out);
+	/// Quantise a value within [0, 1] to 16 bits. Values outside of this range are clamped.
+	std::uint16_t to_unorm16(float value);
+	float from_unorm16(std::uint16_t value);
+	/// Quantise a value within [-1, 1] to 16 bits. Values outside of this range are clamped.
+	std::int16_t to_snorm16(float value);
+	float from_snorm16(std::int16_t value);
+	/// Quantise a vector within [-1, 1] to GL_INT_2_10_10_10_REV. x, y and z get 10 bits each, and w gets 2 bits (so it can only be -1, 0 or 1). Values outside of this range are clamped.
+	std::uint32_t to_snorm_10_10_10_2(const tz::Vec4& value);
+	tz::Vec4 from_snorm_10_10_10_2(std::uint32_t value);
+	/**
+	 * Encode a unit vector into two components within [-1, 1], by projecting it onto an octahedron and unfolding that into a square.
+	 * @param unit Normalised vector. If this is zero, the result is (0, 0).
+	 * @return Octahedral encoding of the vector.
+	 */
+	tz::Vec2 octahedral_encode(const tz::Vec3& unit);
+	/**
+	 * Decode an octahedral-encoded vector.
+	 * @param encoded Result of octahedral_encode (possibly quantised).
+	 * @return Normalised vector.
+	 */
+	tz::Vec3 octahedral_decode(const tz::Vec2& encoded);
+
+	namespace fmt::packed_vertex
+	{
+		/*
+		 * Formats of each attribute of an interleaved buffer of tz::gl::PackedVertex. Format each of these in-turn via tz::gl::Object::format.
+		 */
+
+		constexpr Format position = Format{3, GL_FLOAT, sizeof(float), 0, GL_FALSE, sizeof(PackedVertex)};
+		constexpr Format texcoord = Format{2, GL_UNSIGNED_SHORT, 2, sizeof(tz::Vec3), GL_TRUE, sizeof(PackedVertex)};
+		constexpr Format normal = Format{2, GL_SHORT, 2, sizeof(tz::Vec3) + 4, GL_TRUE, sizeof(PackedVertex)};
+		constexpr Format tangent = Format{4, GL_INT_2_10_10_10_REV, 4, sizeof(tz::Vec3) + 8, GL_TRUE, sizeof(PackedVertex)};
+	}
+
+	/**
+	 * @}
+	 */
+}
+
+#endif // TOPAZ_GL_PACKED_VERTEX_HPP
@@ -0,0 +1,108 @@
+#include "gl/streaming_buffer.hpp"
+#include "core/debug/assert.hpp"
+
+namespace tz::gl
+{
+	namespace
+	{
+		/// How long to wait on a fence before checking again, in nanoseconds.
+		constexpr GLuint64 fence_timeout = 1000000000;
+	}
+
+	StreamingBuffer::StreamingBuffer(std::size_t frame_capacity_bytes, std::size_t frame_count): buffer(), mapping(tz::mem::Block::null()), region_size(frame_capacity_bytes), current_frame(0), cursor(0), fences(frame_count, nullptr)
+	{
+		topaz_assert(frame_capacity_bytes > 0 && frame_count > 0, "tz::gl::StreamingBuffer::StreamingBuffer(", frame_capacity_bytes, ", ", frame_count, "): Frame capacity and frame count must both be non-zero.");
+		this->buffer.bind();
+		this->buffer.terminal_resize(frame_capacity_bytes * frame_count);
+		// Terminal buffers are persistently mapped and coherent, so we can write straight into them for the rest of our lifetime.
+		this->mapping = this->buffer.map();
+		this->buffer.unbind();
+	}
+
+	StreamingBuffer::~StreamingBuffer()
+	{
+		for(GLsync fence : this->fences)
+		{
+			if(fence != nullptr)
+				glDeleteSync(fence);
+		}
+	}
+
+	std::optional<StreamAllocation> StreamingBuffer::allocate(std::size_t size_bytes, std::size_t alignment)
+	{
+		topaz_assert(alignment > 0, "tz::gl::StreamingBuffer::allocate(", size_bytes, ", ", alignment, "): Alignment must be non-zero.");
+		const std::size_t region_begin = this->current_frame * this->region_size;
+		// Align the offset within the whole buffer, as that's the offset that the driver sees.
+		const std::size_t unaligned = region_begin + this->cursor;
+		const std::size_t offset = ((unaligned + alignment - 1) / alignment) * alignment;
+		if(offset + size_bytes > region_begin + this->region_size)
+			return std::nullopt;
+		this->cursor = (offset + size_bytes) - region_begin;
+		return StreamAllocation{{static_cast<char*>(this->mapping.begin) + offset, size_bytes}, offset};
+	}
+
+	void StreamingBuffer::next_frame()
+	{
+		// Everything issued so far may read from this frame's region, so the fence must come after all of it.
+		this->fences[this->current_frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		this->current_frame = (this->current_frame + 1) % this->fences.size();
+		this->cursor = 0;
+		this->wait(this->current_frame);
+	}
+
+	void StreamingBuffer::bind(BufferType type) const
+	{
+		glBindBuffer(static_cast<GLenum>(type), this->buffer.handle);
+	}
+
+	void StreamingBuffer::bind_range(BufferType type, std::size_t binding_id, const StreamAllocation& allocation) const
+	{
+		glBindBufferRange(static_cast<GLenum>(type), static_cast<GLuint>(binding_id), this->buffer.handle, static_cast<GLintptr>(allocation.offset), static_cast<GLsizeiptr>(allocation.block.size()));
+	}
+
+	void StreamingBuffer::copy_to(tz::gl::IBuffer& destination, std::size_t source_offset, std::size_t destination_offset, std::size_t size_bytes) const
+	{
+		glCopyNamedBufferSubData(this->buffer.handle, destination.handle, static_cast<GLintptr>(source_offset), static_cast<GLintptr>(destination_offset), static_cast<GLsizeiptr>(size_bytes));
+	}
+
+	std::size_t StreamingBuffer::frame_capacity() const
+	{
+		return this->region_size;
+	}
+
+	std::size_t StreamingBuffer::frame_used() const
+	{
+		return this->cursor;
+	}
+
+	std::size_t StreamingBuffer::frame_count() const
+	{
+		return this->fences.size();
+	}
+
+	std::size_t StreamingBuffer::uniform_alignment()
+	{
+		GLint alignment;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		return static_cast<std::size_t>(alignment);
+	}
+
+	void StreamingBuffer::wait(std::size_t frame)
+	{
+		GLsync& fence = this->fences[frame];
+		if(fence == nullptr)
+			return;
+		// Only the first wait needs to flush. Otherwise, the fence may never reach the GPU and we'd wait forever.
+		GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+		while(true)
+		{
+			const GLenum result = glClientWaitSync(fence, flags, fence_timeout);
+			topaz_assert(result != GL_WAIT_FAILED, "tz::gl::StreamingBuffer::wait(", frame, "): Waiting on the fence for this frame's region failed.");
+			if(result != GL_TIMEOUT_EXPIRED)
+				break;
+			flags = 0;
+		}
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+}
@@ -0,0 +1,135 @@
+#ifndef TOPAZ_GL_STREAMING_BUFFER_HPP
+#define TOPAZ_GL_STREAMING_BUFFER_HPP
+#include "gl/buffer.hpp"
+#include "memory/span.hpp"
+#include <optional>
+#include <vector>
+
+namespace tz::gl
+{
+	/**
+	 * \addtogroup tz_gl Topaz Graphics Library (tz::gl)
+	 * @{
+	 */
+
+	/**
+	 * Describes a range of a tz::gl::StreamingBuffer which has been handed out for the current frame.
+	 */
+	struct StreamAllocation
+	{
+		/// Persistently-mapped memory which the caller should write its data to.
+		tz::mem::Block block;
+		/// Offset of the range from the beginning of the buffer, in bytes. Pass this as the offset of whichever render-invocation or binding reads the data.
+		std::size_t offset;
+	};
+
+	/**
+	 * Ring of per-frame regions within a single terminal buffer, for data which is rewritten every frame (such as dynamic vertices, uniforms and indirect commands).
+	 *
+	 * The buffer is persistently mapped for its entire lifetime. Each frame, data is sub-allocated linearly from the current region and written straight into the mapping. Once a frame's render-invocations have been issued, a fence is placed on its region and the next region is used. A region is only reused once its fence has signalled, so the CPU never overwrites data which the GPU may still be reading. Unlike resizing and sending to a normal buffer every frame, this never implicitly synchronises with the driver.
+	 * Note: The underlying buffer object can be bound to any target, so a single streaming buffer can serve vertices, uniforms and indirect commands alike.
+	 */
+	class StreamingBuffer
+	{
+	public:
+		/**
+		 * Construct a streaming buffer. The underlying buffer is created, made terminal and mapped immediately.
+		 * @param frame_capacity_bytes Number of bytes which can be allocated in a single frame.
+		 * @param frame_count Number of frame regions. Typically, the GPU lags at most two frames behind the CPU, so the default of three means that the CPU never has to wait.
+		 */
+		StreamingBuffer(std::size_t frame_capacity_bytes, std::size_t frame_count = 3);
+		StreamingBuffer(const StreamingBuffer& copy) = delete;
+		StreamingBuffer& operator=(const StreamingBuffer& rhs) = delete;
+		/**
+		 * Destroy the buffer, along with any outstanding fences.
+		 * Precondition: No in-flight render-invocation is still reading from the buffer. Otherwise, this will invoke UB without asserting.
+		 */
+		~StreamingBuffer();
+		/**
+		 * Allocate a range of the current frame's region.
+		 * Note: The range remains valid until the frame's region is reused, which is frame_count invocations of next_frame() later.
+		 * @param size_bytes Size of the range, in bytes.
+		 * @param alignment Alignment of the offset of the range, in bytes. For a range to be bound as uniform storage, this must be a multiple of StreamingBuffer::uniform_alignment().
+		 * @return Allocated range. If there is not enough space left in the current frame's region, null.
+		 */
+		std::optional<StreamAllocation> allocate(std::size_t size_bytes, std::size_t alignment = 1);
+		/**
+		 * Allocate a range of the current frame's region and copy the given elements into it.
+		 * @tparam T Type of element. Must be trivially copyable.
+		 * @param elements Elements to copy into the buffer.
+		 * @param alignment Alignment of the offset of the range, in bytes. By default, this is the alignment of T.
+		 * @return Allocated range containing a copy of the elements. If there is not enough space left in the current frame's region, null.
+		 */
+		template<typename T>
+		std::optional<StreamAllocation> push(tz::mem::Span<const T> elements, std::size_t alignment = alignof(T));
+		/**
+		 * Finish the current frame and move on to the next region.
+		 *
+		 * This should be invoked once per frame, after every render-invocation which reads from the current frame's data has been issued.
+		 * Note: If the GPU has not yet finished with the next region, this blocks until it has.
+		 */
+		void next_frame();
+		/**
+		 * Bind the underlying buffer to the given target.
+		 * @param type Target to bind to.
+		 */
+		void bind(BufferType type) const;
+		/**
+		 * Bind an allocated range of the underlying buffer to the given indexed target. This is how to read streamed uniform or shader-storage data.
+		 * Precondition: The target must be indexed, such as BufferType::UniformStorage or BufferType::ShaderStorage. Otherwise, this will invoke UB without asserting.
+		 * @param type Target to bind to.
+		 * @param binding_id Binding point of the target, corresponding to the layout qualifier in the shader.
+		 * @param allocation Range to bind.
+		 */
+		void bind_range(BufferType type, std::size_t binding_id, const StreamAllocation& allocation) const;
+		/**
+		 * Copy part of the underlying buffer into another buffer. The copy happens entirely on the GPU.
+		 * Precondition: The destination buffer must be unmapped or terminal, and the range must fit within both buffers. Otherwise, this will invoke UB without asserting.
+		 * @param destination Buffer to copy into.
+		 * @param source_offset Offset from the beginning of this buffer, in bytes. This is typically the offset of an allocation.
+		 * @param destination_offset Offset from the beginning of the destination's data-store, in bytes.
+		 * @param size_bytes Number of bytes to copy.
+		 */
+		void copy_to(tz::gl::IBuffer& destination, std::size_t source_offset, std::size_t destination_offset, std::size_t size_bytes) const;
+		/**
+		 * Retrieve the number of bytes which can be allocated in a single frame.
+		 * @return Capacity of each frame region, in bytes.
+		 */
+		std::size_t frame_capacity() const;
+		/**
+		 * Retrieve the number of bytes which have been allocated so far in the current frame, including any alignment padding.
+		 * @return Bytes used of the current frame region.
+		 */
+		std::size_t frame_used() const;
+		/**
+		 * Retrieve the number of frame regions.
+		 * @return Number of frames which the CPU can write ahead of the GPU.
+		 */
+		std::size_t frame_count() const;
+		/**
+		 * Retrieve the alignment which offsets of uniform storage bindings must have, as required by the driver.
+		 * @return Minimum uniform buffer offset alignment, in bytes.
+		 */
+		static std::size_t uniform_alignment();
+	private:
+		/// Block until the GPU has finished with the given region.
+		void wait(std::size_t frame);
+
+		/// Terminal buffer containing every region. Its type only affects its default binding target.
+		tz::gl::Buffer<BufferType::Array> buffer;
+		tz::mem::Block mapping;
+		std::size_t region_size;
+		std::size_t current_frame;
+		/// Offset of the first unallocated byte of the current region, relative to the start of the region.
+		std::size_t cursor;
+		/// Fence placed on each region once its frame was finished. Null if the region has never been used or has since been waited on.
+		std::vector<GLsync> fences;
+	};
+
+	/**
+	 * @}
+	 */
+}
+
+#include "gl/streaming_buffer.inl"
+#endif // TOPAZ_GL_STREAMING_BUFFER_HPP
@@ -0,0 +1,15 @@
+#include <cstring>
+#include <type_traits>
+
+namespace tz::gl
+{
+	template<typename T>
+	std::optional<StreamAllocation> StreamingBuffer::push(tz::mem::Span<const T> elements, std::size_t alignment)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "tz::gl::StreamingBuffer::push<T>(...): T must be trivially copyable.");
+		std::optional<StreamAllocation> allocation = this->allocate(elements.size() * sizeof(T), alignment);
+		if(allocation.has_value() && !elements.empty())
+			std::memcpy(allocation->block.begin, elements.data(), elements.size() * sizeof(T));
+		return allocation;
+	}
+}
@@ -1,4 +1,5 @@
 #include "gl/texture.hpp"
+#include "memory/tracking.hpp"
 
 namespace tz::gl
 {
@@ -19,6 +20,48 @@ namespace tz::gl
 		return this->component_type != rhs.component_type || this->internal_format != rhs.internal_format || this->format != rhs.format;
 	}
 
+	std::size_t TextureDataDescriptor::size_bytes() const
+	{
+		std::size_t component_count = 0;
+		switch(this->format)
+		{
+			case GL_RED:
+			case GL_DEPTH_COMPONENT:
+				component_count = 1;
+			break;
+			case GL_RG:
+				component_count = 2;
+			break;
+			case GL_RGB:
+			case GL_BGR:
+				component_count = 3;
+			break;
+			case GL_RGBA:
+			case GL_BGRA:
+				component_count = 4;
+			break;
+		}
+		std::size_t component_size = 0;
+		switch(this->component_type)
+		{
+			case GL_UNSIGNED_BYTE:
+			case GL_BYTE:
+				component_size = 1;
+			break;
+			case GL_UNSIGNED_SHORT:
+			case GL_SHORT:
+			case GL_HALF_FLOAT:
+				component_size = 2;
+			break;
+			case GL_UNSIGNED_INT:
+			case GL_INT:
+			case GL_FLOAT:
+				component_size = 4;
+			break;
+		}
+		return component_count * component_size * this->width * this->height;
+	}
+
 	Texture::Texture(): handle(0), descriptor(std::nullopt)
 	{
 		glGenTextures(1, &this->handle);
@@ -30,6 +73,7 @@ namespace tz::gl
 	{
 		topaz_assert(move.handle != 0, "tz::gl::Texture::Texture(Texture&&): Provided move candidate was invalid (move.handle == ", move.handle, ")");
 		move.handle = 0;
+		move.descriptor = std::nullopt;
 	}
 
 	Texture& Texture::operator=(Texture&& rhs)
@@ -43,6 +87,8 @@ namespace tz::gl
 
 	Texture::~Texture()
 	{
+		if(this->descriptor.has_value())
+			tz::mem::tracking::record_free(tz::mem::tracking::Tag::GL, this->descriptor.value().size_bytes());
 		// "glDeleteTextures silently ignores 0's and names that do not correspond to existing textures." - https://www.khronos.org/registry/OpenGL-Refpages/es2.0/xhtml/glDeleteTextures.xml
 		glDeleteTextures(1, &this->handle);
 	}
@@ -60,7 +106,7 @@ namespace tz::gl
 	void Texture::resize(const TextureDataDescriptor& descriptor)
 	{
 		topaz_hard_assert(!this->is_terminal(), "tz::gl::Texture::resize(...): Must never resize a terminal texture! Doing so could crash the GPU/entire OS.");
-		this->descriptor = descriptor;
+		this->set_descriptor(descriptor);
 		this->internal_bind();
 		const auto& desc = this->descriptor.value();
 		glTexImage2D(GL_TEXTURE_2D, 0, desc.internal_format, static_cast<GLsizei>(desc.width), static_cast<GLsizei>(desc.height), 0, desc.format, desc.component_type, nullptr);
@@ -134,6 +180,14 @@ namespace tz::gl
 		glBindTexture(GL_TEXTURE_2D, 0);
 	}
 
+	void Texture::set_descriptor(const TextureDataDescriptor& descriptor)
+	{
+		if(this->descriptor.has_value())
+			tz::mem::tracking::record_free(tz::mem::tracking::Tag::GL, this->descriptor.value().size_bytes());
+		tz::mem::tracking::record_allocation(tz::mem::tracking::Tag::GL, descriptor.size_bytes());
+		this->descriptor = descriptor;
+	}
+
 	RenderBuffer::RenderBuffer(): handle(0)
 	{
 		glCreateRenderbuffers(1, &this->handle);
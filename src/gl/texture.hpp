@@ -34,6 +34,11 @@ namespace tz::gl
 		/// Note: Excludes width and height, only formatting data.
 		bool operator==(const TextureDataDescriptor& rhs) const;
 		bool operator!=(const TextureDataDescriptor& rhs) const;
+		/**
+		 * Retrieve the size of a data-store matching this description, assuming tightly-packed pixels.
+		 * @return Size of the data-store, in bytes. If the format or component-type is not recognised, 0.
+		 */
+		std::size_t size_bytes() const;
 	};
 
 	/**
@@ -133,10 +138,15 @@ namespace tz::gl
 	protected:
 		void internal_bind() const;
 		void internal_unbind() const;
+		/// Replace the descriptor after the driver has allocated a new data-store, accounting the change to tz::mem::tracking::Tag::GL.
+		void set_descriptor(const TextureDataDescriptor& descriptor);
 
 		TextureName handle;
 		std::optional<TextureDataDescriptor> descriptor;
 		std::optional<BindlessTextureHandle> bindless;
+	private:
+		/// Reads the handle and descriptor to copy staged image data straight into the data-store.
+		friend class UploadQueue;
 	};
 
 	/**
@@ -41,12 +41,16 @@ namespace tz::ext::imgui::gl
 		};
 
 		ImGui::Begin("Buffer Tracker", &this->visible);
+		// The tracked buffer may have since been erased or released, leaving its handle stale.
+		if(this->tracked_buffer_id.has_value() && (this->object == nullptr || (*this->object)[this->tracked_buffer_id.value()] == nullptr))
+			this->tracked_buffer_id = std::nullopt;
 		if(this->tracked_buffer_id.has_value())
 		{
 			std::size_t buf_id = this->tracked_buffer_id.value();
 			tz::gl::IBuffer* buf = (*this->object)[buf_id];
 			auto buf_size = buf->size();
 			ImGui::Text("Size: %zu", buf_size);
+			ImGui::Text("Capacity: %zu", buf->capacity());
 			if(ImGui::SliderInt("View Byte Offset", &this->view_offset, 0, buf_size - 1))
 			{
 				shrink_as_necessary(this->view_offset, this->view_size, buf_size, true);
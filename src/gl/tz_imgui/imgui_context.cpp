@@ -9,6 +9,7 @@
 // Diagnostics
 #include <vector>
 #include "gl/tz_imgui/buffer_tracker.hpp"
+#include "gl/tz_imgui/memory_tracker.hpp"
 #include "gl/tz_imgui/tzglp_preview.hpp"
 #include "gl/tz_imgui/ogl_info.hpp"
 #include "gl/tz_imgui/texture_sentinel_tracker.hpp"
@@ -21,6 +22,7 @@ namespace tz::ext::imgui
 	static gl::TZGLPPreview tzglp{};
 	static gl::OpenGLInfoWindow oglinfo{};
 	static gl::SentinelTrackerWindow textracker{};
+	static gl::MemoryTrackerWindow memtracker{};
 	static bool show_demo_window = false;
 
 	ImGuiWindow::ImGuiWindow(const char* name): name(name){}
@@ -89,16 +91,18 @@ namespace tz::ext::imgui
 		}
 		else
 		{
-			ImGui::Text("Buffers: %d", obj->size());
+			ImGui::Text("Buffers: %zu", obj->element_size());
 			if(ImGui::TreeNode("Attached Buffers"))
 			{
-				for(std::size_t i = 0; i < obj->size(); i++)
+				for(std::size_t i = 0; i < obj->element_size(); i++)
 				{
+					// Handles are generational, so only live buffers can be visited, and only via their handles.
+					const std::size_t handle = obj->handle_at(i);
 					ImGui::SetNextItemOpen(true, ImGuiCond_Once);
 					auto ptr = [](std::size_t i){return reinterpret_cast<void*>(static_cast<std::intptr_t>(i));};
-					if(ImGui::TreeNode(ptr(i), "Buffer %zu", i))
+					if(ImGui::TreeNode(ptr(handle), "Buffer %zu", handle))
 					{
-						const tz::gl::IBuffer* buf = (*obj)[i];
+						const tz::gl::IBuffer* buf = (*obj)[handle];
 						std::size_t buf_size_bytes = buf->size();
 						if(buf_size_bytes > (1024*1024*1024))
 						{
@@ -120,7 +124,7 @@ namespace tz::ext::imgui
 						ImGui::Text("Mapped: %d", buf->is_mapped());
 						if(ImGui::Button("Track this Buffer"))
 						{
-							tracker.track_buffer(i);
+							tracker.track_buffer(handle);
 							tracker.visible = true;
 						}
 						ImGui::TreePop();
@@ -169,6 +173,12 @@ namespace tz::ext::imgui
 				ImGui::EndMenu();
 			}
 
+			if(ImGui::BeginMenu("tz::mem"))
+			{
+				ImGui::MenuItem("Memory Tracker", nullptr, &memtracker.visible);
+				ImGui::EndMenu();
+			}
+
 			if(ImGui::BeginMenu("tz::gl"))
 			{
 				ImGui::MenuItem("gl::Object Tracking", nullptr, &track_objects);
@@ -213,6 +223,11 @@ namespace tz::ext::imgui
 			{
 				textracker.render();
 			}
+
+			if(memtracker.visible)
+			{
+				memtracker.render();
+			}
 		}
 	}
 
@@ -0,0 +1,104 @@
+#include "gl/tz_imgui/memory_tracker.hpp"
+#include "memory/tracking.hpp"
+#include <cfloat>
+
+namespace tz::ext::imgui::gl
+{
+	namespace
+	{
+		void text_bytes(std::size_t bytes)
+		{
+			if(bytes > (1024*1024*1024))
+			{
+				ImGui::Text("%.1fGiB", static_cast<float>(bytes) / (1024 * 1024 * 1024));
+			}
+			else if(bytes > (1024*1024))
+			{
+				ImGui::Text("%.1fMiB", static_cast<float>(bytes) / (1024 * 1024));
+			}
+			else if(bytes > (1024))
+			{
+				ImGui::Text("%.1fKiB", static_cast<float>(bytes) / (1024));
+			}
+			else
+			{
+				ImGui::Text("%zuB", bytes);
+			}
+		}
+	}
+
+	MemoryTrackerWindow::MemoryTrackerWindow(): ImGuiWindow("Memory Tracker"), frame_history{}, history_cursor(0){}
+
+	void MemoryTrackerWindow::render()
+	{
+		using namespace tz::mem::tracking;
+		ImGui::Begin(this->get_name(), &this->visible);
+		if constexpr(!tz::mem::tracking::enabled)
+		{
+			ImGui::TextWrapped("Memory tracking is disabled. Rebuild topaz with TOPAZ_MEMORY_TRACKING enabled to populate this window.");
+		}
+		else
+		{
+			auto row = [](Tag tag)
+			{
+				TagStats stats = tz::mem::tracking::get(tag);
+				ImGui::Text("%s", to_string(tag)); ImGui::NextColumn();
+				text_bytes(stats.current_bytes); ImGui::NextColumn();
+				text_bytes(stats.peak_bytes); ImGui::NextColumn();
+				ImGui::Text("%zu", stats.frame_allocations); ImGui::NextColumn();
+				ImGui::Text("%zu", stats.total_allocations); ImGui::NextColumn();
+				return stats;
+			};
+			// Lists every tag of the given kind, and returns their total.
+			auto section = [&row](Kind kind, const char* label)
+			{
+				TagStats total;
+				ImGui::Text("%s", label);
+				ImGui::Columns(5, label);
+				ImGui::Separator();
+				ImGui::Text("Tag"); ImGui::NextColumn();
+				ImGui::Text("Current"); ImGui::NextColumn();
+				ImGui::Text("Peak"); ImGui::NextColumn();
+				ImGui::Text("Allocs/Frame"); ImGui::NextColumn();
+				ImGui::Text("Total Allocs"); ImGui::NextColumn();
+				ImGui::Separator();
+				for(std::size_t i = 0; i < static_cast<std::size_t>(Tag::Count); i++)
+				{
+					Tag tag = static_cast<Tag>(i);
+					if(kind_of(tag) != kind)
+						continue;
+					TagStats stats = row(tag);
+					total.current_bytes += stats.current_bytes;
+					total.frame_allocations += stats.frame_allocations;
+					total.total_allocations += stats.total_allocations;
+				}
+				if(kind != Kind::InUse)
+				{
+					ImGui::Separator();
+					// Peaks of different tags are reached at different times, so they can't be summed.
+					ImGui::Text("Total"); ImGui::NextColumn();
+					text_bytes(total.current_bytes); ImGui::NextColumn();
+					ImGui::Text("-"); ImGui::NextColumn();
+					ImGui::Text("%zu", total.frame_allocations); ImGui::NextColumn();
+					ImGui::Text("%zu", total.total_allocations); ImGui::NextColumn();
+				}
+				ImGui::Columns(1);
+				ImGui::Separator();
+				return total;
+			};
+			TagStats total = section(Kind::Host, "Host Memory");
+			section(Kind::Video, "Video Memory");
+			// These are bytes in-use within memory already listed above, so they're never totalled.
+			section(Kind::InUse, "In-Use");
+
+			this->frame_history[this->history_cursor] = static_cast<float>(total.frame_allocations);
+			this->history_cursor = (this->history_cursor + 1) % history_length;
+			ImGui::PlotLines("Allocs/Frame", this->frame_history.data(), static_cast<int>(history_length), static_cast<int>(this->history_cursor), nullptr, 0.0f, FLT_MAX, ImVec2{0, 60});
+			if(ImGui::Button("Reset Peaks"))
+			{
+				reset_peaks();
+			}
+		}
+		ImGui::End();
+	}
+}
@@ -0,0 +1,26 @@
+#ifndef TOPAZ_GL_IMGUI_MEMORY_TRACKER_HPP
+#define TOPAZ_GL_IMGUI_MEMORY_TRACKER_HPP
+#include "gl/tz_imgui/imgui_context.hpp"
+#include <array>
+#include <cstddef>
+
+namespace tz::ext::imgui::gl
+{
+	/**
+	 * Displays the per-tag counters from tz::mem::tracking along with their totals, as well as a history of how many allocations were made in recent frames.
+	 * Tags are grouped by the kind of memory they account (see tz::mem::tracking::Kind), and each group is totalled separately.
+	 */
+	class MemoryTrackerWindow : public ImGuiWindow
+	{
+	public:
+		MemoryTrackerWindow();
+		virtual void render() override;
+	private:
+		static constexpr std::size_t history_length = 120;
+		/// Total allocations made by each of the previous frames. Used as a ring-buffer.
+		std::array<float, history_length> frame_history;
+		std::size_t history_cursor;
+	};
+}
+
+#endif // TOPAZ_GL_IMGUI_MEMORY_TRACKER_HPP
@@ -0,0 +1,121 @@
+#include "gl/upload_queue.hpp"
+#include "core/debug/assert.hpp"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+namespace tz::gl
+{
+	UploadQueue::UploadQueue(std::size_t staging_capacity_bytes, std::size_t frame_count): staging(staging_capacity_bytes, frame_count), buffer_copies(), texture_copies(){}
+
+	void UploadQueue::send(tz::gl::IBuffer& destination, std::size_t offset, tz::mem::Block output_block)
+	{
+		topaz_assert(output_block.size() <= (destination.size() - offset), "tz::gl::UploadQueue::send(", offset, ", tz::mem::Block (", output_block.size(), ")): Block of size ", output_block.size(), " cannot fit in the buffer of size ", destination.size(), " at the offset ", offset);
+		if(output_block.size() == 0)
+			return;
+		std::optional<StreamAllocation> staged = this->stage(output_block, 1);
+		if(!staged.has_value())
+		{
+			// Too big to stage at all. Flush first, so that sending directly still lands after everything queued before.
+			this->flush();
+			destination.send(offset, output_block);
+			return;
+		}
+		this->buffer_copies.push_back({&destination, offset, staged->offset, staged->block.begin, output_block.size()});
+	}
+
+	std::size_t UploadQueue::flush()
+	{
+		std::size_t copy_count = 0;
+		// Copies to different buffers can happen in any order, so group them by buffer. Copies to the same buffer keep their order, as later updates to overlapping ranges must win.
+		std::stable_sort(this->buffer_copies.begin(), this->buffer_copies.end(), [](const BufferCopy& a, const BufferCopy& b){return std::less<tz::gl::IBuffer*>{}(a.destination, b.destination);});
+		for(std::size_t i = 0; i < this->buffer_copies.size();)
+		{
+			// Find the run of copies which each carry on from where the last left off in the same buffer.
+			std::size_t run_end = i + 1;
+			for(; run_end < this->buffer_copies.size(); run_end++)
+			{
+				const BufferCopy& previous = this->buffer_copies[run_end - 1];
+				const BufferCopy& next = this->buffer_copies[run_end];
+				if(next.destination != previous.destination || next.destination_offset != previous.destination_offset + previous.size_bytes)
+					break;
+			}
+			const BufferCopy& first = this->buffer_copies[i];
+			topaz_assert(!first.destination->is_mapped() || first.destination->is_terminal(), "tz::gl::UploadQueue::flush(): Cannot copy into a buffer which is both non-terminal and mapped.");
+			copy_count += this->copy_run(&first, run_end - i);
+			i = run_end;
+		}
+		if(!this->texture_copies.empty())
+		{
+			// While a buffer is bound as the pixel source, pixel data pointers are interpreted as offsets into it.
+			this->staging.bind(BufferType::TextureDataSource);
+			for(const TextureCopy& copy : this->texture_copies)
+			{
+				glTextureSubImage2D(copy.destination->handle, 0, 0, 0, static_cast<GLsizei>(copy.width), static_cast<GLsizei>(copy.height), copy.format, copy.component_type, reinterpret_cast<const void*>(copy.staging_offset));
+				copy_count++;
+			}
+			glBindBuffer(static_cast<GLenum>(BufferType::TextureDataSource), 0);
+		}
+		this->buffer_copies.clear();
+		this->texture_copies.clear();
+		// The copies above read from this region, so it must not be reused until they're done.
+		this->staging.next_frame();
+		return copy_count;
+	}
+
+	std::size_t UploadQueue::pending() const
+	{
+		return this->buffer_copies.size() + this->texture_copies.size();
+	}
+
+	std::size_t UploadQueue::copy_run(const BufferCopy* first, std::size_t count)
+	{
+		std::size_t run_size = 0;
+		bool staged_contiguously = true;
+		for(std::size_t i = 0; i < count; i++)
+		{
+			run_size += first[i].size_bytes;
+			if(i > 0)
+				staged_contiguously = staged_contiguously && first[i].staging_offset == first[i - 1].staging_offset + first[i - 1].size_bytes;
+		}
+		std::optional<std::size_t> staging_offset = std::nullopt;
+		if(staged_contiguously)
+			staging_offset = first->staging_offset;
+		else if(std::optional<StreamAllocation> packed = this->staging.allocate(run_size); packed.has_value())
+		{
+			// Updates to other buffers were staged in between. Copying the pieces together CPU-side is far cheaper than a driver call per piece.
+			char* packed_data = static_cast<char*>(packed->block.begin);
+			for(std::size_t i = 0; i < count; i++)
+			{
+				std::memcpy(packed_data, first[i].staged_data, first[i].size_bytes);
+				packed_data += first[i].size_bytes;
+			}
+			staging_offset = packed->offset;
+		}
+		if(staging_offset.has_value())
+		{
+			this->staging.copy_to(*first->destination, staging_offset.value(), first->destination_offset, run_size);
+			return 1;
+		}
+		// No room to pack them, so copy each piece separately.
+		for(std::size_t i = 0; i < count; i++)
+		{
+			this->staging.copy_to(*first[i].destination, first[i].staging_offset, first[i].destination_offset, first[i].size_bytes);
+		}
+		return count;
+	}
+
+	std::optional<StreamAllocation> UploadQueue::stage(tz::mem::Block block, std::size_t alignment)
+	{
+		std::optional<StreamAllocation> staged = this->staging.allocate(block.size(), alignment);
+		if(!staged.has_value() && block.size() <= this->staging.frame_capacity())
+		{
+			this->flush();
+			staged = this->staging.allocate(block.size(), alignment);
+		}
+		if(!staged.has_value())
+			return std::nullopt;
+		std::memcpy(staged->block.begin, block.begin, block.size());
+		return staged;
+	}
+}
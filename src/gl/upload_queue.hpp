@@ -0,0 +1,108 @@
+#ifndef TOPAZ_GL_UPLOAD_QUEUE_HPP
+#define TOPAZ_GL_UPLOAD_QUEUE_HPP
+#include "gl/streaming_buffer.hpp"
+#include "gl/texture.hpp"
+#include <vector>
+
+namespace tz::gl
+{
+	/**
+	 * \addtogroup tz_gl Topaz Graphics Library (tz::gl)
+	 * @{
+	 */
+
+	/**
+	 * Gathers many small buffer and texture updates into a staging buffer, and applies them all at once when flushed.
+	 *
+	 * Sending lots of tiny pieces of data (such as per-object uniforms) via IBuffer::send costs a driver call each, and the overhead of those calls soon dominates. Instead, the queue copies each update into a persistently-mapped tz::gl::StreamingBuffer straight away, and only records where it needs to go.
+	 * Flushing then issues GPU-side copies out of the staging buffer. Consecutive updates to adjacent ranges of the same buffer are coalesced into a single copy, even if updates to other buffers were queued in between.
+	 * Note: Updates only reach their destinations once the queue is flushed. Until then, anything sent directly to the same destinations may be overwritten by the queued updates.
+	 */
+	class UploadQueue
+	{
+	public:
+		/**
+		 * Construct an empty queue.
+		 * @param staging_capacity_bytes Number of bytes which can be queued between flushes. If this runs out, the queue flushes itself early.
+		 * @param frame_count Number of staging regions. See tz::gl::StreamingBuffer.
+		 */
+		UploadQueue(std::size_t staging_capacity_bytes, std::size_t frame_count = 3);
+		/**
+		 * Queue a copy of the memory block to the destination buffer's data-store at the given offset.
+		 *
+		 * Note: The block is copied into the staging buffer immediately, so it needn't remain valid afterwards.
+		 * Note: If the block is larger than the entire staging capacity, the queue is flushed and the block is sent directly instead.
+		 * Precondition: The destination buffer must remain alive, and must not be resized via IBuffer::resize or IBuffer::terminal_resize, until the queue is next flushed. Otherwise, this will invoke UB without asserting.
+		 * Precondition: The given memory block must have a size less than or equal to (destination.size() - offset). Otherwise, this will assert and invoke UB.
+		 * @param destination Buffer to update.
+		 * @param offset Offset from the beginning of the destination's data-store, in bytes.
+		 * @param output_block Block of memory to copy to the data-store at the given offset.
+		 */
+		void send(tz::gl::IBuffer& destination, std::size_t offset, tz::mem::Block output_block);
+		/**
+		 * Queue a replacement of the texture's image data.
+		 *
+		 * Note: Only textures whose data-store already has the same dimensions and format as the image can be updated in place. Otherwise, the queue is flushed and the data is set directly via tz::gl::Texture::set_data instead.
+		 * Precondition: The destination texture must remain alive until the queue is next flushed. Otherwise, this will invoke UB without asserting.
+		 * @tparam PixelType Type of the pixel template to use. Example: tz::gl::PixelRGBA
+		 * @tparam ComponentType Underlying data type of the components within the pixel.
+		 * @param destination Texture to update.
+		 * @param image Image whose data should be uploaded to VRAM.
+		 */
+		template<template<typename> class PixelType, typename ComponentType>
+		void set_data(tz::gl::Texture& destination, const tz::gl::Image<PixelType<ComponentType>>& image);
+		/**
+		 * Issue every queued update, and move the staging buffer on to its next region.
+		 * Note: This should be invoked at least once per frame, before the render-invocations which depend on the updates.
+		 * @return Number of copies issued to the driver. This is never more than the number of queued updates.
+		 */
+		std::size_t flush();
+		/**
+		 * Retrieve the number of updates which have been queued since the last flush.
+		 * @return Number of queued updates.
+		 */
+		std::size_t pending() const;
+	private:
+		struct BufferCopy
+		{
+			tz::gl::IBuffer* destination;
+			std::size_t destination_offset;
+			std::size_t staging_offset;
+			/// Mapped memory at staging_offset.
+			const void* staged_data;
+			std::size_t size_bytes;
+		};
+
+		struct TextureCopy
+		{
+			tz::gl::Texture* destination;
+			std::size_t staging_offset;
+			unsigned int width;
+			unsigned int height;
+			GLenum format;
+			GLenum component_type;
+		};
+
+		/**
+		 * Copy the memory block into the staging buffer, flushing to make room if necessary.
+		 * @return Range of the staging buffer containing the copy. If the block cannot fit even in an empty staging region, null.
+		 */
+		std::optional<StreamAllocation> stage(tz::mem::Block block, std::size_t alignment);
+		/**
+		 * Issue the given run of copies, whose destination ranges are adjacent, with as few copies as possible.
+		 * @return Number of copies issued.
+		 */
+		std::size_t copy_run(const BufferCopy* first, std::size_t count);
+
+		tz::gl::StreamingBuffer staging;
+		std::vector<BufferCopy> buffer_copies;
+		std::vector<TextureCopy> texture_copies;
+	};
+
+	/**
+	 * @}
+	 */
+}
+
+#include "gl/upload_queue.inl"
+#endif // TOPAZ_GL_UPLOAD_QUEUE_HPP
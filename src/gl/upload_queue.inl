@@ -0,0 +1,26 @@
+namespace tz::gl
+{
+	template<template<typename> class PixelType, typename ComponentType>
+	void UploadQueue::set_data(tz::gl::Texture& destination, const tz::gl::Image<PixelType<ComponentType>>& image)
+	{
+		constexpr GLint internal_format = tz::gl::pixel::parse_internal_format<PixelType, ComponentType>();
+		constexpr GLenum format = tz::gl::pixel::parse_format<PixelType, ComponentType>();
+		constexpr GLenum type = tz::gl::pixel::parse_component_type<ComponentType>();
+		static_assert(internal_format != GL_INVALID_VALUE, "UploadQueue::set_data<PixelType, ComponentType>: Unsupported pixel/component types.");
+		static_assert(format != GL_INVALID_VALUE, "UploadQueue::set_data<PixelType, ComponentType>: Unsupported pixel/component types.");
+		static_assert(type != GL_INVALID_VALUE, "UploadQueue::set_data<PixelType, ComponentType>: Unsupported pixel/component types.");
+		const TextureDataDescriptor desired_descriptor{type, internal_format, format, image.get_width(), image.get_height()};
+		const bool in_place = destination.descriptor.has_value() && destination.descriptor.value() == desired_descriptor && destination.get_width() == image.get_width() && destination.get_height() == image.get_height();
+		std::optional<StreamAllocation> staged = std::nullopt;
+		if(in_place)
+			staged = this->stage({const_cast<PixelType<ComponentType>*>(image.data()), sizeof(PixelType<ComponentType>) * image.get_width() * image.get_height()}, alignof(PixelType<ComponentType>));
+		if(!staged.has_value())
+		{
+			// Anything still queued for this texture must land before the new data does.
+			this->flush();
+			destination.set_data(image);
+			return;
+		}
+		this->texture_copies.push_back({&destination, staged->offset, image.get_width(), image.get_height(), format, type});
+	}
+}
@@ -16,6 +16,15 @@ namespace tz::mem
 	template<typename T, std::size_t Align>
 	bool is_aligned(const T& t);
 
+	/**
+	 * Query as to whether the given address is aligned to the given boundary.
+	 * Precondition: alignment is a power of two. Otherwise, the result is unspecified.
+	 * @param address Address to query.
+	 * @param alignment Alignment boundary, in bytes.
+	 * @return True if the address is a multiple of the alignment. Otherwise false.
+	 */
+	inline bool is_aligned(const void* address, std::size_t alignment);
+
 	/**
 	 * @}
 	 */
@@ -11,4 +11,9 @@ namespace tz::mem
 		auto t_addr = reinterpret_cast<std::uintptr_t>(&t);
 		return (t_addr & (Align - 1)) == 0;
 	}
+
+	inline bool is_aligned(const void* address, std::size_t alignment)
+	{
+		return (reinterpret_cast<std::uintptr_t>(address) & (alignment - 1)) == 0;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "memory/arena.hpp"
+#include "memory/tracking.hpp"
+#include "core/debug/assert.hpp"
+#include <cstdint>
+#include <utility>
+
+namespace tz::mem
+{
+	LinearArena::LinearArena(Block block): owned_block(nullptr), block(block), offset(0){}
+
+	LinearArena::LinearArena(std::size_t size_bytes): owned_block(std::make_unique<AutoBlock>(size_bytes, alignment::cache_line)), block(*this->owned_block), offset(0){}
+
+	LinearArena::LinearArena(LinearArena&& move): owned_block(std::move(move.owned_block)), block(std::exchange(move.block, tz::mem::Block::null())), offset(std::exchange(move.offset, 0)){}
+
+	LinearArena& LinearArena::operator=(LinearArena&& rhs)
+	{
+		this->reset();
+		this->owned_block = std::move(rhs.owned_block);
+		this->block = std::exchange(rhs.block, tz::mem::Block::null());
+		this->offset = std::exchange(rhs.offset, 0);
+		return *this;
+	}
+
+	LinearArena::~LinearArena()
+	{
+		this->reset();
+	}
+
+	void* LinearArena::allocate(std::size_t size_bytes, std::size_t alignment)
+	{
+		auto begin_addr = reinterpret_cast<std::uintptr_t>(this->block.begin);
+		auto cur_addr = begin_addr + this->offset;
+		// Round up to the next multiple of the alignment.
+		auto aligned_addr = (cur_addr + (alignment - 1)) & ~static_cast<std::uintptr_t>(alignment - 1);
+		std::size_t new_offset = static_cast<std::size_t>(aligned_addr - begin_addr) + size_bytes;
+		if(new_offset > this->capacity())
+			return nullptr;
+		tracking::record_allocation(tracking::Tag::Arena, new_offset - this->offset);
+		this->offset = new_offset;
+		return reinterpret_cast<void*>(aligned_addr);
+	}
+
+	LinearArena::Marker LinearArena::mark() const
+	{
+		return this->offset;
+	}
+
+	void LinearArena::rewind(Marker marker)
+	{
+		topaz_assert(marker <= this->offset, "tz::mem::LinearArena::rewind(", marker, "): Marker is ahead of the current position ", this->offset, ". Was it retrieved before a previous rewind/reset?");
+		tracking::record_free(tracking::Tag::Arena, this->offset - marker);
+		this->offset = marker;
+	}
+
+	void LinearArena::reset()
+	{
+		tracking::record_free(tracking::Tag::Arena, this->offset);
+		this->offset = 0;
+	}
+
+	std::size_t LinearArena::size() const
+	{
+		return this->offset;
+	}
+
+	std::size_t LinearArena::capacity() const
+	{
+		return this->block.size();
+	}
+
+	std::size_t LinearArena::remaining() const
+	{
+		return this->capacity() - this->size();
+	}
+
+	bool LinearArena::contains(const void* ptr) const
+	{
+		auto addr = reinterpret_cast<std::uintptr_t>(ptr);
+		return addr >= reinterpret_cast<std::uintptr_t>(this->block.begin) && addr < reinterpret_cast<std::uintptr_t>(this->block.end);
+	}
+
+	ScopedMarker::ScopedMarker(LinearArena& arena): arena(arena), marker(arena.mark()){}
+
+	ScopedMarker::~ScopedMarker()
+	{
+		this->arena.rewind(this->marker);
+	}
+
+	ArenaResource::ArenaResource(LinearArena& arena, std::pmr::memory_resource* upstream): arena(&arena), upstream(upstream){}
+
+	void* ArenaResource::do_allocate(std::size_t bytes, std::size_t alignment)
+	{
+		void* ptr = this->arena->allocate(bytes, alignment);
+		if(ptr == nullptr)
+		{
+			// Arena is exhausted. Better to hit the heap than to fail outright.
+			ptr = this->upstream->allocate(bytes, alignment);
+		}
+		return ptr;
+	}
+
+	void ArenaResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+	{
+		// Arena memory is reclaimed in bulk by rewind/reset, so only upstream allocations need freeing.
+		if(!this->arena->contains(p))
+			this->upstream->deallocate(p, bytes, alignment);
+	}
+
+	bool ArenaResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+	{
+		return this == &other;
+	}
+}
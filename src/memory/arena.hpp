@@ -0,0 +1,137 @@
+#ifndef TOPAZ_MEMORY_ARENA_HPP
+#define TOPAZ_MEMORY_ARENA_HPP
+#include "memory/block.hpp"
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace tz::mem
+{
+	/**
+	 * \addtogroup tz_mem Topaz Memory Library (tz::mem)
+	 * A collection of low-level abstractions around memory utilities not provided by the C++ standard library. This includes non-owning memory blocks, uniform memory-pools and more.
+	 * @{
+	 */
+
+	/**
+	 * Bump-allocator over a single contiguous memory Block.
+	 * Allocation is a pointer increment. Individual allocations are never freed; instead the arena is rewound to a previous marker or reset entirely.
+	 * Useful for transient data whose lifetime is bounded by a scope or a frame.
+	 */
+	class LinearArena
+	{
+	public:
+		/// Opaque position within the arena. Retrieve via mark() and pass to rewind().
+		using Marker = std::size_t;
+		/**
+		 * Construct an arena which allocates from an existing memory Block.
+		 * Note: The arena does not take ownership of the block. The block must outlive the arena.
+		 * @param block Block of memory to allocate from.
+		 */
+		LinearArena(Block block);
+		/**
+		 * Construct an arena which owns a newly-allocated, cache-line aligned block of the given size.
+		 * @param size_bytes Capacity of the arena, in bytes.
+		 */
+		LinearArena(std::size_t size_bytes);
+		LinearArena(const LinearArena& copy) = delete;
+		LinearArena(LinearArena&& move);
+		LinearArena& operator=(const LinearArena& rhs) = delete;
+		LinearArena& operator=(LinearArena&& rhs);
+		~LinearArena();
+		/**
+		 * Allocate some memory from the arena.
+		 * Note: This never touches the global heap. If there is not enough space remaining, nullptr is returned and the arena is unchanged.
+		 * Precondition: alignment is a power of two. Otherwise, this will invoke UB without asserting.
+		 * @param size_bytes Number of bytes to allocate.
+		 * @param alignment Required alignment of the returned address, in bytes.
+		 * @return Pointer to uninitialised memory of at least size_bytes, or nullptr if the arena is exhausted.
+		 */
+		void* allocate(std::size_t size_bytes, std::size_t alignment = alignof(std::max_align_t));
+		/**
+		 * Retrieve a marker representing the current position of the arena.
+		 * @return Marker which can later be passed to rewind().
+		 */
+		Marker mark() const;
+		/**
+		 * Rewind the arena to a previous marker, discarding every allocation made since the marker was retrieved.
+		 * Precondition: The marker was retrieved from this arena and the arena has not since been rewound beyond it. Otherwise, this will assert and invoke UB.
+		 * @param marker Marker to rewind to.
+		 */
+		void rewind(Marker marker);
+		/**
+		 * Discard every allocation ever made by the arena. Typically invoked once per frame.
+		 */
+		void reset();
+		/**
+		 * Retrieve the number of bytes currently in-use, including alignment padding.
+		 * @return Number of used bytes.
+		 */
+		std::size_t size() const;
+		/**
+		 * Retrieve the total number of bytes that the arena can hand out.
+		 * @return Size of the underlying block, in bytes.
+		 */
+		std::size_t capacity() const;
+		/**
+		 * Retrieve the number of bytes which are not yet in-use.
+		 * @return this->capacity() - this->size().
+		 */
+		std::size_t remaining() const;
+		/**
+		 * Query as to whether the given address was handed out by this arena.
+		 * @param ptr Address to query.
+		 * @return True if the address lies within the arena's block. Otherwise false.
+		 */
+		bool contains(const void* ptr) const;
+	private:
+		/// Only non-null if the arena allocated its own block.
+		std::unique_ptr<AutoBlock> owned_block;
+		Block block;
+		std::size_t offset;
+	};
+
+	/**
+	 * Retrieves a marker from the given arena upon construction, and rewinds the arena back to it upon destruction (RAII).
+	 */
+	class ScopedMarker
+	{
+	public:
+		ScopedMarker(LinearArena& arena);
+		ScopedMarker(const ScopedMarker& copy) = delete;
+		ScopedMarker& operator=(const ScopedMarker& rhs) = delete;
+		~ScopedMarker();
+	private:
+		LinearArena& arena;
+		LinearArena::Marker marker;
+	};
+
+	/**
+	 * Adapts a LinearArena into a std::pmr::memory_resource, so that standard containers (such as std::pmr::vector) can allocate from it.
+	 * Deallocation of arena memory is a no-op; the memory is reclaimed when the arena is rewound or reset.
+	 * If the arena is exhausted, allocations fall back to the upstream resource instead.
+	 */
+	class ArenaResource : public std::pmr::memory_resource
+	{
+	public:
+		/**
+		 * Construct an adapter over the given arena.
+		 * @param arena Arena to allocate from. Must outlive this resource.
+		 * @param upstream Resource to use if the arena runs out of space. By default, this is the global heap.
+		 */
+		ArenaResource(LinearArena& arena, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+	protected:
+		virtual void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+		virtual void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+		virtual bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+	private:
+		LinearArena* arena;
+		std::pmr::memory_resource* upstream;
+	};
+
+	/**
+	 * @}
+	 */
+}
+
+#endif // TOPAZ_MEMORY_ARENA_HPP
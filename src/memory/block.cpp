@@ -3,6 +3,14 @@
 //
 
 #include "memory/block.hpp"
+#include "memory/tracking.hpp"
+#include "core/debug/assert.hpp"
+#include <cstdlib>
+#if defined(__linux__)
+#include <sys/mman.h>
+#elif defined(_MSC_VER)
+#include <malloc.h>
+#endif
 
 namespace tz::mem
 {
@@ -26,10 +34,129 @@ namespace tz::mem
 		return {nullptr, nullptr};
 	}
 
-	AutoBlock::AutoBlock(std::size_t size): Block(std::malloc(size), size){}
+	namespace
+	{
+		std::size_t round_up(std::size_t value, std::size_t multiple)
+		{
+			return ((value + multiple - 1) / multiple) * multiple;
+		}
+
+		void* aligned_allocate(std::size_t size, std::size_t alignment)
+		{
+			#if defined(_MSC_VER)
+				return _aligned_malloc(size, alignment);
+			#else
+				// aligned_alloc requires the size to be a multiple of the alignment.
+				return std::aligned_alloc(alignment, round_up(std::max<std::size_t>(size, 1), alignment));
+			#endif
+		}
+
+		void aligned_free(void* ptr)
+		{
+			#if defined(_MSC_VER)
+				_aligned_free(ptr);
+			#else
+				std::free(ptr);
+			#endif
+		}
+	}
+
+	AutoBlock::AutoBlock(std::size_t size): Block(std::malloc(size), size), granted(AllocationPath::Malloc), mapping_size(0)
+	{
+		tracking::record_allocation(tracking::Tag::Block, this->size());
+	}
+
+	AutoBlock::AutoBlock(std::size_t size, std::size_t alignment, PageHint hint): Block(Block::null()), granted(AllocationPath::Malloc), mapping_size(0)
+	{
+		bool power_of_two = alignment != 0 && (alignment & (alignment - 1)) == 0;
+		topaz_assert(power_of_two, "tz::mem::AutoBlock::AutoBlock(", size, ", ", alignment, ", ...): Alignment must be a power of two.");
+		if(!power_of_two)
+		{
+			*static_cast<Block*>(this) = Block{std::malloc(size), size};
+			tracking::record_allocation(tracking::Tag::Block, this->size());
+			return;
+		}
+		void* ptr = nullptr;
+		#if defined(__linux__)
+			if(hint == PageHint::Huge)
+			{
+				// Over-map so that we can trim the mapping to a huge-page-aligned range. Otherwise the first and last partial huge pages can never be promoted.
+				std::size_t huge_alignment = std::max(alignment, alignment::huge_page);
+				std::size_t mapped_size = round_up(std::max<std::size_t>(size, 1), alignment::huge_page);
+				std::size_t oversized = mapped_size + huge_alignment;
+				void* raw = mmap(nullptr, oversized, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if(raw != MAP_FAILED)
+				{
+					auto raw_addr = reinterpret_cast<std::uintptr_t>(raw);
+					auto aligned_addr = (raw_addr + (huge_alignment - 1)) & ~static_cast<std::uintptr_t>(huge_alignment - 1);
+					std::size_t head = aligned_addr - raw_addr;
+					std::size_t tail = oversized - head - mapped_size;
+					if(head > 0)
+						munmap(raw, head);
+					if(tail > 0)
+						munmap(reinterpret_cast<void*>(aligned_addr + mapped_size), tail);
+					ptr = reinterpret_cast<void*>(aligned_addr);
+					this->mapping_size = mapped_size;
+					this->granted = madvise(ptr, mapped_size, MADV_HUGEPAGE) == 0 ? AllocationPath::HugePage : AllocationPath::Mapped;
+				}
+			}
+		#else
+			(void)hint;
+		#endif
+		if(ptr == nullptr)
+		{
+			ptr = aligned_allocate(size, alignment);
+			this->granted = AllocationPath::Aligned;
+		}
+		if(ptr == nullptr)
+		{
+			// The aligned allocation can fail for large alignments even when plain malloc would succeed. path() tells the caller that the alignment isn't guaranteed.
+			ptr = std::malloc(size);
+			this->granted = AllocationPath::Malloc;
+		}
+		// If even malloc failed, the block is empty rather than claiming bytes it doesn't have.
+		*static_cast<Block*>(this) = Block{ptr, ptr != nullptr ? size : 0};
+		tracking::record_allocation(tracking::Tag::Block, this->size());
+	}
 
 	AutoBlock::~AutoBlock()
 	{
-		std::free(this->begin);
+		tracking::record_free(tracking::Tag::Block, this->size());
+		switch(this->granted)
+		{
+			case AllocationPath::Malloc:
+				std::free(this->begin);
+			break;
+			case AllocationPath::Aligned:
+				aligned_free(this->begin);
+			break;
+			case AllocationPath::Mapped:
+			case AllocationPath::HugePage:
+			#if defined(__linux__)
+				munmap(this->begin, this->mapping_size);
+			#endif
+			break;
+		}
+	}
+
+	AllocationPath AutoBlock::path() const
+	{
+		return this->granted;
+	}
+
+	const char* to_string(AllocationPath path)
+	{
+		switch(path)
+		{
+			case AllocationPath::Malloc:
+				return "Malloc";
+			case AllocationPath::Aligned:
+				return "Aligned";
+			case AllocationPath::Mapped:
+				return "Mapped";
+			case AllocationPath::HugePage:
+				return "HugePage";
+		}
+		return "Unknown";
 	}
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #ifndef TOPAZ_CONTIGUOUS_BLOCK_HPP
 #define TOPAZ_CONTIGUOUS_BLOCK_HPP
+#include <cstddef>
 #include <cstdint>
 #include <algorithm>
 
@@ -31,15 +32,84 @@ namespace tz::mem
 		void* end;
 	};
 
+	namespace alignment
+	{
+		/// Typical size of a CPU cache-line, in bytes.
+		constexpr std::size_t cache_line = 64;
+		/// Size of a standard memory page on most platforms, in bytes.
+		constexpr std::size_t page = 4096;
+		/// Size of a transparent huge page on x86-64 Linux, in bytes.
+		constexpr std::size_t huge_page = 2 * 1024 * 1024;
+	}
+
+	/**
+	 * Describes how an AutoBlock's memory was actually obtained.
+	 */
+	enum class AllocationPath
+	{
+		/// Plain std::malloc. Only aligned to alignof(std::max_align_t).
+		Malloc,
+		/// Aligned heap allocation.
+		Aligned,
+		/// Anonymous memory mapping, but the huge-page advice was rejected (e.g transparent huge pages are disabled).
+		Mapped,
+		/// Anonymous memory mapping which the kernel accepted advice to back with huge pages. The kernel may still decline to provide them for some ranges.
+		HugePage
+	};
+
+	/**
+	 * Specifies the kind of pages an AutoBlock would like to be backed by.
+	 */
+	enum class PageHint
+	{
+		/// Whatever the allocator provides.
+		Default,
+		/// Request transparent huge pages. Only honoured on Linux; elsewhere, this falls back to an aligned allocation.
+		Huge
+	};
+
 	/**
 	 * Similar to a block, but allocates the block dynamically and uses that (RAII).
 	 */
 	struct AutoBlock : public Block
 	{
+		/**
+		 * Allocate a block of the given size via std::malloc.
+		 * @param size Size of the block, in bytes.
+		 */
 		AutoBlock(std::size_t size);
+		/**
+		 * Allocate a block of the given size, whose beginning is aligned to the given alignment.
+		 * Note: Huge pages reduce TLB misses when streaming through very large blocks (hundreds of MB). For small blocks, they waste memory.
+		 * Note: If the requested path is unavailable, this falls back to an aligned heap allocation. If that fails too, this falls back to std::malloc, which does not guarantee the alignment. Use this->path() to find out which path was granted.
+		 * Note: If no allocation succeeds, the block is empty (null with a size of zero).
+		 * Precondition: alignment is a power of two. Otherwise, this will assert and fall back to std::malloc.
+		 * @param size Size of the block, in bytes.
+		 * @param alignment Required alignment of the beginning of the block, in bytes. See tz::mem::alignment for common values.
+		 * @param hint Type of pages to request.
+		 */
+		AutoBlock(std::size_t size, std::size_t alignment, PageHint hint = PageHint::Default);
+		AutoBlock(const AutoBlock& copy) = delete;
+		AutoBlock& operator=(const AutoBlock& rhs) = delete;
 		~AutoBlock();
+		/**
+		 * Retrieve the allocation path that was actually granted.
+		 * @return Path used to allocate this block.
+		 */
+		AllocationPath path() const;
+	private:
+		AllocationPath granted;
+		/// Size of the underlying mapping, which may be larger than this->size(). Only meaningful for mapped paths.
+		std::size_t mapping_size;
 	};
 
+	/**
+	 * Retrieve a human-readable name for the given allocation path.
+	 * @param path Allocation path.
+	 * @return Null-terminated name, such as "HugePage".
+	 */
+	const char* to_string(AllocationPath path);
+
 	/**
 	 * @}
 	 */
@@ -0,0 +1,256 @@
+#include "memory/offset_allocator.hpp"
+#include "core/debug/assert.hpp"
+#include <algorithm>
+#if _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace tz::mem
+{
+	namespace
+	{
+		std::size_t lowest_bit(std::uint64_t word)
+		{
+			#if _MSC_VER
+				unsigned long idx;
+				_BitScanForward64(&idx, word);
+				return static_cast<std::size_t>(idx);
+			#else
+				return static_cast<std::size_t>(__builtin_ctzll(word));
+			#endif
+		}
+
+		std::size_t highest_bit(std::uint64_t word)
+		{
+			#if _MSC_VER
+				unsigned long idx;
+				_BitScanReverse64(&idx, word);
+				return static_cast<std::size_t>(idx);
+			#else
+				return static_cast<std::size_t>(63 - __builtin_clzll(word));
+			#endif
+		}
+	}
+
+	float OffsetAllocatorStats::fragmentation() const
+	{
+		if(this->free == 0)
+			return 0.0f;
+		return 1.0f - (static_cast<float>(this->largest_free_region) / static_cast<float>(this->free));
+	}
+
+	OffsetAllocator::OffsetAllocator(std::size_t capacity): total_capacity(capacity), nodes(), unused_nodes(), bin_heads(), first_level_mask(0), second_level_masks(), used(0), allocation_count(0), free_region_count(0), coalesce_count(0)
+	{
+		this->reset();
+	}
+
+	std::optional<OffsetAllocation> OffsetAllocator::allocate(std::size_t size)
+	{
+		topaz_assert(size > 0, "tz::mem::OffsetAllocator::allocate(", size, "): Cannot allocate zero units.");
+		if(size == 0)
+			return std::nullopt;
+		std::uint32_t node_id = this->find_free_node(size);
+		if(node_id == null_node)
+			return std::nullopt;
+		this->bin_remove(node_id);
+		this->nodes[node_id].used = true;
+		std::size_t remainder = this->nodes[node_id].size - size;
+		if(remainder > 0)
+		{
+			// Split off the tail of the region and give it back to the bins.
+			std::uint32_t tail_id = this->create_node(this->nodes[node_id].offset + size, remainder);
+			Node& node = this->nodes[node_id];
+			Node& tail = this->nodes[tail_id];
+			tail.neighbour_prev = node_id;
+			tail.neighbour_next = node.neighbour_next;
+			if(node.neighbour_next != null_node)
+				this->nodes[node.neighbour_next].neighbour_prev = tail_id;
+			node.neighbour_next = tail_id;
+			node.size = size;
+			this->bin_insert(tail_id);
+		}
+		this->used += size;
+		this->allocation_count++;
+		const Node& node = this->nodes[node_id];
+		return OffsetAllocation{node.offset, node.size, node_id};
+	}
+
+	void OffsetAllocator::free(OffsetAllocation allocation)
+	{
+		std::uint32_t node_id = allocation.node;
+		topaz_assert(node_id < this->nodes.size() && this->nodes[node_id].used && this->nodes[node_id].offset == allocation.offset, "tz::mem::OffsetAllocator::free(", allocation.offset, ", ", allocation.size, "): Allocation is not live in this allocator. Was it already freed?");
+		this->used -= this->nodes[node_id].size;
+		this->allocation_count--;
+		this->nodes[node_id].used = false;
+		// Merge with the preceding region if it's free.
+		std::uint32_t prev_id = this->nodes[node_id].neighbour_prev;
+		if(prev_id != null_node && !this->nodes[prev_id].used)
+		{
+			this->bin_remove(prev_id);
+			Node& node = this->nodes[node_id];
+			const Node& prev = this->nodes[prev_id];
+			node.offset = prev.offset;
+			node.size += prev.size;
+			node.neighbour_prev = prev.neighbour_prev;
+			if(node.neighbour_prev != null_node)
+				this->nodes[node.neighbour_prev].neighbour_next = node_id;
+			this->release_node(prev_id);
+			this->coalesce_count++;
+		}
+		// And the following region.
+		std::uint32_t next_id = this->nodes[node_id].neighbour_next;
+		if(next_id != null_node && !this->nodes[next_id].used)
+		{
+			this->bin_remove(next_id);
+			Node& node = this->nodes[node_id];
+			const Node& next = this->nodes[next_id];
+			node.size += next.size;
+			node.neighbour_next = next.neighbour_next;
+			if(node.neighbour_next != null_node)
+				this->nodes[node.neighbour_next].neighbour_prev = node_id;
+			this->release_node(next_id);
+			this->coalesce_count++;
+		}
+		this->bin_insert(node_id);
+	}
+
+	void OffsetAllocator::reset()
+	{
+		this->nodes.clear();
+		this->unused_nodes.clear();
+		this->bin_heads.fill(null_node);
+		this->first_level_mask = 0;
+		this->second_level_masks.fill(0);
+		this->used = 0;
+		this->allocation_count = 0;
+		this->free_region_count = 0;
+		this->coalesce_count = 0;
+		if(this->total_capacity > 0)
+			this->bin_insert(this->create_node(0, this->total_capacity));
+	}
+
+	std::size_t OffsetAllocator::capacity() const
+	{
+		return this->total_capacity;
+	}
+
+	OffsetAllocatorStats OffsetAllocator::stats() const
+	{
+		std::size_t largest = 0;
+		if(this->first_level_mask != 0)
+		{
+			std::size_t first_level = highest_bit(this->first_level_mask);
+			std::size_t bin = first_level * second_level_count + highest_bit(this->second_level_masks[first_level]);
+			for(std::uint32_t node_id = this->bin_heads[bin]; node_id != null_node; node_id = this->nodes[node_id].bin_next)
+				largest = std::max(largest, this->nodes[node_id].size);
+		}
+		return {this->total_capacity, this->used, this->total_capacity - this->used, this->allocation_count, this->free_region_count, largest, this->coalesce_count};
+	}
+
+	/*static*/ std::size_t OffsetAllocator::bin_floor(std::size_t size)
+	{
+		// Small sizes each get their own bin. Otherwise, the top bit picks the first-level and the next few bits pick the second-level.
+		if(size < second_level_count)
+			return size;
+		std::size_t top_bit = highest_bit(size);
+		std::size_t first_level = top_bit - (second_level_bits - 1);
+		std::size_t second_level = (size >> (top_bit - second_level_bits)) & (second_level_count - 1);
+		return first_level * second_level_count + second_level;
+	}
+
+	/*static*/ std::size_t OffsetAllocator::bin_min_size(std::size_t bin)
+	{
+		if(bin < second_level_count)
+			return bin;
+		std::size_t first_level = bin / second_level_count;
+		std::size_t second_level = bin % second_level_count;
+		std::size_t top_bit = first_level + (second_level_bits - 1);
+		return (second_level_count | second_level) << (top_bit - second_level_bits);
+	}
+
+	std::uint32_t OffsetAllocator::create_node(std::size_t offset, std::size_t size)
+	{
+		Node node{offset, size, null_node, null_node, null_node, null_node, false};
+		if(!this->unused_nodes.empty())
+		{
+			std::uint32_t node_id = this->unused_nodes.back();
+			this->unused_nodes.pop_back();
+			this->nodes[node_id] = node;
+			return node_id;
+		}
+		this->nodes.push_back(node);
+		return static_cast<std::uint32_t>(this->nodes.size() - 1);
+	}
+
+	void OffsetAllocator::release_node(std::uint32_t node)
+	{
+		this->unused_nodes.push_back(node);
+	}
+
+	void OffsetAllocator::bin_insert(std::uint32_t node_id)
+	{
+		Node& node = this->nodes[node_id];
+		std::size_t bin = bin_floor(node.size);
+		node.bin_prev = null_node;
+		node.bin_next = this->bin_heads[bin];
+		if(node.bin_next != null_node)
+			this->nodes[node.bin_next].bin_prev = node_id;
+		this->bin_heads[bin] = node_id;
+		std::size_t first_level = bin / second_level_count;
+		this->first_level_mask |= std::uint64_t{1} << first_level;
+		this->second_level_masks[first_level] |= static_cast<std::uint8_t>(1u << (bin % second_level_count));
+		this->free_region_count++;
+	}
+
+	void OffsetAllocator::bin_remove(std::uint32_t node_id)
+	{
+		Node& node = this->nodes[node_id];
+		std::size_t bin = bin_floor(node.size);
+		if(node.bin_prev != null_node)
+			this->nodes[node.bin_prev].bin_next = node.bin_next;
+		else
+			this->bin_heads[bin] = node.bin_next;
+		if(node.bin_next != null_node)
+			this->nodes[node.bin_next].bin_prev = node.bin_prev;
+		node.bin_prev = null_node;
+		node.bin_next = null_node;
+		if(this->bin_heads[bin] == null_node)
+		{
+			std::size_t first_level = bin / second_level_count;
+			this->second_level_masks[first_level] &= static_cast<std::uint8_t>(~(1u << (bin % second_level_count)));
+			if(this->second_level_masks[first_level] == 0)
+				this->first_level_mask &= ~(std::uint64_t{1} << first_level);
+		}
+		this->free_region_count--;
+	}
+
+	std::uint32_t OffsetAllocator::find_free_node(std::size_t size) const
+	{
+		// Round up to a bin whose every region is guaranteed to be large enough.
+		std::size_t floor_bin = bin_floor(size);
+		std::size_t bin = floor_bin;
+		if(bin_min_size(bin) < size)
+			bin++;
+		if(bin < bin_count)
+		{
+			std::size_t first_level = bin / second_level_count;
+			std::uint32_t second_level_candidates = this->second_level_masks[first_level] & (0xFFu << (bin % second_level_count));
+			if(second_level_candidates != 0)
+				return this->bin_heads[first_level * second_level_count + lowest_bit(second_level_candidates)];
+			// Nothing in this first-level, so take the smallest non-empty bin in any larger first-level.
+			std::uint64_t first_level_candidates = (first_level + 1 < 64) ? (this->first_level_mask & ~((std::uint64_t{1} << (first_level + 1)) - 1)) : 0;
+			if(first_level_candidates != 0)
+			{
+				first_level = lowest_bit(first_level_candidates);
+				return this->bin_heads[first_level * second_level_count + lowest_bit(this->second_level_masks[first_level])];
+			}
+		}
+		// Last resort: The rounded-down bin may still hold a region which fits. This is the only non-constant path, and only happens when the allocator is nearly full.
+		for(std::uint32_t node_id = this->bin_heads[floor_bin]; node_id != null_node; node_id = this->nodes[node_id].bin_next)
+		{
+			if(this->nodes[node_id].size >= size)
+				return node_id;
+		}
+		return null_node;
+	}
+}
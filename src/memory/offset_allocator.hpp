@@ -0,0 +1,146 @@
+#ifndef TOPAZ_MEMORY_OFFSET_ALLOCATOR_HPP
+#define TOPAZ_MEMORY_OFFSET_ALLOCATOR_HPP
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace tz::mem
+{
+	/**
+	 * \addtogroup tz_mem Topaz Memory Library (tz::mem)
+	 * A collection of low-level abstractions around memory utilities not provided by the C++ standard library. This includes non-owning memory blocks, uniform memory-pools and more.
+	 * @{
+	 */
+
+	/**
+	 * Represents a range handed out by an OffsetAllocator.
+	 */
+	struct OffsetAllocation
+	{
+		/// Beginning of the range, in units.
+		std::size_t offset;
+		/// Length of the range, in units.
+		std::size_t size;
+		/// Opaque identifier used by the allocator to free the range in constant time.
+		std::uint32_t node;
+	};
+
+	/**
+	 * Snapshot of the state of an OffsetAllocator. All quantities are in units.
+	 */
+	struct OffsetAllocatorStats
+	{
+		/**
+		 * Retrieve a measure of external fragmentation between 0 and 1.
+		 * A value of 0 means that all free space is contiguous. Values approaching 1 mean that the free space is scattered in small regions.
+		 * @return 1 - (largest_free_region / free). If nothing is free, this is 0.
+		 */
+		float fragmentation() const;
+
+		/// Total number of units managed by the allocator.
+		std::size_t capacity;
+		/// Number of units currently allocated.
+		std::size_t used;
+		/// Number of units not currently allocated.
+		std::size_t free;
+		/// Number of live allocations.
+		std::size_t allocation_count;
+		/// Number of disjoint free regions.
+		std::size_t free_region_count;
+		/// Size of the largest free region.
+		std::size_t largest_free_region;
+		/// Total number of times a freed range has been merged with an adjacent free region.
+		std::size_t coalesce_count;
+	};
+
+	/**
+	 * Allocates ranges (offset, size) out of a fixed-size linear address space, without touching the memory itself.
+	 * Units are arbitrary: They could be bytes, vertices, indices or anything else. This makes the allocator ideal for sub-allocating GPU buffers.
+	 * Uses a two-level segregated-fit (TLSF) scheme, so both allocate() and free() are O(1). Freed ranges are immediately coalesced with free neighbours.
+	 * Note: If no size class is guaranteed to fit a request, allocate() falls back to searching the one size class which might. This keeps the allocator able to fill itself completely.
+	 */
+	class OffsetAllocator
+	{
+	public:
+		/**
+		 * Construct an allocator managing the range [0, capacity).
+		 * @param capacity Number of units which can be handed out.
+		 */
+		OffsetAllocator(std::size_t capacity);
+		/**
+		 * Allocate a contiguous range.
+		 * Precondition: size must be non-zero. Otherwise, this will assert and return null.
+		 * @param size Number of units to allocate.
+		 * @return Allocated range if there was a free region large enough. Otherwise null.
+		 */
+		std::optional<OffsetAllocation> allocate(std::size_t size);
+		/**
+		 * Return a previously-allocated range to the allocator.
+		 * Precondition: The allocation was retrieved from this allocator and has not already been freed. Otherwise, this will assert and invoke UB.
+		 * @param allocation Range to free.
+		 */
+		void free(OffsetAllocation allocation);
+		/**
+		 * Free all allocations. Any existing allocations must not be passed to free() afterwards.
+		 */
+		void reset();
+		/**
+		 * Retrieve the number of units managed by the allocator.
+		 * @return Capacity of the allocator.
+		 */
+		std::size_t capacity() const;
+		/**
+		 * Retrieve statistics about the current state of the allocator.
+		 * Note: This is not O(1) -- It walks the free-list of the largest bin.
+		 * @return Allocator statistics.
+		 */
+		OffsetAllocatorStats stats() const;
+	private:
+		static constexpr std::uint32_t null_node = 0xFFFFFFFF;
+		/// Each power-of-two size class is subdivided into this many linear bins.
+		static constexpr std::size_t second_level_bits = 3;
+		static constexpr std::size_t second_level_count = 1 << second_level_bits;
+		static constexpr std::size_t first_level_count = 64 - (second_level_bits - 1);
+		static constexpr std::size_t bin_count = first_level_count * second_level_count;
+
+		struct Node
+		{
+			std::size_t offset;
+			std::size_t size;
+			std::uint32_t bin_prev;
+			std::uint32_t bin_next;
+			std::uint32_t neighbour_prev;
+			std::uint32_t neighbour_next;
+			bool used;
+		};
+
+		static std::size_t bin_floor(std::size_t size);
+		static std::size_t bin_min_size(std::size_t bin);
+		std::uint32_t create_node(std::size_t offset, std::size_t size);
+		void release_node(std::uint32_t node);
+		void bin_insert(std::uint32_t node);
+		void bin_remove(std::uint32_t node);
+		std::uint32_t find_free_node(std::size_t size) const;
+
+		std::size_t total_capacity;
+		std::vector<Node> nodes;
+		std::vector<std::uint32_t> unused_nodes;
+		std::array<std::uint32_t, bin_count> bin_heads;
+		/// Bit n is set if any bin in first-level n is non-empty.
+		std::uint64_t first_level_mask;
+		/// Bit n of element m is set if bin (m * second_level_count + n) is non-empty.
+		std::array<std::uint8_t, first_level_count> second_level_masks;
+		std::size_t used;
+		std::size_t allocation_count;
+		std::size_t free_region_count;
+		std::size_t coalesce_count;
+	};
+
+	/**
+	 * @}
+	 */
+}
+
+#endif // TOPAZ_MEMORY_OFFSET_ALLOCATOR_HPP
@@ -5,6 +5,12 @@
 #ifndef TOPAZ_POOL_HPP
 #define TOPAZ_POOL_HPP
 #include "memory/block.hpp"
+#include "memory/span.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace tz::mem
@@ -17,14 +23,14 @@ namespace tz::mem
 
 	namespace detail
 	{
-		class BoolProxy
-		{
-		public:
-			BoolProxy(bool b): b(b){}
-			operator bool() const{return this->b;}
-		private:
-			bool b;
-		};
+		/// Word type used to pack pool occupancy bits. One bit per slot.
+		using MaskWord = std::uint64_t;
+		constexpr std::size_t mask_word_bits = sizeof(MaskWord) * 8;
+		/**
+		 * Retrieve the index of the lowest set bit in the given word.
+		 * Precondition: word != 0. Otherwise, the result is unspecified.
+		 */
+		inline std::size_t lowest_set_bit(MaskWord word);
 	}
 	/**
 	 * Manages a pre-allocated block of memory, treating it as a contiguous array of Ts.
@@ -53,9 +59,19 @@ namespace tz::mem
 		 * @param size_bytes
 		 */
 		UniformPool(void* begin, std::size_t size_bytes);
+		UniformPool(const UniformPool& copy);
+		UniformPool(UniformPool&& move);
+		UniformPool& operator=(const UniformPool& rhs);
+		UniformPool& operator=(UniformPool&& rhs);
 		/**
-		 * TODO: Document
-		 * @return
+		 * Stops accounting the live elements to tz::mem::tracking::Tag::Pool.
+		 * Note: The elements are not destroyed, as the pool does not own the underlying memory. Use clear() to destroy them.
+		 */
+		~UniformPool();
+		/**
+		 * Retrieve the number of live Ts within the pool.
+		 * Note: This is a constant-time operation; the pool keeps track of its own element count.
+		 * @return Number of slots which currently contain a T.
 		 */
 		std::size_t size() const;
 		/**
@@ -107,6 +123,22 @@ namespace tz::mem
 		 */
 		template<typename... Args>
 		T& emplace(std::size_t index, Args&&... args);
+		/**
+		 * Construct a new T in any free slot within the pool, and retrieve the index of that slot.
+		 * Slots freed by erase/deallocate are re-used before untouched slots are handed out. This is a constant-time operation (amortised) and never scans the pool.
+		 * Precondition: The pool is not full. Otherwise, this will assert and invoke UB.
+		 * @tparam Args Types of the arguments used to construct the T.
+		 * @param args Values of the arguments used to construct the T.
+		 * @return Index of the slot containing the newly-constructed T.
+		 */
+		template<typename... Args>
+		std::size_t allocate(Args&&... args);
+		/**
+		 * Destroy the T at the given index, returning the slot to the pool so that it may be re-used by a subsequent allocate().
+		 * Note: This is equivalent to erase(index).
+		 * @param index Index of the slot to free.
+		 */
+		void deallocate(std::size_t index);
 		/**
 		 * TODO: Document
 		 * @param index
@@ -125,6 +157,25 @@ namespace tz::mem
 		 */
 		template<typename As = T>
 		void debug_print_as() const;
+		/**
+		 * Invoke the given functor once for every live T in the pool, in ascending index order.
+		 * Empty regions of the pool are skipped a whole mask-word (64 slots) at a time, so this is far cheaper than checking every index for sparse pools.
+		 * Note: The functor may either accept (T&) or (std::size_t index, T&).
+		 * Note: The functor must not insert or erase elements of this pool.
+		 * @tparam Functor Type of the functor to invoke.
+		 * @param fn Functor to invoke for each live element.
+		 */
+		template<typename Functor>
+		void for_each_live(Functor&& fn);
+		/**
+		 * Invoke the given functor once for every live T in the pool, in ascending index order.
+		 * Empty regions of the pool are skipped a whole mask-word (64 slots) at a time, so this is far cheaper than checking every index for sparse pools.
+		 * Note: The functor may either accept (const T&) or (std::size_t index, const T&).
+		 * @tparam Functor Type of the functor to invoke.
+		 * @param fn Functor to invoke for each live element.
+		 */
+		template<typename Functor>
+		void for_each_live(Functor&& fn) const;
 	private:
 		/**
 		 * TODO: Document
@@ -144,9 +195,25 @@ namespace tz::mem
 		 * @return
 		 */
 		T* at(std::size_t index);
+		/// Grow the object mask so that it has a bit for the given index.
+		void ensure_mask(std::size_t index);
+		/// Mark the slot at the given index as occupied, updating the live count if it wasn't already.
+		void occupy(std::size_t index);
+		/// Mark the slot at the given index as free, updating the live count and free-list if it was occupied.
+		void vacate(std::size_t index);
+
 		void* begin;
 		std::size_t size_bytes;
-		std::vector<detail::BoolProxy> object_mask;
+		/// Occupancy bitset. Bit (i % 64) of word (i / 64) is set if slot i contains a T.
+		std::vector<detail::MaskWord> object_mask;
+		/// Number of slots currently containing a T.
+		std::size_t live_count;
+		/// Every slot at or beyond this index has never been handed out by allocate().
+		std::size_t untouched_index;
+		/// Stack of previously-freed slots. Entries may have since been re-occupied via set/emplace; allocate() skips those.
+		std::vector<std::size_t> free_list;
+		/// Bit i is set if slot i is somewhere in the free-list. Slots are never listed twice, so the free-list can't outgrow the pool no matter how often a slot is set and erased.
+		std::vector<detail::MaskWord> listed_mask;
 	};
 
 	/**
@@ -221,6 +288,96 @@ namespace tz::mem
 		Tuple* values;
 	};
 
+	/**
+	 * Manages a pre-allocated block of memory, treating it as a column-oriented (struct-of-arrays) table of tuple<Ts...>.
+	 * Each T is stored in its own contiguous array, aligned for SIMD loads. Loops which only touch a few columns don't drag whole records through the cache.
+	 * Elements are densely packed: Erasure swaps the last element into the gap.
+	 * @tparam Ts - Types of each column.
+	 */
+	template<typename... Ts>
+	class SoAPool
+	{
+	public:
+		template<std::size_t I>
+		using ValueType = std::tuple_element_t<I, std::tuple<Ts...>>;
+		/// Every column begins on an address aligned to at least this many bytes (enough for a 256-bit SIMD load).
+		static constexpr std::size_t column_alignment = std::max({std::size_t{32}, alignof(Ts)...});
+		/**
+		 * Construct an empty SoAPool within the given memory block. The capacity is the largest number of elements whose columns fit in the block.
+		 * Note: The block need not be aligned; the pool aligns its own columns.
+		 * @param block Memory block to use as storage. Must outlive the pool.
+		 */
+		SoAPool(Block block);
+		SoAPool(const SoAPool& copy) = delete;
+		SoAPool& operator=(const SoAPool& rhs) = delete;
+		/**
+		 * Destroys all live elements. The underlying memory is untouched.
+		 */
+		~SoAPool();
+		/**
+		 * Retrieve the number of bytes needed by a block to guarantee a pool capacity of at least the given number of elements, regardless of the block's alignment.
+		 * @param capacity Desired number of elements.
+		 * @return Required block size, in bytes.
+		 */
+		static constexpr std::size_t required_size(std::size_t capacity);
+		/**
+		 * Retrieve the number of live elements.
+		 * @return Number of elements.
+		 */
+		std::size_t size() const;
+		/**
+		 * Retrieve the maximum number of elements which can be stored.
+		 * @return Capacity of the pool.
+		 */
+		std::size_t capacity() const;
+		bool empty() const;
+		bool full() const;
+		/**
+		 * Append an element to the end of every column.
+		 * Precondition: !this->full(). Otherwise, this will assert and return this->capacity().
+		 * @param values Value of each column for the new element.
+		 * @return Index of the new element.
+		 */
+		std::size_t push(Ts... values);
+		/**
+		 * Erase the element at the given index. The last element is moved into its place, so the index of the last element changes.
+		 * Precondition: idx < this->size(). Otherwise, this will assert and do nothing.
+		 * @param idx Index of the element to erase.
+		 */
+		void erase(std::size_t idx);
+		/**
+		 * Erase all elements.
+		 */
+		void clear();
+		/**
+		 * Retrieve a view of the Ith column.
+		 * Static Precondition: I < sizeof...(Ts). Otherwise, this will fail to compile.
+		 * Example: SoAPool<Vec3, Quaternion>::get<0>() will retrieve a span of Vec3s, one for each live element.
+		 * @tparam I The index of the template parameter pack to retrieve.
+		 * @return Span of this->size() elements. The data pointer is aligned to SoAPool<Ts...>::column_alignment.
+		 */
+		template<std::size_t I>
+		Span<ValueType<I>> get();
+		template<std::size_t I>
+		Span<const ValueType<I>> get() const;
+	private:
+		static constexpr std::size_t column_count = sizeof...(Ts);
+		/// Number of bytes needed to lay out all columns for the given capacity, starting at an aligned address.
+		static constexpr std::size_t layout_size(std::size_t capacity);
+		template<std::size_t I>
+		ValueType<I>* column();
+		template<std::size_t I>
+		const ValueType<I>* column() const;
+		template<std::size_t... Is>
+		void push_impl(std::index_sequence<Is...>, Ts&&... values);
+		template<std::size_t... Is>
+		void erase_impl(std::index_sequence<Is...>, std::size_t idx);
+
+		std::array<void*, sizeof...(Ts)> columns;
+		std::size_t count;
+		std::size_t max_count;
+	};
+
 	/**
 	 * @}
 	 */
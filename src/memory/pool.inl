@@ -1,9 +1,30 @@
+#include "memory/tracking.hpp"
 #include "core/debug/assert.hpp"
 #include <cstddef>
+#include <new>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace tz::mem
-{	
+{
+	namespace detail
+	{
+		inline std::size_t lowest_set_bit(MaskWord word)
+		{
+			#if defined(_MSC_VER)
+				unsigned long idx;
+				_BitScanForward64(&idx, word);
+				return static_cast<std::size_t>(idx);
+			#else
+				return static_cast<std::size_t>(__builtin_ctzll(word));
+			#endif
+		}
+	}
+
 	template<typename T>
 	UniformPool<T>::UniformPool(void* begin, void* end): UniformPool<T>(begin, byte_distance(begin, end)){}
 	
@@ -11,18 +32,67 @@ namespace tz::mem
 	UniformPool<T>::UniformPool(Block block): UniformPool<T>(block.begin, block.end){}
 
 	template<typename T>
-	UniformPool<T>::UniformPool(void* begin, std::size_t size_bytes): begin(begin), size_bytes(size_bytes){}
+	UniformPool<T>::UniformPool(void* begin, std::size_t size_bytes): begin(begin), size_bytes(size_bytes), object_mask(), live_count(0), untouched_index(0), free_list(), listed_mask(){}
+
+	template<typename T>
+	UniformPool<T>::UniformPool(const UniformPool<T>& copy): begin(copy.begin), size_bytes(copy.size_bytes), object_mask(copy.object_mask), live_count(copy.live_count), untouched_index(copy.untouched_index), free_list(copy.free_list), listed_mask(copy.listed_mask)
+	{
+		tracking::record_allocation(tracking::Tag::Pool, this->live_count * sizeof(T));
+	}
+
+	template<typename T>
+	UniformPool<T>::UniformPool(UniformPool<T>&& move): begin(move.begin), size_bytes(move.size_bytes), object_mask(std::move(move.object_mask)), live_count(std::exchange(move.live_count, 0)), untouched_index(std::exchange(move.untouched_index, 0)), free_list(std::move(move.free_list)), listed_mask(std::move(move.listed_mask))
+	{
+		// The moved-from pool is left empty, so it mustn't un-account the elements we've taken over.
+		move.object_mask.clear();
+		move.free_list.clear();
+		move.listed_mask.clear();
+	}
+
+	template<typename T>
+	UniformPool<T>& UniformPool<T>::operator=(const UniformPool<T>& rhs)
+	{
+		tracking::record_free(tracking::Tag::Pool, this->live_count * sizeof(T));
+		this->begin = rhs.begin;
+		this->size_bytes = rhs.size_bytes;
+		this->object_mask = rhs.object_mask;
+		this->live_count = rhs.live_count;
+		this->untouched_index = rhs.untouched_index;
+		this->free_list = rhs.free_list;
+		this->listed_mask = rhs.listed_mask;
+		tracking::record_allocation(tracking::Tag::Pool, this->live_count * sizeof(T));
+		return *this;
+	}
+
+	template<typename T>
+	UniformPool<T>& UniformPool<T>::operator=(UniformPool<T>&& rhs)
+	{
+		if(this == &rhs)
+			return *this;
+		tracking::record_free(tracking::Tag::Pool, this->live_count * sizeof(T));
+		this->begin = rhs.begin;
+		this->size_bytes = rhs.size_bytes;
+		this->object_mask = std::move(rhs.object_mask);
+		this->live_count = std::exchange(rhs.live_count, 0);
+		this->untouched_index = std::exchange(rhs.untouched_index, 0);
+		this->free_list = std::move(rhs.free_list);
+		this->listed_mask = std::move(rhs.listed_mask);
+		rhs.object_mask.clear();
+		rhs.free_list.clear();
+		rhs.listed_mask.clear();
+		return *this;
+	}
+
+	template<typename T>
+	UniformPool<T>::~UniformPool()
+	{
+		tracking::record_free(tracking::Tag::Pool, this->live_count * sizeof(T));
+	}
 	
 	template<typename T>
 	std::size_t UniformPool<T>::size() const
 	{
-		std::size_t sz = 0;
-		for(const auto& b : this->object_mask)
-		{
-			if(b)
-				sz++;
-		}
-		return sz;
+		return this->live_count;
 	}
 	
 	template<typename T>
@@ -62,10 +132,8 @@ namespace tz::mem
 		}
 		// Now create our object here. No need to do anything with the return result because we are laundering memory.
 		new (ptr) T{t};
-		// Make sure our mask is long enough.
-		this->object_mask.resize(std::max(index + 1, this->object_mask.capacity()), false);
 		// And obviously we now have an object here.
-		this->object_mask[index] = true;
+		this->occupy(index);
 	}
 	
 	template<typename T>
@@ -83,10 +151,8 @@ namespace tz::mem
 			// if there was something here, we should invoke its destructor!
 			this->at(index)->~T();
 		}
-		// Make sure our mask is long enough.
-		this->object_mask.resize(std::max(index + 1, this->object_mask.capacity()), false);
 		// And obviously we no longer have an object here.
-		this->object_mask[index] = false;
+		this->vacate(index);
 	}
 	
 	template<typename T>
@@ -98,11 +164,14 @@ namespace tz::mem
 	template<typename T>
 	void UniformPool<T>::clear()
 	{
-		std::size_t sz = this->size();
-		for(std::size_t i = 0; i < sz; i++)
-		{
-			this->erase(i);
-		}
+		this->for_each_live([](T& t){t.~T();});
+		// Every slot is now free, so there's no need to remember which ones were freed.
+		this->object_mask.clear();
+		tracking::record_free(tracking::Tag::Pool, this->live_count * sizeof(T));
+		this->live_count = 0;
+		this->untouched_index = 0;
+		this->free_list.clear();
+		this->listed_mask.clear();
 	}
 	
 	template<typename T>
@@ -118,10 +187,50 @@ namespace tz::mem
 		}
 		// Now create the object in-place. No need to use the return as we always launder memory.
 		new (ptr) T{std::forward<Args>(args)...};
-		// Make sure our mask fits. Anything between our old limit and now aren't going to be objects obviously.
-		this->object_mask.resize(index + 1, false);
 		// We now have an object here.
-		this->object_mask[index] = true;
+		this->occupy(index);
+		return *this->at(index);
+	}
+
+	template<typename T>
+	template<typename... Args>
+	std::size_t UniformPool<T>::allocate(Args&&... args)
+	{
+		if(this->full())
+		{
+			// Assert + Early out as the unit-test will prevent these from being fatal.
+			topaz_assert(false, "UniformPool<T>::allocate(...): Pool is full. Capacity: ", this->capacity());
+			return this->capacity();
+		}
+		std::size_t index = this->capacity();
+		// Prefer recently-freed slots. Some of these may have been re-occupied via set/emplace since, so skip those.
+		while(!this->free_list.empty())
+		{
+			std::size_t candidate = this->free_list.back();
+			this->free_list.pop_back();
+			this->listed_mask[candidate / detail::mask_word_bits] &= ~(detail::MaskWord{1} << (candidate % detail::mask_word_bits));
+			if(!this->is_object(candidate))
+			{
+				index = candidate;
+				break;
+			}
+		}
+		if(index == this->capacity())
+		{
+			// No freed slots left, so take an untouched one. Again, set/emplace may have already filled some of these.
+			while(this->is_object(this->untouched_index))
+				this->untouched_index++;
+			index = this->untouched_index++;
+		}
+		topaz_assert(index < this->capacity(), "UniformPool<T>::allocate(...): Free slot ", index, " is beyond the capacity of ", this->capacity(), ". Live count must be corrupt.");
+		this->emplace(index, std::forward<Args>(args)...);
+		return index;
+	}
+
+	template<typename T>
+	void UniformPool<T>::deallocate(std::size_t index)
+	{
+		this->erase(index);
 	}
 	
 	template<typename T>
@@ -161,23 +270,102 @@ namespace tz::mem
 		std::cerr << "\nMasked Representation: {";
 		for(std::size_t i = 0; i < this->size_bytes / sizeof(T); i++)
 		{
-			if(this->object_mask.size() > i)
-				std::cerr << " " << this->object_mask[i];
-			else
-				std::cerr << " 0";
+			std::cerr << " " << this->is_object(i);
 		}
 		std::cerr << " }\n";
 #endif
 	}
 	
+	template<typename T>
+	template<typename Functor>
+	void UniformPool<T>::for_each_live(Functor&& fn)
+	{
+		for(std::size_t word_id = 0; word_id < this->object_mask.size(); word_id++)
+		{
+			detail::MaskWord word = this->object_mask[word_id];
+			// Empty words cost a single compare. Otherwise we visit each set bit without looking at the unset ones.
+			while(word != 0)
+			{
+				std::size_t index = (word_id * detail::mask_word_bits) + detail::lowest_set_bit(word);
+				// Clear the lowest set bit.
+				word &= (word - 1);
+				if constexpr(std::is_invocable_v<Functor, std::size_t, T&>)
+					fn(index, *this->at(index));
+				else
+					fn(*this->at(index));
+			}
+		}
+	}
+
+	template<typename T>
+	template<typename Functor>
+	void UniformPool<T>::for_each_live(Functor&& fn) const
+	{
+		for(std::size_t word_id = 0; word_id < this->object_mask.size(); word_id++)
+		{
+			detail::MaskWord word = this->object_mask[word_id];
+			while(word != 0)
+			{
+				std::size_t index = (word_id * detail::mask_word_bits) + detail::lowest_set_bit(word);
+				word &= (word - 1);
+				if constexpr(std::is_invocable_v<Functor, std::size_t, const T&>)
+					fn(index, *this->at(index));
+				else
+					fn(*this->at(index));
+			}
+		}
+	}
+	
 	template<typename T>
 	bool UniformPool<T>::is_object(std::size_t index) const
 	{
-		if(this->object_mask.size() <= index)
+		std::size_t word_id = index / detail::mask_word_bits;
+		if(this->object_mask.size() <= word_id)
 			return false;
-		return this->object_mask[index];
+		return (this->object_mask[word_id] >> (index % detail::mask_word_bits)) & 1u;
 	}
 	
+	template<typename T>
+	void UniformPool<T>::ensure_mask(std::size_t index)
+	{
+		std::size_t words_needed = (index / detail::mask_word_bits) + 1;
+		if(this->object_mask.size() < words_needed)
+			this->object_mask.resize(words_needed, detail::MaskWord{0});
+	}
+
+	template<typename T>
+	void UniformPool<T>::occupy(std::size_t index)
+	{
+		if(this->is_object(index))
+			return;
+		this->ensure_mask(index);
+		this->object_mask[index / detail::mask_word_bits] |= (detail::MaskWord{1} << (index % detail::mask_word_bits));
+		this->live_count++;
+		tracking::record_allocation(tracking::Tag::Pool, sizeof(T));
+	}
+
+	template<typename T>
+	void UniformPool<T>::vacate(std::size_t index)
+	{
+		if(!this->is_object(index))
+			return;
+		this->object_mask[index / detail::mask_word_bits] &= ~(detail::MaskWord{1} << (index % detail::mask_word_bits));
+		this->live_count--;
+		tracking::record_free(tracking::Tag::Pool, sizeof(T));
+		// Only slots which allocate() has already walked past need remembering. The rest will be found anyway.
+		if(index >= this->untouched_index)
+			return;
+		const std::size_t word_id = index / detail::mask_word_bits;
+		const detail::MaskWord bit = detail::MaskWord{1} << (index % detail::mask_word_bits);
+		if(this->listed_mask.size() <= word_id)
+			this->listed_mask.resize(word_id + 1, detail::MaskWord{0});
+		// Still listed from a previous erasure, which set/emplace has re-occupied since.
+		if((this->listed_mask[word_id] & bit) != 0)
+			return;
+		this->listed_mask[word_id] |= bit;
+		this->free_list.push_back(index);
+	}
+
 	template<typename T>
 	const T* UniformPool<T>::at(std::size_t index) const
 	{
@@ -244,5 +432,156 @@ namespace tz::mem
 	{
 		std::get<I>(*this->values) = value;
 	}
-	
-}
\ No newline at end of file
+
+	template<typename... Ts>
+	SoAPool<Ts...>::SoAPool(Block block): columns(), count(0), max_count(0)
+	{
+		auto begin_addr = reinterpret_cast<std::uintptr_t>(block.begin);
+		auto aligned_addr = (begin_addr + (column_alignment - 1)) & ~static_cast<std::uintptr_t>(column_alignment - 1);
+		std::size_t padding = static_cast<std::size_t>(aligned_addr - begin_addr);
+		std::size_t available = block.size() > padding ? block.size() - padding : 0;
+		// Start from the unpadded estimate and back off until the columns (including their alignment padding) actually fit.
+		constexpr std::size_t element_size = (sizeof(Ts) + ...);
+		std::size_t cap = available / element_size;
+		while(cap > 0 && layout_size(cap) > available)
+			cap--;
+		this->max_count = cap;
+		std::size_t offset = 0;
+		std::size_t column_id = 0;
+		auto place_column = [this, aligned_addr, cap, &offset, &column_id](std::size_t column_size)
+		{
+			offset = (offset + (column_alignment - 1)) & ~(column_alignment - 1);
+			this->columns[column_id++] = reinterpret_cast<void*>(aligned_addr + offset);
+			offset += column_size * cap;
+		};
+		(place_column(sizeof(Ts)), ...);
+	}
+
+	template<typename... Ts>
+	SoAPool<Ts...>::~SoAPool()
+	{
+		this->clear();
+	}
+
+	template<typename... Ts>
+	constexpr std::size_t SoAPool<Ts...>::required_size(std::size_t capacity)
+	{
+		// Worst-case, the block begins one byte past an aligned address.
+		return layout_size(capacity) + (column_alignment - 1);
+	}
+
+	template<typename... Ts>
+	std::size_t SoAPool<Ts...>::size() const
+	{
+		return this->count;
+	}
+
+	template<typename... Ts>
+	std::size_t SoAPool<Ts...>::capacity() const
+	{
+		return this->max_count;
+	}
+
+	template<typename... Ts>
+	bool SoAPool<Ts...>::empty() const
+	{
+		return this->count == 0;
+	}
+
+	template<typename... Ts>
+	bool SoAPool<Ts...>::full() const
+	{
+		return this->count == this->max_count;
+	}
+
+	template<typename... Ts>
+	std::size_t SoAPool<Ts...>::push(Ts... values)
+	{
+		topaz_assert(!this->full(), "tz::mem::SoAPool<Ts...>::push(...): Pool is full! Capacity: ", this->capacity());
+		if(this->full())
+			return this->capacity();
+		this->push_impl(std::index_sequence_for<Ts...>{}, std::move(values)...);
+		tracking::record_allocation(tracking::Tag::Pool, (sizeof(Ts) + ...));
+		return this->count++;
+	}
+
+	template<typename... Ts>
+	void SoAPool<Ts...>::erase(std::size_t idx)
+	{
+		topaz_assert(idx < this->size(), "tz::mem::SoAPool<Ts...>::erase(", idx, "): Index out of range. Size: ", this->size());
+		if(idx >= this->size())
+			return;
+		this->erase_impl(std::index_sequence_for<Ts...>{}, idx);
+		this->count--;
+		tracking::record_free(tracking::Tag::Pool, (sizeof(Ts) + ...));
+	}
+
+	template<typename... Ts>
+	void SoAPool<Ts...>::clear()
+	{
+		while(!this->empty())
+			this->erase(this->size() - 1);
+	}
+
+	template<typename... Ts>
+	template<std::size_t I>
+	Span<typename SoAPool<Ts...>::template ValueType<I>> SoAPool<Ts...>::get()
+	{
+		return {this->column<I>(), this->count};
+	}
+
+	template<typename... Ts>
+	template<std::size_t I>
+	Span<const typename SoAPool<Ts...>::template ValueType<I>> SoAPool<Ts...>::get() const
+	{
+		return {this->column<I>(), this->count};
+	}
+
+	template<typename... Ts>
+	constexpr std::size_t SoAPool<Ts...>::layout_size(std::size_t capacity)
+	{
+		std::size_t offset = 0;
+		for(std::size_t column_size : {sizeof(Ts)...})
+		{
+			offset = (offset + (column_alignment - 1)) & ~(column_alignment - 1);
+			offset += column_size * capacity;
+		}
+		return offset;
+	}
+
+	template<typename... Ts>
+	template<std::size_t I>
+	typename SoAPool<Ts...>::template ValueType<I>* SoAPool<Ts...>::column()
+	{
+		return static_cast<ValueType<I>*>(this->columns[I]);
+	}
+
+	template<typename... Ts>
+	template<std::size_t I>
+	const typename SoAPool<Ts...>::template ValueType<I>* SoAPool<Ts...>::column() const
+	{
+		return static_cast<const ValueType<I>*>(this->columns[I]);
+	}
+
+	template<typename... Ts>
+	template<std::size_t... Is>
+	void SoAPool<Ts...>::push_impl(std::index_sequence<Is...>, Ts&&... values)
+	{
+		(new (this->column<Is>() + this->count) Ts(std::move(values)), ...);
+	}
+
+	template<typename... Ts>
+	template<std::size_t... Is>
+	void SoAPool<Ts...>::erase_impl(std::index_sequence<Is...>, std::size_t idx)
+	{
+		std::size_t last = this->count - 1;
+		auto erase_column = [idx, last](auto* column)
+		{
+			using T = std::remove_pointer_t<decltype(column)>;
+			if(idx != last)
+				column[idx] = std::move(column[last]);
+			column[last].~T();
+		};
+		(erase_column(this->column<Is>()), ...);
+	}
+}
@@ -0,0 +1,131 @@
+#ifndef TOPAZ_MEMORY_SLOT_MAP_HPP
+#define TOPAZ_MEMORY_SLOT_MAP_HPP
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tz::mem
+{
+	/**
+	 * \addtogroup tz_mem Topaz Memory Library (tz::mem)
+	 * A collection of low-level abstractions around memory utilities not provided by the C++ standard library. This includes non-owning memory blocks, uniform memory-pools and more.
+	 * @{
+	 */
+
+	/**
+	 * Associative container which generates its own keys (handles).
+	 * - Values are stored densely, so iteration is a linear walk over contiguous memory.
+	 * - Insertion, erasure and lookup are all O(1). Lookups never hash.
+	 * - Erased slots are re-used, but each handle carries a generation. A handle to an erased element is stale and will never resolve to a newer element occupying the same slot.
+	 * Note: Erasure swaps the last element into the erased position, so the order of iteration is not stable. Handles remain valid regardless.
+	 * @tparam T Type of value to store.
+	 */
+	template<typename T>
+	class SlotMap
+	{
+	public:
+		/// Opaque handle. Encodes a slot index in the low 32 bits and a generation in the high 32 bits.
+		using Handle = std::size_t;
+		static_assert(sizeof(Handle) >= sizeof(std::uint64_t), "tz::mem::SlotMap<T>: Handles must be at least 64-bit to hold a slot index and generation.");
+		using value_type = T;
+		using iterator = typename std::vector<T>::iterator;
+		using const_iterator = typename std::vector<T>::const_iterator;
+
+		/**
+		 * Construct an empty SlotMap.
+		 */
+		SlotMap();
+		/**
+		 * Construct a new element in-place and retrieve a handle to it.
+		 * @tparam Args Types of the arguments used to construct the element.
+		 * @param args Values of the arguments used to construct the element.
+		 * @return Handle corresponding to the new element.
+		 */
+		template<typename... Args>
+		Handle emplace(Args&&... args);
+		/**
+		 * Erase the element corresponding to the given handle. Afterwards, the handle is stale.
+		 * Precondition: The handle must not be stale. Otherwise, this will assert and do nothing.
+		 * @param handle Handle whose element should be erased.
+		 */
+		void erase(Handle handle);
+		/**
+		 * Query as to whether the given handle refers to a live element in this map.
+		 * @param handle Handle to query.
+		 * @return False if the handle is stale or was never created by this map. Otherwise true.
+		 */
+		bool contains(Handle handle) const;
+		/**
+		 * Retrieve a pointer to the element corresponding to the given handle.
+		 * @param handle Handle whose element should be retrieved.
+		 * @return Pointer to the element if the handle is not stale. Otherwise nullptr.
+		 */
+		T* find(Handle handle);
+		const T* find(Handle handle) const;
+		/**
+		 * Retrieve the element corresponding to the given handle.
+		 * Precondition: The handle must not be stale. Otherwise, this will assert and invoke UB.
+		 * @param handle Handle whose element should be retrieved.
+		 * @return Reference to the element.
+		 */
+		T& operator[](Handle handle);
+		const T& operator[](Handle handle) const;
+		/**
+		 * Retrieve the handle corresponding to the element at the given position in iteration order.
+		 * Precondition: dense_index < this->size(). Otherwise, this will assert and invoke UB.
+		 * @param dense_index Position of the element, where begin() is position 0.
+		 * @return Handle corresponding to that element.
+		 */
+		Handle handle_at(std::size_t dense_index) const;
+		/**
+		 * Retrieve the number of live elements.
+		 * @return Number of elements.
+		 */
+		std::size_t size() const;
+		/**
+		 * Retrieve the number of slots that have ever been created, whether or not they currently contain an element.
+		 * @return Number of slots. This is never less than this->size().
+		 */
+		std::size_t slot_count() const;
+		/**
+		 * Query as to whether there are no live elements.
+		 * @return True if this->size() == 0. Otherwise false.
+		 */
+		bool empty() const;
+		/**
+		 * Erase all elements. Every existing handle becomes stale.
+		 */
+		void clear();
+
+		iterator begin();
+		const_iterator begin() const;
+		iterator end();
+		const_iterator end() const;
+	private:
+		static constexpr std::uint32_t null_slot = 0xFFFFFFFF;
+		static Handle make_handle(std::uint32_t slot_index, std::uint32_t generation);
+		static std::uint32_t slot_index_of(Handle handle);
+		static std::uint32_t generation_of(Handle handle);
+
+		struct Slot
+		{
+			/// If the slot is live, this is the position of its element in the dense arrays. Otherwise, it's the next free slot.
+			std::uint32_t dense_or_next_free;
+			/// Bumped every time the slot is erased and every time it is re-used. Even if the slot is live, odd if free.
+			std::uint32_t generation;
+		};
+
+		std::vector<T> values;
+		/// dense_to_slot[i] is the slot index of values[i].
+		std::vector<std::uint32_t> dense_to_slot;
+		std::vector<Slot> slots;
+		std::uint32_t free_head;
+	};
+
+	/**
+	 * @}
+	 */
+}
+
+#include "memory/slot_map.inl"
+#endif // TOPAZ_MEMORY_SLOT_MAP_HPP
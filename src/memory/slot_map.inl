@@ -0,0 +1,170 @@
+#include "core/debug/assert.hpp"
+#include <utility>
+
+namespace tz::mem
+{
+	template<typename T>
+	SlotMap<T>::SlotMap(): values(), dense_to_slot(), slots(), free_head(null_slot){}
+
+	template<typename T>
+	template<typename... Args>
+	typename SlotMap<T>::Handle SlotMap<T>::emplace(Args&&... args)
+	{
+		auto dense_index = static_cast<std::uint32_t>(this->values.size());
+		std::uint32_t slot_index;
+		if(this->free_head != null_slot)
+		{
+			// Re-use the most recently freed slot.
+			slot_index = this->free_head;
+			this->free_head = this->slots[slot_index].dense_or_next_free;
+			this->slots[slot_index].dense_or_next_free = dense_index;
+			this->slots[slot_index].generation++;
+		}
+		else
+		{
+			slot_index = static_cast<std::uint32_t>(this->slots.size());
+			this->slots.push_back({dense_index, 0});
+		}
+		this->values.emplace_back(std::forward<Args>(args)...);
+		this->dense_to_slot.push_back(slot_index);
+		return make_handle(slot_index, this->slots[slot_index].generation);
+	}
+
+	template<typename T>
+	void SlotMap<T>::erase(Handle handle)
+	{
+		topaz_assert(this->contains(handle), "tz::mem::SlotMap<T>::erase(", handle, "): Handle is stale or invalid.");
+		if(!this->contains(handle))
+			return;
+		std::uint32_t slot_index = slot_index_of(handle);
+		Slot& slot = this->slots[slot_index];
+		std::uint32_t dense_index = slot.dense_or_next_free;
+		// Swap the last element into the hole and patch up its slot.
+		std::uint32_t last_dense = static_cast<std::uint32_t>(this->values.size() - 1);
+		if(dense_index != last_dense)
+		{
+			this->values[dense_index] = std::move(this->values[last_dense]);
+			this->dense_to_slot[dense_index] = this->dense_to_slot[last_dense];
+			this->slots[this->dense_to_slot[dense_index]].dense_or_next_free = dense_index;
+		}
+		this->values.pop_back();
+		this->dense_to_slot.pop_back();
+		// Invalidate existing handles and push the slot onto the free-list.
+		slot.generation++;
+		slot.dense_or_next_free = this->free_head;
+		this->free_head = slot_index;
+	}
+
+	template<typename T>
+	bool SlotMap<T>::contains(Handle handle) const
+	{
+		std::uint32_t slot_index = slot_index_of(handle);
+		// Live slots have even generations and free slots have odd ones, so a handle can only ever match a live slot.
+		return slot_index < this->slots.size() && this->slots[slot_index].generation == generation_of(handle);
+	}
+
+	template<typename T>
+	T* SlotMap<T>::find(Handle handle)
+	{
+		if(!this->contains(handle))
+			return nullptr;
+		return &this->values[this->slots[slot_index_of(handle)].dense_or_next_free];
+	}
+
+	template<typename T>
+	const T* SlotMap<T>::find(Handle handle) const
+	{
+		if(!this->contains(handle))
+			return nullptr;
+		return &this->values[this->slots[slot_index_of(handle)].dense_or_next_free];
+	}
+
+	template<typename T>
+	T& SlotMap<T>::operator[](Handle handle)
+	{
+		topaz_assert(this->contains(handle), "tz::mem::SlotMap<T>::operator[", handle, "]: Handle is stale or invalid.");
+		return this->values[this->slots[slot_index_of(handle)].dense_or_next_free];
+	}
+
+	template<typename T>
+	const T& SlotMap<T>::operator[](Handle handle) const
+	{
+		topaz_assert(this->contains(handle), "tz::mem::SlotMap<T>::operator[", handle, "]: Handle is stale or invalid.");
+		return this->values[this->slots[slot_index_of(handle)].dense_or_next_free];
+	}
+
+	template<typename T>
+	typename SlotMap<T>::Handle SlotMap<T>::handle_at(std::size_t dense_index) const
+	{
+		topaz_assert(dense_index < this->size(), "tz::mem::SlotMap<T>::handle_at(", dense_index, "): Index out of range. Size: ", this->size());
+		std::uint32_t slot_index = this->dense_to_slot[dense_index];
+		return make_handle(slot_index, this->slots[slot_index].generation);
+	}
+
+	template<typename T>
+	std::size_t SlotMap<T>::size() const
+	{
+		return this->values.size();
+	}
+
+	template<typename T>
+	std::size_t SlotMap<T>::slot_count() const
+	{
+		return this->slots.size();
+	}
+
+	template<typename T>
+	bool SlotMap<T>::empty() const
+	{
+		return this->values.empty();
+	}
+
+	template<typename T>
+	void SlotMap<T>::clear()
+	{
+		while(!this->empty())
+			this->erase(this->handle_at(this->size() - 1));
+	}
+
+	template<typename T>
+	typename SlotMap<T>::iterator SlotMap<T>::begin()
+	{
+		return this->values.begin();
+	}
+
+	template<typename T>
+	typename SlotMap<T>::const_iterator SlotMap<T>::begin() const
+	{
+		return this->values.begin();
+	}
+
+	template<typename T>
+	typename SlotMap<T>::iterator SlotMap<T>::end()
+	{
+		return this->values.end();
+	}
+
+	template<typename T>
+	typename SlotMap<T>::const_iterator SlotMap<T>::end() const
+	{
+		return this->values.end();
+	}
+
+	template<typename T>
+	typename SlotMap<T>::Handle SlotMap<T>::make_handle(std::uint32_t slot_index, std::uint32_t generation)
+	{
+		return (static_cast<Handle>(generation) << 32) | static_cast<Handle>(slot_index);
+	}
+
+	template<typename T>
+	std::uint32_t SlotMap<T>::slot_index_of(Handle handle)
+	{
+		return static_cast<std::uint32_t>(handle & 0xFFFFFFFF);
+	}
+
+	template<typename T>
+	std::uint32_t SlotMap<T>::generation_of(Handle handle)
+	{
+		return static_cast<std::uint32_t>(handle >> 32);
+	}
+}
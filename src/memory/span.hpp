@@ -0,0 +1,70 @@
+#ifndef TOPAZ_MEMORY_SPAN_HPP
+#define TOPAZ_MEMORY_SPAN_HPP
+#include <cstddef>
+#include <type_traits>
+
+namespace tz::mem
+{
+	/**
+	 * \addtogroup tz_mem Topaz Memory Library (tz::mem)
+	 * A collection of low-level abstractions around memory utilities not provided by the C++ standard library. This includes non-owning memory blocks, uniform memory-pools and more.
+	 * @{
+	 */
+
+	/**
+	 * Non-owning view of a contiguous sequence of Ts. Similar to a typed tz::mem::Block.
+	 * @tparam T Type of element. May be const-qualified for a read-only view.
+	 */
+	template<typename T>
+	class Span
+	{
+	public:
+		using value_type = T;
+		/**
+		 * Construct a view over the given contiguous range.
+		 * @param begin Pointer to the first element.
+		 * @param size Number of elements in the range.
+		 */
+		Span(T* begin, std::size_t size);
+		/**
+		 * Construct a read-only view over the same range as a mutable view.
+		 * @param mutable_span View to copy.
+		 */
+		template<typename U, typename = std::enable_if_t<std::is_same_v<const U, T> && !std::is_same_v<U, T>>>
+		Span(const Span<U>& mutable_span);
+		/**
+		 * Retrieve a pointer to the first element.
+		 * @return Pointer to the beginning of the range.
+		 */
+		T* data() const;
+		/**
+		 * Retrieve the number of elements in the range.
+		 * @return Number of elements.
+		 */
+		std::size_t size() const;
+		/**
+		 * Query as to whether the range is empty.
+		 * @return True if this->size() == 0. Otherwise false.
+		 */
+		bool empty() const;
+		/**
+		 * Retrieve the element at the given index.
+		 * Precondition: idx < this->size(). Otherwise, this will assert and invoke UB.
+		 * @param idx Index of the element to retrieve.
+		 * @return Reference to the element.
+		 */
+		T& operator[](std::size_t idx) const;
+		T* begin() const;
+		T* end() const;
+	private:
+		T* first;
+		std::size_t length;
+	};
+
+	/**
+	 * @}
+	 */
+}
+
+#include "memory/span.inl"
+#endif // TOPAZ_MEMORY_SPAN_HPP
@@ -0,0 +1,48 @@
+#include "core/debug/assert.hpp"
+
+namespace tz::mem
+{
+	template<typename T>
+	Span<T>::Span(T* begin, std::size_t size): first(begin), length(size){}
+
+	template<typename T>
+	template<typename U, typename>
+	Span<T>::Span(const Span<U>& mutable_span): first(mutable_span.data()), length(mutable_span.size()){}
+
+	template<typename T>
+	T* Span<T>::data() const
+	{
+		return this->first;
+	}
+
+	template<typename T>
+	std::size_t Span<T>::size() const
+	{
+		return this->length;
+	}
+
+	template<typename T>
+	bool Span<T>::empty() const
+	{
+		return this->length == 0;
+	}
+
+	template<typename T>
+	T& Span<T>::operator[](std::size_t idx) const
+	{
+		topaz_assert(idx < this->length, "tz::mem::Span<T>::operator[", idx, "]: Index out of range. Size: ", this->length);
+		return this->first[idx];
+	}
+
+	template<typename T>
+	T* Span<T>::begin() const
+	{
+		return this->first;
+	}
+
+	template<typename T>
+	T* Span<T>::end() const
+	{
+		return this->first + this->length;
+	}
+}
@@ -0,0 +1,236 @@
+#include "memory/tracking.hpp"
+#if TOPAZ_MEMORY_TRACKING
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#endif
+
+namespace tz::mem::tracking
+{
+	const char* to_string(Tag tag)
+	{
+		switch(tag)
+		{
+			case Tag::Heap:
+				return "Heap";
+			case Tag::Block:
+				return "Block";
+			case Tag::Arena:
+				return "Arena";
+			case Tag::Pool:
+				return "Pool";
+			case Tag::Core:
+				return "Core";
+			case Tag::GL:
+				return "GL";
+			case Tag::Render:
+				return "Render";
+			case Tag::Count:
+			break;
+		}
+		return "Unknown";
+	}
+
+#if TOPAZ_MEMORY_TRACKING
+	namespace
+	{
+		struct Counters
+		{
+			std::atomic<std::size_t> current{0};
+			std::atomic<std::size_t> peak{0};
+			std::atomic<std::size_t> frame{0};
+			std::atomic<std::size_t> last_frame{0};
+			std::atomic<std::size_t> total{0};
+		};
+
+		// These must be usable before (and after) any other static initialisation, as the global operator new may be invoked at any time. Atomics are constant-initialised and trivially destructible, so this is safe.
+		Counters counters[static_cast<std::size_t>(Tag::Count)];
+		thread_local Tag thread_tag = Tag::Heap;
+
+		Counters& counters_for(Tag tag)
+		{
+			return counters[static_cast<std::size_t>(tag)];
+		}
+	}
+
+	void record_allocation(Tag tag, std::size_t size_bytes)
+	{
+		Counters& c = counters_for(tag);
+		std::size_t now = c.current.fetch_add(size_bytes, std::memory_order_relaxed) + size_bytes;
+		std::size_t peak = c.peak.load(std::memory_order_relaxed);
+		while(now > peak && !c.peak.compare_exchange_weak(peak, now, std::memory_order_relaxed));
+		c.frame.fetch_add(1, std::memory_order_relaxed);
+		c.total.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void record_free(Tag tag, std::size_t size_bytes)
+	{
+		counters_for(tag).current.fetch_sub(size_bytes, std::memory_order_relaxed);
+	}
+
+	TagStats get(Tag tag)
+	{
+		const Counters& c = counters_for(tag);
+		TagStats stats;
+		stats.current_bytes = c.current.load(std::memory_order_relaxed);
+		stats.peak_bytes = c.peak.load(std::memory_order_relaxed);
+		stats.frame_allocations = c.last_frame.load(std::memory_order_relaxed);
+		stats.total_allocations = c.total.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	void next_frame()
+	{
+		for(Counters& c : counters)
+		{
+			c.last_frame.store(c.frame.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+	}
+
+	void reset_peaks()
+	{
+		for(Counters& c : counters)
+		{
+			c.peak.store(c.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+	}
+
+	Tag current_tag()
+	{
+		return thread_tag;
+	}
+
+	ScopedTag::ScopedTag(Tag tag): previous(thread_tag)
+	{
+		thread_tag = tag;
+	}
+
+	ScopedTag::~ScopedTag()
+	{
+		thread_tag = this->previous;
+	}
+#else
+	TagStats get(Tag)
+	{
+		return {};
+	}
+
+	void next_frame(){}
+
+	void reset_peaks(){}
+
+	Tag current_tag()
+	{
+		return Tag::Heap;
+	}
+
+	ScopedTag::ScopedTag(Tag tag): previous(tag){}
+
+	ScopedTag::~ScopedTag(){}
+#endif
+}
+
+#if TOPAZ_MEMORY_TRACKING
+namespace
+{
+	using tz::mem::tracking::Tag;
+
+	/// Prepended to every global heap allocation so that operator delete knows how much to un-account, and from which tag. Keeps the user pointer aligned to max_align_t.
+	struct alignas(std::max_align_t) HeapHeader
+	{
+		std::size_t size;
+		Tag tag;
+	};
+
+	void* tracked_allocate(std::size_t size) noexcept
+	{
+		void* raw = std::malloc(sizeof(HeapHeader) + size);
+		if(raw == nullptr)
+			return nullptr;
+		auto* header = static_cast<HeapHeader*>(raw);
+		header->size = size;
+		header->tag = tz::mem::tracking::current_tag();
+		tz::mem::tracking::record_allocation(header->tag, size);
+		return header + 1;
+	}
+
+	void* tracked_allocate_or_fail(std::size_t size)
+	{
+		void* ptr = tracked_allocate(size);
+		while(ptr == nullptr)
+		{
+			std::new_handler handler = std::get_new_handler();
+			if(handler == nullptr)
+			{
+				#if defined(__cpp_exceptions)
+					throw std::bad_alloc{};
+				#else
+					std::abort();
+				#endif
+			}
+			handler();
+			ptr = tracked_allocate(size);
+		}
+		return ptr;
+	}
+
+	void tracked_free(void* ptr) noexcept
+	{
+		if(ptr == nullptr)
+			return;
+		auto* header = static_cast<HeapHeader*>(ptr) - 1;
+		tz::mem::tracking::record_free(header->tag, header->size);
+		std::free(header);
+	}
+}
+
+void* operator new(std::size_t size)
+{
+	return tracked_allocate_or_fail(size);
+}
+
+void* operator new[](std::size_t size)
+{
+	return tracked_allocate_or_fail(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return tracked_allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return tracked_allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	tracked_free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	tracked_free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	tracked_free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	tracked_free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	tracked_free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	tracked_free(ptr);
+}
+#endif
@@ -0,0 +1,156 @@
+#ifndef TOPAZ_MEMORY_TRACKING_HPP
+#define TOPAZ_MEMORY_TRACKING_HPP
+#include <cstddef>
+
+#ifndef TOPAZ_MEMORY_TRACKING
+#define TOPAZ_MEMORY_TRACKING 0
+#endif
+
+namespace tz::mem::tracking
+{
+	/**
+	 * \addtogroup tz_mem Topaz Memory Library (tz::mem)
+	 * A collection of low-level abstractions around memory utilities not provided by the C++ standard library.
+	 * @{
+	 */
+
+	/**
+	 * True if topaz was built with TOPAZ_MEMORY_TRACKING. Otherwise, every function in tz::mem::tracking does nothing and all statistics are zero.
+	 * Note: Enabling tracking replaces the global operator new/delete, adding a small header to every heap allocation.
+	 */
+	constexpr bool enabled = TOPAZ_MEMORY_TRACKING;
+
+	/**
+	 * Identifies which subsystem an allocation is accounted to.
+	 */
+	enum class Tag
+	{
+		/// Global heap allocations made outside of any ScopedTag.
+		Heap,
+		/// tz::mem::AutoBlock.
+		Block,
+		/// Bytes in-use within a tz::mem::LinearArena.
+		Arena,
+		/// Live elements within a tz::mem::UniformPool or tz::mem::SoAPool.
+		Pool,
+		/// Global heap allocations made by tz::core.
+		Core,
+		/// Data-stores of tz::gl buffers and textures. These typically live in video memory rather than on the heap.
+		GL,
+		/// Global heap allocations made by tz::render.
+		Render,
+		Count
+	};
+
+	/**
+	 * Describes what kind of memory a tag accounts, and so which tags can be totalled together.
+	 */
+	enum class Kind
+	{
+		/// Memory allocated by the process itself, such as global heap allocations and AutoBlocks.
+		Host,
+		/// Data-stores allocated by the graphics driver, which typically live in video memory. These are totalled separately from host memory.
+		Video,
+		/// Bytes in-use within memory which is already accounted to another tag, such as the live elements of a pool within an AutoBlock. Adding these to a total would count the same memory twice.
+		InUse
+	};
+
+	/**
+	 * Snapshot of the counters for a single tag.
+	 */
+	struct TagStats
+	{
+		/// Number of bytes currently allocated.
+		std::size_t current_bytes = 0;
+		/// Largest value that current_bytes has ever reached, or has reached since the last invocation of reset_peaks().
+		std::size_t peak_bytes = 0;
+		/// Number of allocations made during the previous frame.
+		std::size_t frame_allocations = 0;
+		/// Number of allocations made ever.
+		std::size_t total_allocations = 0;
+	};
+
+	/**
+	 * Retrieve a human-readable name for the given tag.
+	 * @param tag Tag to name.
+	 * @return Null-terminated name, such as "Render".
+	 */
+	const char* to_string(Tag tag);
+	/**
+	 * Retrieve what kind of memory the given tag accounts. Only tags of the same kind should be totalled together.
+	 * @param tag Tag to query.
+	 * @return Kind of memory which the tag accounts.
+	 */
+	constexpr Kind kind_of(Tag tag)
+	{
+		switch(tag)
+		{
+			case Tag::Arena:
+			case Tag::Pool:
+				return Kind::InUse;
+			case Tag::GL:
+				return Kind::Video;
+			default:
+				return Kind::Host;
+		}
+	}
+	/**
+	 * Retrieve a snapshot of the counters for the given tag.
+	 * Note: Counters are updated with relaxed atomics, so a snapshot taken while other threads allocate may be slightly inconsistent.
+	 * @param tag Tag to query.
+	 * @return Counters for the tag. If tracking is not enabled, these are all zero.
+	 */
+	TagStats get(Tag tag);
+	/**
+	 * Mark the end of a frame, moving the per-frame allocation counts into TagStats::frame_allocations. This is invoked by tz::core::update().
+	 */
+	void next_frame();
+	/**
+	 * Set the peak of every tag to its current value.
+	 */
+	void reset_peaks();
+	/**
+	 * Retrieve the tag which global heap allocations made by the calling thread are currently accounted to.
+	 * @return Current tag of the calling thread.
+	 */
+	Tag current_tag();
+
+	/**
+	 * Accounts global heap allocations made by the calling thread to the given tag until destruction, whereupon the previous tag is restored (RAII).
+	 * Note: Explicitly-tagged allocations (such as AutoBlock) are unaffected.
+	 */
+	class ScopedTag
+	{
+	public:
+		ScopedTag(Tag tag);
+		ScopedTag(const ScopedTag& copy) = delete;
+		ScopedTag& operator=(const ScopedTag& rhs) = delete;
+		~ScopedTag();
+	private:
+		Tag previous;
+	};
+
+#if TOPAZ_MEMORY_TRACKING
+	/**
+	 * Record that the given number of bytes was allocated on behalf of the given tag.
+	 * @param tag Tag to account the allocation to.
+	 * @param size_bytes Number of bytes allocated.
+	 */
+	void record_allocation(Tag tag, std::size_t size_bytes);
+	/**
+	 * Record that the given number of bytes, previously recorded via record_allocation, was released.
+	 * @param tag Tag which the allocation was accounted to.
+	 * @param size_bytes Number of bytes released.
+	 */
+	void record_free(Tag tag, std::size_t size_bytes);
+#else
+	inline void record_allocation(Tag, std::size_t){}
+	inline void record_free(Tag, std::size_t){}
+#endif
+
+	/**
+	 * @}
+	 */
+}
+
+#endif // TOPAZ_MEMORY_TRACKING_HPP
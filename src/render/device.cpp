@@ -1,12 +1,15 @@
 #include "render/device.hpp"
+#include "core/core.hpp"
 #include "core/debug/assert.hpp"
 #include "gl/frame.hpp"
 #include "gl/shader.hpp"
 #include "gl/object.hpp"
+#include "gl/streaming_buffer.hpp"
+#include "memory/tracking.hpp"
 
 namespace tz::render
 {
-	Device::Device(tz::gl::IFrame* frame, tz::gl::ShaderProgram* program, tz::gl::Object* object): frame(frame), program(program), object(object), ibo_id(std::nullopt), snippets(), resource_buffers(){}
+	Device::Device(tz::gl::IFrame* frame, tz::gl::ShaderProgram* program, tz::gl::Object* object): frame(frame), program(program), object(object), ibo_id(std::nullopt), snippets(), resource_buffers(), command_stream(nullptr){}
 
 	void Device::set_frame(tz::gl::IFrame* frame)
 	{
@@ -78,27 +81,39 @@ namespace tz::render
 		this->snippets = indices;
 	}
 
+	void Device::set_command_stream(tz::gl::StreamingBuffer* stream)
+	{
+		this->command_stream = stream;
+	}
+
 	void Device::render() const
 	{
 		topaz_assert(this->ready(), "tz::render::Device::render(): Device is not ready!");
 		if(!this->ibo_id.has_value())
 			return;
-		if(frame->operator!=(tz::gl::bound::frame()))
-			frame->bind();
-		program->bind();
-		for(const tz::gl::IBuffer* resource_buffer : this->resource_buffers)
-		{
-			resource_buffer->bind();
-		}
+		tz::mem::tracking::ScopedTag tag{tz::mem::tracking::Tag::Render};
+		this->bind_for_render();
 		if (this->snippets.empty())
 			this->object->render(this->ibo_id.value());
 		else
 		{
-			// use MDI.
-			this->object->multi_render(this->ibo_id.value(), this->snippets.get_command_list());
+			// use MDI. The command list only needs to live until the draw is submitted, so build it in the frame arena.
+			tz::mem::ScopedMarker scope{tz::core::frame_arena()};
+			tz::mem::ArenaResource frame_resource{tz::core::frame_arena()};
+			this->multi_render(this->snippets.get_command_list(&frame_resource));
 		}
 	}
 
+	void Device::render(const tz::gl::MDIDrawCommandList& commands) const
+	{
+		topaz_assert(this->ready(), "tz::render::Device::render(commands): Device is not ready!");
+		if(!this->ibo_id.has_value() || commands.empty())
+			return;
+		tz::mem::tracking::ScopedTag tag{tz::mem::tracking::Tag::Render};
+		this->bind_for_render();
+		this->multi_render(commands);
+	}
+
 	void Device::clear() const
 	{
 		topaz_assert(this->frame != nullptr, "tz::render::Device::clear(): There is no tz::gl::Frame attached!");
@@ -142,6 +157,17 @@ namespace tz::render
 			this->program->bind();
 	}
 
+	void Device::bind_for_render() const
+	{
+		if(this->frame->operator!=(tz::gl::bound::frame()))
+			this->frame->bind();
+		this->program->bind();
+		for(const tz::gl::IBuffer* resource_buffer : this->resource_buffers)
+		{
+			resource_buffer->bind();
+		}
+	}
+
 	/*static*/ bool Device::sanity_check(const tz::gl::IndexSnippetList& indices, const tz::gl::IBO& ibo)
 	{
 		const std::size_t index_count = ibo.size() / sizeof(tz::gl::Index);
@@ -157,4 +183,11 @@ namespace tz::render
 		return true;
 	}
 
+	void Device::multi_render(const tz::gl::MDIDrawCommandList& commands) const
+	{
+		if(this->command_stream != nullptr)
+			this->object->multi_render(this->ibo_id.value(), commands, *this->command_stream);
+		else
+			this->object->multi_render(this->ibo_id.value(), commands);
+	}
 }
\ No newline at end of file
@@ -13,6 +13,7 @@ namespace tz
 		class IFrame;
 		class ShaderProgram;
 		class Object;
+		class StreamingBuffer;
 	}
 }
 
@@ -109,6 +110,12 @@ namespace tz::render
 		 * @param snippet Snippet containing index-ranges used in MDI.
 		 */
 		void set_indices(tz::gl::IndexSnippetList indices);
+		/**
+		 * Stream the MDI command lists of subsequent multi-render invocations through the given streaming buffer, rather than re-sending them to the Object's own draw buffer.
+		 * Note: The caller remains responsible for invoking tz::gl::StreamingBuffer::next_frame() once per frame.
+		 * @param stream Streaming buffer to copy command lists into. If nullptr, the Object's own draw buffer is used.
+		 */
+		void set_command_stream(tz::gl::StreamingBuffer* stream);
 		/**
 		 * Invoke a render-invocation, making the Object emit a draw-call via the ibo_id set via this->set_handle.
 		 * Note: All registered resource-buffers will be bound directly before rendering the Object (see tz::render::Device::add_resource_buffer(IBuffer*)).
@@ -117,6 +124,15 @@ namespace tz::render
 		 * Precondition: If a snippet was provided by this->set_snippet, it must contain index-ranges valid in the context of the ibo_id provided by this->set_handle earlier. Otherwise, this will assert and invoke UB.
 		 */
 		void render() const;
+		/**
+		 * Invoke a render-invocation, making the Object emit a multi-render call using only the given commands, rather than those of every index-snippet. This is typically used to draw only the visible snippets (see tz::render::FrustumCuller).
+		 * Note: All registered resource-buffers will be bound directly before rendering the Object (see tz::render::Device::add_resource_buffer(IBuffer*)).
+		 * Note: If the command list is empty, nothing is drawn.
+		 * Precondition: An ID handle must have been set via this->set_handle. Otherwise, this method will early-out and do nothing.
+		 * Precondition: The commands must only refer to indices within the index-buffer provided by this->set_handle earlier. Otherwise, this will invoke UB without asserting.
+		 * @param commands MDI command list to draw.
+		 */
+		void render(const tz::gl::MDIDrawCommandList& commands) const;
 		/**
 		 * Force the attached Frame to clear its backbuffer. The Frame will be bound prior; no need to do it yourself.
 		 * Precondition: The attached frame is not nullptr. Otherwise this will assert and invoke UB.
@@ -136,10 +152,14 @@ namespace tz::render
 		bool operator==(const Device& rhs) const;
 	private:
 		void ensure_bound() const;
+		/// Bind the frame, program and every resource buffer ready for a render-invocation.
+		void bind_for_render() const;
 		/**
 		 * Ensures that all indices specified by all snippets exist within the IBO.
 		 */
 		static bool sanity_check(const tz::gl::IndexSnippetList& indices, const tz::gl::IBO& ibo);
+		/// Multi-render the given commands, via the command stream if there is one.
+		void multi_render(const tz::gl::MDIDrawCommandList& commands) const;
 
 		tz::gl::IFrame* frame;
 		tz::gl::ShaderProgram* program;
@@ -147,6 +167,7 @@ namespace tz::render
 		std::optional<std::size_t> ibo_id;
 		tz::gl::IndexSnippetList snippets;
 		std::vector<const tz::gl::IBuffer*> resource_buffers;
+		tz::gl::StreamingBuffer* command_stream;
 	};
 
 	/**
@@ -0,0 +1,241 @@
+#include "render/frustum_culler.hpp"
+#include "geo/simd.hpp"
+#include "core/debug/assert.hpp"
+#include <cmath>
+
+namespace tz::render
+{
+	namespace
+	{
+		// Batched kernels read these types as tightly-packed floats.
+		static_assert(sizeof(tz::geo::AABB) == 6 * sizeof(float));
+		static_assert(sizeof(tz::geo::BoundingSphere) == 4 * sizeof(float));
+
+		constexpr std::size_t batch_width = 4;
+		using Planes = std::array<tz::Vec4, 6>;
+
+		template<typename T>
+		const T* element_at(const T* first, std::size_t stride_bytes, std::size_t i)
+		{
+			return reinterpret_cast<const T*>(reinterpret_cast<const char*>(first) + (i * stride_bytes));
+		}
+
+		/*
+		 * Scalar tests. The batched kernels below perform exactly the same operations in the same order, so both always agree.
+		 */
+
+		bool box_visible(const Planes& planes, const tz::geo::AABB& box)
+		{
+			for(const tz::Vec4& plane : planes)
+			{
+				// The box is only outside if its corner furthest along the plane's normal is outside.
+				const float x = plane[0] >= 0.0f ? box.max[0] : box.min[0];
+				const float y = plane[1] >= 0.0f ? box.max[1] : box.min[1];
+				const float z = plane[2] >= 0.0f ? box.max[2] : box.min[2];
+				if(((plane[0] * x) + (plane[1] * y) + (plane[2] * z)) + plane[3] < 0.0f)
+					return false;
+			}
+			return true;
+		}
+
+		bool sphere_visible(const Planes& planes, const tz::geo::BoundingSphere& sphere)
+		{
+			for(const tz::Vec4& plane : planes)
+			{
+				const float distance = ((plane[0] * sphere.centre[0]) + (plane[1] * sphere.centre[1]) + (plane[2] * sphere.centre[2])) + plane[3];
+				if(distance + sphere.radius < 0.0f)
+					return false;
+			}
+			return true;
+		}
+
+	#if TOPAZ_GEO_SIMD
+		/// Each component of each plane, broadcast across all lanes.
+		struct PlaneRegisters
+		{
+			PlaneRegisters(const Planes& planes)
+			{
+				for(std::size_t i = 0; i < planes.size(); i++)
+				{
+					this->x[i] = _mm_set1_ps(planes[i][0]);
+					this->y[i] = _mm_set1_ps(planes[i][1]);
+					this->z[i] = _mm_set1_ps(planes[i][2]);
+					this->w[i] = _mm_set1_ps(planes[i][3]);
+					this->positive_x[i] = _mm_cmpge_ps(this->x[i], _mm_setzero_ps());
+					this->positive_y[i] = _mm_cmpge_ps(this->y[i], _mm_setzero_ps());
+					this->positive_z[i] = _mm_cmpge_ps(this->z[i], _mm_setzero_ps());
+				}
+			}
+
+			__m128 distance(std::size_t i, __m128 px, __m128 py, __m128 pz) const
+			{
+				return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(this->x[i], px), _mm_mul_ps(this->y[i], py)), _mm_mul_ps(this->z[i], pz)), this->w[i]);
+			}
+
+			__m128 x[6], y[6], z[6], w[6];
+			/// Whether each component of each plane's normal is non-negative, i.e whether to test a box's max or min along that axis.
+			__m128 positive_x[6], positive_y[6], positive_z[6];
+		};
+
+		/// Lanes of a wherever the mask is set, otherwise lanes of b.
+		inline __m128 select(__m128 mask, __m128 a, __m128 b)
+		{
+			return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+		}
+
+		template<typename Visitor>
+		void visit_mask(std::size_t first_index, int visible_mask, Visitor& on_visible)
+		{
+			for(std::size_t lane = 0; lane < batch_width; lane++)
+			{
+				if(visible_mask & (1 << lane))
+					on_visible(first_index + lane);
+			}
+		}
+	#endif
+
+		/// Invoke on_visible(i) for the index of each box which may be visible, in ascending order.
+		template<typename Visitor>
+		void cull_boxes(const Planes& planes, const tz::geo::AABB* first, std::size_t count, std::size_t stride_bytes, Visitor on_visible)
+		{
+			std::size_t i = 0;
+		#if TOPAZ_GEO_SIMD
+			using namespace tz::geo::simd::detail;
+			const PlaneRegisters registers{planes};
+			const __m128 zero = _mm_setzero_ps();
+			for(; i + batch_width <= count; i += batch_width)
+			{
+				__m128 min[batch_width], max[batch_width];
+				for(std::size_t j = 0; j < batch_width; j++)
+				{
+					const float* box = element_at(first, stride_bytes, i + j)->min.data();
+					min[j] = load3(box);
+					max[j] = load3(box + 3);
+				}
+				_MM_TRANSPOSE4_PS(min[0], min[1], min[2], min[3]);
+				_MM_TRANSPOSE4_PS(max[0], max[1], max[2], max[3]);
+				__m128 outside = zero;
+				for(std::size_t p = 0; p < 6; p++)
+				{
+					const __m128 distance = registers.distance(p, select(registers.positive_x[p], max[0], min[0]), select(registers.positive_y[p], max[1], min[1]), select(registers.positive_z[p], max[2], min[2]));
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, zero));
+				}
+				visit_mask(i, ~_mm_movemask_ps(outside), on_visible);
+			}
+		#endif
+			for(; i < count; i++)
+			{
+				if(box_visible(planes, *element_at(first, stride_bytes, i)))
+					on_visible(i);
+			}
+		}
+
+		/// Invoke on_visible(i) for the index of each sphere which may be visible, in ascending order.
+		template<typename Visitor>
+		void cull_spheres(const Planes& planes, const tz::geo::BoundingSphere* first, std::size_t count, std::size_t stride_bytes, Visitor on_visible)
+		{
+			std::size_t i = 0;
+		#if TOPAZ_GEO_SIMD
+			const PlaneRegisters registers{planes};
+			const __m128 zero = _mm_setzero_ps();
+			for(; i + batch_width <= count; i += batch_width)
+			{
+				// Each sphere is (x, y, z, radius), so a 4x4 transpose gives each component of all four spheres.
+				__m128 x = _mm_loadu_ps(element_at(first, stride_bytes, i)->centre.data());
+				__m128 y = _mm_loadu_ps(element_at(first, stride_bytes, i + 1)->centre.data());
+				__m128 z = _mm_loadu_ps(element_at(first, stride_bytes, i + 2)->centre.data());
+				__m128 radius = _mm_loadu_ps(element_at(first, stride_bytes, i + 3)->centre.data());
+				_MM_TRANSPOSE4_PS(x, y, z, radius);
+				__m128 outside = zero;
+				for(std::size_t p = 0; p < 6; p++)
+				{
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(registers.distance(p, x, y, z), radius), zero));
+				}
+				visit_mask(i, ~_mm_movemask_ps(outside), on_visible);
+			}
+		#endif
+			for(; i < count; i++)
+			{
+				if(sphere_visible(planes, *element_at(first, stride_bytes, i)))
+					on_visible(i);
+			}
+		}
+	}
+
+	FrustumCuller::FrustumCuller(const tz::Mat4& view_projection): planes()
+	{
+		this->set_view_projection(view_projection);
+	}
+
+	void FrustumCuller::set_view_projection(const tz::Mat4& view_projection)
+	{
+		// Gribb-Hartmann: A clip-space point is inside of the frustum if -w <= x, y, z <= w. Each inequality is a linear combination of the rows of the matrix.
+		const tz::Mat4& m = view_projection;
+		auto combine = [&m](std::size_t row, float sign)->tz::Vec4
+		{
+			tz::Vec4 plane{{m(3, 0) + sign * m(row, 0), m(3, 1) + sign * m(row, 1), m(3, 2) + sign * m(row, 2), m(3, 3) + sign * m(row, 3)}};
+			const float length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+			plane /= length;
+			return plane;
+		};
+		this->planes[static_cast<std::size_t>(Plane::Left)] = combine(0, 1.0f);
+		this->planes[static_cast<std::size_t>(Plane::Right)] = combine(0, -1.0f);
+		this->planes[static_cast<std::size_t>(Plane::Bottom)] = combine(1, 1.0f);
+		this->planes[static_cast<std::size_t>(Plane::Top)] = combine(1, -1.0f);
+		this->planes[static_cast<std::size_t>(Plane::Near)] = combine(2, 1.0f);
+		this->planes[static_cast<std::size_t>(Plane::Far)] = combine(2, -1.0f);
+	}
+
+	const tz::Vec4& FrustumCuller::get_plane(Plane plane) const
+	{
+		return this->planes[static_cast<std::size_t>(plane)];
+	}
+
+	bool FrustumCuller::visible(const tz::geo::AABB& box) const
+	{
+		return box_visible(this->planes, box);
+	}
+
+	bool FrustumCuller::visible(const tz::geo::BoundingSphere& sphere) const
+	{
+		return sphere_visible(this->planes, sphere);
+	}
+
+	std::size_t FrustumCuller::cull(tz::mem::Span<const tz::geo::AABB> boxes, tz::mem::Span<std::size_t> visible_indices) const
+	{
+		topaz_assert(visible_indices.size() >= boxes.size(), "tz::render::FrustumCuller::cull(...): Output span (size ", visible_indices.size(), ") is too small to hold the indices of every box (", boxes.size(), ")");
+		if(visible_indices.size() < boxes.size())
+			return 0;
+		std::size_t visible_count = 0;
+		std::size_t* out = visible_indices.data();
+		cull_boxes(this->planes, boxes.data(), boxes.size(), sizeof(tz::geo::AABB), [out, &visible_count](std::size_t i){out[visible_count++] = i;});
+		return visible_count;
+	}
+
+	std::size_t FrustumCuller::cull(tz::mem::Span<const tz::geo::BoundingSphere> spheres, tz::mem::Span<std::size_t> visible_indices) const
+	{
+		topaz_assert(visible_indices.size() >= spheres.size(), "tz::render::FrustumCuller::cull(...): Output span (size ", visible_indices.size(), ") is too small to hold the indices of every sphere (", spheres.size(), ")");
+		if(visible_indices.size() < spheres.size())
+			return 0;
+		std::size_t visible_count = 0;
+		std::size_t* out = visible_indices.data();
+		cull_spheres(this->planes, spheres.data(), spheres.size(), sizeof(tz::geo::BoundingSphere), [out, &visible_count](std::size_t i){out[visible_count++] = i;});
+		return visible_count;
+	}
+
+	void FrustumCuller::cull(const tz::gl::IndexSnippetList& snippets, tz::mem::Span<const tz::geo::Bounds> bounds, tz::gl::MDIDrawCommandList& commands) const
+	{
+		topaz_assert(snippets.size() == bounds.size(), "tz::render::FrustumCuller::cull(...): There are ", snippets.size(), " snippets but ", bounds.size(), " bounds. Every snippet must have exactly one bounds.");
+		if(snippets.size() != bounds.size() || bounds.empty())
+			return;
+		commands.reserve(commands.size() + snippets.size());
+		cull_boxes(this->planes, &bounds.data()->box, bounds.size(), sizeof(tz::geo::Bounds), [&snippets, &commands](std::size_t i){commands.add(snippets[i].mdi());});
+	}
+
+	tz::gl::MDIDrawCommandList FrustumCuller::cull(const tz::gl::IndexSnippetList& snippets, tz::mem::Span<const tz::geo::Bounds> bounds, std::pmr::memory_resource* resource) const
+	{
+		tz::gl::MDIDrawCommandList commands{resource};
+		this->cull(snippets, bounds, commands);
+		return commands;
+	}
+}
@@ -0,0 +1,109 @@
+#ifndef TOPAZ_RENDER_FRUSTUM_CULLER_HPP
+#define TOPAZ_RENDER_FRUSTUM_CULLER_HPP
+#include "geo/bounds.hpp"
+#include "geo/matrix.hpp"
+#include "gl/index_snippet.hpp"
+#include "memory/span.hpp"
+#include <array>
+
+namespace tz::render
+{
+	/**
+	 * \addtogroup tz_render Topaz Rendering Library (tz::render)
+	 * High-level interface for 3D and 2D hardware-accelerated graphics programming. Used in combination with the \ref tz_gl "Topaz Graphics Library".
+	 * @{
+	 */
+
+	/**
+	 * Tests bounding volumes against a view frustum, so that only the meshes which may be visible are drawn.
+	 * Batched tests process four volumes at a time using SIMD where available (see tz::geo::simd::enabled).
+	 *
+	 * Culling is conservative: A volume which is culled is guaranteed to be outside of the frustum, but a volume which is not culled may still be outside of it (near the frustum's edges and corners).
+	 * All volumes must be in world-space, i.e the same space as the view matrix which the culler was constructed from.
+	 */
+	class FrustumCuller
+	{
+	public:
+		enum class Plane
+		{
+			Left,
+			Right,
+			Bottom,
+			Top,
+			Near,
+			Far
+		};
+
+		/**
+		 * Construct a culler from the given view-projection matrix.
+		 * @param view_projection Combined projection and view matrix, e.g tz::geo::perspective(...) * tz::geo::view(...).
+		 */
+		FrustumCuller(const tz::Mat4& view_projection);
+		/**
+		 * Extract the frustum planes from a new view-projection matrix. The old planes will no longer be used. This should be invoked whenever the camera moves.
+		 * @param view_projection Combined projection and view matrix, e.g tz::geo::perspective(...) * tz::geo::view(...).
+		 */
+		void set_view_projection(const tz::Mat4& view_projection);
+		/**
+		 * Retrieve one of the planes of the frustum, as (a, b, c, d) where a point p is inside of the plane if (a, b, c) . p + d >= 0.
+		 * Note: (a, b, c) is normalised, so the left-hand side of the inequality is the signed distance from the plane.
+		 * @param plane Plane to retrieve.
+		 * @return Plane coefficients.
+		 */
+		const tz::Vec4& get_plane(Plane plane) const;
+		/**
+		 * Query as to whether the box may be visible.
+		 * @param box Box to test.
+		 * @return False if the box is definitely outside of the frustum. Otherwise true.
+		 */
+		bool visible(const tz::geo::AABB& box) const;
+		/**
+		 * Query as to whether the sphere may be visible.
+		 * @param sphere Sphere to test.
+		 * @return False if the sphere is definitely outside of the frustum. Otherwise true.
+		 */
+		bool visible(const tz::geo::BoundingSphere& sphere) const;
+		/**
+		 * Test many boxes at once, and write the index of each box which may be visible. Equivalent to testing each via visible(const AABB&).
+		 * Precondition: visible_indices is at least as large as boxes. Otherwise, this will assert and do nothing.
+		 * @param boxes Boxes to test.
+		 * @param visible_indices Destination of the index of each box which may be visible, in ascending order.
+		 * @return Number of indices written.
+		 */
+		std::size_t cull(tz::mem::Span<const tz::geo::AABB> boxes, tz::mem::Span<std::size_t> visible_indices) const;
+		/**
+		 * Test many spheres at once, and write the index of each sphere which may be visible. Equivalent to testing each via visible(const BoundingSphere&).
+		 * Precondition: visible_indices is at least as large as spheres. Otherwise, this will assert and do nothing.
+		 * @param spheres Spheres to test.
+		 * @param visible_indices Destination of the index of each sphere which may be visible, in ascending order.
+		 * @return Number of indices written.
+		 */
+		std::size_t cull(tz::mem::Span<const tz::geo::BoundingSphere> spheres, tz::mem::Span<std::size_t> visible_indices) const;
+		/**
+		 * Add an MDI command to the end of the list for each snippet which may be visible.
+		 * Each snippet is tested via the box of its bounds, as that is the tighter of the two volumes.
+		 * Precondition: There are as many bounds as there are snippets. Otherwise, this will assert and do nothing.
+		 * @param snippets Snippets to cull.
+		 * @param bounds World-space bounds of each snippet, e.g from tz::gl::Manager::get_bounds(Handle).
+		 * @param commands Command list to append the commands of each visible snippet to, in the same order as the snippets.
+		 */
+		void cull(const tz::gl::IndexSnippetList& snippets, tz::mem::Span<const tz::geo::Bounds> bounds, tz::gl::MDIDrawCommandList& commands) const;
+		/**
+		 * Retrieve an MDI command list which draws only the snippets which may be visible. This can be passed to tz::render::Device::render(const MDIDrawCommandList&) in-place of drawing every snippet.
+		 * Precondition: There are as many bounds as there are snippets. Otherwise, this will assert and return an empty list.
+		 * @param snippets Snippets to cull.
+		 * @param bounds World-space bounds of each snippet, e.g from tz::gl::Manager::get_bounds(Handle).
+		 * @param resource Memory resource from which the command list's storage is allocated. By default, this is the global heap.
+		 * @return Render-ready MDI command list.
+		 */
+		tz::gl::MDIDrawCommandList cull(const tz::gl::IndexSnippetList& snippets, tz::mem::Span<const tz::geo::Bounds> bounds, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+	private:
+		std::array<tz::Vec4, 6> planes;
+	};
+
+	/**
+	 * @}
+	 */
+}
+
+#endif // TOPAZ_RENDER_FRUSTUM_CULLER_HPP
@@ -0,0 +1,125 @@
+#include "test_framework.hpp"
+#include "algo/job_system.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <vector>
+
+namespace
+{
+	// Exercise both a real pool and the degenerate case where only waiting threads run jobs.
+	constexpr std::size_t worker_counts[] = {0, 1, 3};
+}
+
+tz::test::Case execute()
+{
+	tz::test::Case test_case("tz::algo::JobSystem Execute Tests");
+	for(std::size_t workers : worker_counts)
+	{
+		tz::algo::JobSystem system{workers};
+		topaz_expect(test_case, system.worker_count() == workers, "JobSystem had unexpected worker count. Expected ", workers, ", got ", system.worker_count());
+		std::atomic<int> runs{0};
+		tz::algo::JobHandle job = system.execute([&runs](){runs++;});
+		topaz_expect(test_case, job.valid(), "JobSystem::execute returned an invalid handle");
+		system.wait(job);
+		topaz_expect(test_case, job.complete() && runs == 1, "Job did not run exactly once before wait returned. Ran ", runs.load(), " times with ", workers, " workers");
+		tz::algo::JobHandle blocked = system.execute([&runs](){runs++;});
+		system.wait(blocked, tz::algo::WaitPolicy::Block);
+		topaz_expect(test_case, blocked.complete() && runs == 2, "Job did not run before a blocking wait returned, with ", workers, " workers");
+	}
+	const tz::algo::JobHandle invalid;
+	topaz_expect(test_case, !invalid.valid() && invalid.complete(), "Default-constructed JobHandle should be invalid and complete");
+	return test_case;
+}
+
+tz::test::Case parallel_for()
+{
+	tz::test::Case test_case("tz::algo::JobSystem Parallel For Tests");
+	constexpr std::size_t grain_sizes[] = {1, 7, 64, 100000};
+	for(std::size_t workers : worker_counts)
+	{
+		tz::algo::JobSystem system{workers};
+		for(std::size_t grain_size : grain_sizes)
+		{
+			std::vector<std::atomic<int>> visits(1000);
+			system.wait(system.parallel_for(0, visits.size(), grain_size, [&visits](std::size_t i){visits[i]++;}));
+			const bool each_once = std::all_of(visits.begin(), visits.end(), [](const std::atomic<int>& v){return v == 1;});
+			topaz_expect(test_case, each_once, "parallel_for did not visit every index exactly once, with grain size ", grain_size, " and ", workers, " workers");
+		}
+		std::atomic<int> visits{0};
+		tz::algo::JobHandle empty = system.parallel_for(5, 5, 1, [&visits](std::size_t){visits++;});
+		system.wait(empty);
+		topaz_expect(test_case, empty.complete() && visits == 0, "parallel_for over an empty range should complete without invoking the function");
+		// Offset ranges only visit their own indices.
+		std::atomic<std::size_t> sum{0};
+		system.wait(system.parallel_for(10, 20, 3, [&sum](std::size_t i){sum += i;}));
+		topaz_expect(test_case, sum == 145, "parallel_for over [10, 20) summed to ", sum.load(), " instead of 145");
+	}
+	return test_case;
+}
+
+tz::test::Case dependencies()
+{
+	tz::test::Case test_case("tz::algo::JobSystem Dependency Tests");
+	for(std::size_t workers : worker_counts)
+	{
+		tz::algo::JobSystem system{workers};
+		// Each stage reads what the previous stage wrote, so they must run strictly in order.
+		std::vector<int> values(256, 0);
+		tz::algo::JobHandle previous;
+		for(int stage = 0; stage < 8; stage++)
+		{
+			previous = system.parallel_for(0, values.size(), 16, [&values, stage](std::size_t i)
+			{
+				if(values[i] == stage)
+					values[i]++;
+			}, {&previous, 1});
+		}
+		system.wait(previous);
+		const bool in_order = std::all_of(values.begin(), values.end(), [](int v){return v == 8;});
+		topaz_expect(test_case, in_order, "Dependent parallel_fors did not run in order, with ", workers, " workers");
+
+		// A job depending on several others only runs once they all have.
+		std::atomic<int> finished{0};
+		std::array<tz::algo::JobHandle, 3> producers;
+		for(tz::algo::JobHandle& producer : producers)
+		{
+			producer = system.execute([&finished](){finished++;});
+		}
+		int seen = -1;
+		tz::algo::JobHandle consumer = system.execute([&finished, &seen](){seen = finished.load();}, {producers.data(), producers.size()});
+		system.wait(consumer);
+		topaz_expect(test_case, seen == 3, "Job ran before all of its dependencies had completed. It saw ", seen, " of 3, with ", workers, " workers");
+	}
+	return test_case;
+}
+
+tz::test::Case nested()
+{
+	tz::test::Case test_case("tz::algo::JobSystem Nested Tests");
+	for(std::size_t workers : worker_counts)
+	{
+		tz::algo::JobSystem system{workers};
+		// Jobs which wait on other jobs help rather than block, so this cannot deadlock even without workers.
+		std::vector<std::atomic<int>> visits(64 * 64);
+		system.wait(system.parallel_for(0, 64, 1, [&system, &visits](std::size_t row)
+		{
+			system.wait(system.parallel_for(0, 64, 8, [&visits, row](std::size_t column){visits[(row * 64) + column]++;}));
+		}));
+		const bool each_once = std::all_of(visits.begin(), visits.end(), [](const std::atomic<int>& v){return v == 1;});
+		topaz_expect(test_case, each_once, "Nested parallel_for did not visit every index exactly once, with ", workers, " workers");
+	}
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit job_system;
+
+	job_system.add(execute());
+	job_system.add(parallel_for());
+	job_system.add(dependencies());
+	job_system.add(nested());
+
+	return job_system.result();
+}
@@ -0,0 +1,111 @@
+#include "test_framework.hpp"
+#include "geo/bounds.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Not a multiple of the batch width, so the scalar tail is covered too.
+	constexpr std::size_t counts[] = {1, 3, 4, 1027};
+
+	struct Interleaved
+	{
+		float before;
+		tz::Vec3 position;
+		float after[3];
+	};
+
+	std::vector<tz::Vec3> random_points(std::mt19937& rng, std::size_t count)
+	{
+		std::uniform_real_distribution<float> coordinate{-100.0f, 100.0f};
+		std::vector<tz::Vec3> points;
+		for(std::size_t i = 0; i < count; i++)
+			points.push_back({{coordinate(rng), coordinate(rng), coordinate(rng)}});
+		return points;
+	}
+
+	tz::geo::AABB reference_box(const std::vector<tz::Vec3>& points)
+	{
+		tz::geo::AABB box{points.front(), points.front()};
+		for(const tz::Vec3& point : points)
+		{
+			for(std::size_t i = 0; i < 3; i++)
+			{
+				box.min[i] = std::min(box.min[i], point[i]);
+				box.max[i] = std::max(box.max[i], point[i]);
+			}
+		}
+		return box;
+	}
+}
+
+tz::test::Case box()
+{
+	tz::test::Case test_case("tz::geo::bound Box Tests");
+	std::mt19937 rng{1};
+	for(std::size_t count : counts)
+	{
+		std::vector<tz::Vec3> points = random_points(rng, count);
+		const tz::geo::AABB expected = reference_box(points);
+		const tz::geo::AABB box = tz::geo::bound({points.data(), points.size()}).box;
+		topaz_expect(test_case, box.min == expected.min && box.max == expected.max, "tz::geo::bound(...) gave the wrong bounding box for ", count, " points");
+		// Bounding the same points interleaved with other data must give the same result.
+		std::vector<Interleaved> interleaved;
+		for(const tz::Vec3& point : points)
+			interleaved.push_back({-1000.0f, point, {1000.0f, 1000.0f, 1000.0f}});
+		const tz::geo::AABB strided = tz::geo::bound(&interleaved.front().position, interleaved.size(), sizeof(Interleaved)).box;
+		topaz_expect(test_case, strided.min == expected.min && strided.max == expected.max, "tz::geo::bound(...) gave the wrong bounding box for ", count, " strided points");
+	}
+	return test_case;
+}
+
+tz::test::Case sphere()
+{
+	tz::test::Case test_case("tz::geo::bound Sphere Tests");
+	std::mt19937 rng{2};
+	for(std::size_t count : counts)
+	{
+		std::vector<tz::Vec3> points = random_points(rng, count);
+		const tz::geo::Bounds bounds = tz::geo::bound({points.data(), points.size()});
+		topaz_expect(test_case, bounds.sphere.centre == bounds.box.centre(), "tz::geo::bound(...) sphere was not centred on the box for ", count, " points");
+		// Every point must be inside, and at least one must touch the surface.
+		float furthest = 0.0f;
+		for(const tz::Vec3& point : points)
+		{
+			tz::Vec3 offset = point;
+			offset -= bounds.sphere.centre;
+			furthest = std::max(furthest, offset.length());
+		}
+		topaz_expect(test_case, std::abs(furthest - bounds.sphere.radius) <= 0.0001f * (1.0f + furthest), "tz::geo::bound(...) sphere radius was ", bounds.sphere.radius, ", expected ", furthest, " for ", count, " points");
+		// The sphere is never larger than the box's circumscribed sphere.
+		const float circumscribed = bounds.box.extents().length();
+		topaz_expect(test_case, bounds.sphere.radius <= circumscribed * 1.0001f, "tz::geo::bound(...) sphere radius ", bounds.sphere.radius, " exceeds that of the circumscribed sphere ", circumscribed);
+	}
+	return test_case;
+}
+
+tz::test::Case degenerate()
+{
+	tz::test::Case test_case("tz::geo::bound Degenerate Tests");
+	const tz::geo::Bounds empty = tz::geo::bound({nullptr, 0});
+	const tz::Vec3 origin{{0.0f, 0.0f, 0.0f}};
+	topaz_expect(test_case, empty.box.min == origin && empty.box.max == origin && empty.sphere.radius == 0.0f, "tz::geo::bound(...) of no points was not degenerate at the origin");
+	const tz::Vec3 point{{1.0f, 2.0f, 3.0f}};
+	const tz::geo::Bounds single = tz::geo::bound({&point, 1});
+	topaz_expect(test_case, single.box.min == point && single.box.max == point && single.sphere.centre == point && single.sphere.radius == 0.0f, "tz::geo::bound(...) of a single point was not degenerate at that point");
+	topaz_expect(test_case, single.box.contains(point) && single.sphere.contains(point), "tz::geo::bound(...) of a single point did not contain the point");
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit geo;
+
+	geo.add(box());
+	geo.add(sphere());
+	geo.add(degenerate());
+
+	return geo.result();
+}
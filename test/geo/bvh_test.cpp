@@ -0,0 +1,201 @@
+#include "test_framework.hpp"
+#include "geo/bvh.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr float max_distance = 1000.0f;
+	constexpr std::size_t counts[] = {0, 1, 7, 2000};
+
+	tz::geo::AABB random_box(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> coordinate{-50.0f, 50.0f};
+		std::uniform_real_distribution<float> size{0.0f, 4.0f};
+		const tz::Vec3 min{{coordinate(rng), coordinate(rng), coordinate(rng)}};
+		const tz::Vec3 max{{min[0] + size(rng), min[1] + size(rng), min[2] + size(rng)}};
+		return {min, max};
+	}
+
+	// Mostly arbitrary rays, but every fourth is axis-aligned so that zero direction components are covered.
+	tz::geo::Ray random_ray(std::mt19937& rng, std::size_t i)
+	{
+		std::uniform_real_distribution<float> coordinate{-60.0f, 60.0f};
+		std::uniform_real_distribution<float> component{-1.0f, 1.0f};
+		tz::geo::Ray ray{{{coordinate(rng), coordinate(rng), coordinate(rng)}}, {{component(rng), component(rng), component(rng)}}};
+		if(i % 4 == 0)
+		{
+			const std::size_t axis = (i / 4) % 3;
+			for(std::size_t j = 0; j < 3; j++)
+				ray.direction[j] = j == axis ? 1.0f : 0.0f;
+		}
+		return ray;
+	}
+
+	std::vector<tz::Vec3> random_triangles(std::mt19937& rng, std::size_t count)
+	{
+		std::uniform_real_distribution<float> offset{-3.0f, 3.0f};
+		std::vector<tz::Vec3> positions;
+		for(std::size_t i = 0; i < count; i++)
+		{
+			const tz::Vec3 centre = random_box(rng).min;
+			for(std::size_t j = 0; j < 3; j++)
+				positions.push_back({{centre[0] + offset(rng), centre[1] + offset(rng), centre[2] + offset(rng)}});
+		}
+		return positions;
+	}
+
+	std::vector<tz::geo::AABB> triangle_bounds(const std::vector<tz::Vec3>& positions)
+	{
+		std::vector<tz::geo::AABB> bounds;
+		for(std::size_t i = 0; i < positions.size(); i += 3)
+		{
+			tz::geo::AABB box{positions[i], positions[i]};
+			for(std::size_t j = 1; j < 3; j++)
+			{
+				for(std::size_t axis = 0; axis < 3; axis++)
+				{
+					box.min[axis] = std::min(box.min[axis], positions[i + j][axis]);
+					box.max[axis] = std::max(box.max[axis], positions[i + j][axis]);
+				}
+			}
+			bounds.push_back(box);
+		}
+		return bounds;
+	}
+}
+
+tz::test::Case intersect()
+{
+	tz::test::Case test_case("tz::geo::intersect Tests");
+	const tz::geo::AABB box{{{-1.0f, -1.0f, -1.0f}}, {{1.0f, 1.0f, 1.0f}}};
+	const tz::geo::Ray towards{{{-5.0f, 0.0f, 0.0f}}, {{1.0f, 0.0f, 0.0f}}};
+	const tz::geo::Ray away{{{-5.0f, 0.0f, 0.0f}}, {{-1.0f, 0.0f, 0.0f}}};
+	const tz::geo::Ray inside{{{0.0f, 0.0f, 0.0f}}, {{0.0f, 1.0f, 0.0f}}};
+	const std::optional<float> hit = tz::geo::intersect(towards, box, max_distance);
+	topaz_expect(test_case, hit.has_value() && hit.value() == 4.0f, "Ray towards a box should enter it at distance 4");
+	topaz_expect(test_case, !tz::geo::intersect(away, box, max_distance).has_value(), "Ray pointing away from a box should miss it");
+	topaz_expect(test_case, !tz::geo::intersect(towards, box, 3.0f).has_value(), "Ray should miss a box beyond its max distance");
+	const std::optional<float> inside_hit = tz::geo::intersect(inside, box, max_distance);
+	topaz_expect(test_case, inside_hit.has_value() && inside_hit.value() == 0.0f, "Ray starting inside a box should hit it at distance 0");
+
+	const tz::Vec3 a{{0.0f, 0.0f, -2.0f}};
+	const tz::Vec3 b{{1.0f, 0.0f, -2.0f}};
+	const tz::Vec3 c{{0.0f, 1.0f, -2.0f}};
+	const tz::geo::Ray forward{{{0.25f, 0.25f, 0.0f}}, {{0.0f, 0.0f, -1.0f}}};
+	const tz::geo::Ray beside{{{0.75f, 0.75f, 0.0f}}, {{0.0f, 0.0f, -1.0f}}};
+	const std::optional<float> triangle_hit = tz::geo::intersect(forward, a, b, c, max_distance);
+	topaz_expect(test_case, triangle_hit.has_value() && std::abs(triangle_hit.value() - 2.0f) < 0.0001f, "Ray should hit the triangle at distance 2");
+	topaz_expect(test_case, !tz::geo::intersect(beside, a, b, c, max_distance).has_value(), "Ray outside of the triangle's edge should miss it");
+	topaz_expect(test_case, tz::geo::overlaps(box, tz::geo::AABB{{{1.0f, 1.0f, 1.0f}}, {{2.0f, 2.0f, 2.0f}}}), "Touching boxes should overlap");
+	topaz_expect(test_case, !tz::geo::overlaps(box, tz::geo::AABB{{{1.5f, 0.0f, 0.0f}}, {{2.0f, 2.0f, 2.0f}}}), "Separated boxes should not overlap");
+	return test_case;
+}
+
+tz::test::Case boxes()
+{
+	tz::test::Case test_case("tz::geo::BVH Box Query Tests");
+	std::mt19937 rng{1};
+	for(std::size_t count : counts)
+	{
+		std::vector<tz::geo::AABB> primitives;
+		for(std::size_t i = 0; i < count; i++)
+			primitives.push_back(random_box(rng));
+		const tz::geo::BVH bvh{{primitives.data(), primitives.size()}};
+		topaz_expect(test_case, bvh.size() == count, "BVH had unexpected size. Expected ", count, ", got ", bvh.size());
+		for(std::size_t r = 0; r < 200; r++)
+		{
+			const tz::geo::Ray ray = random_ray(rng, r);
+			std::optional<float> expected;
+			for(const tz::geo::AABB& primitive : primitives)
+			{
+				const std::optional<float> distance = tz::geo::intersect(ray, primitive, max_distance);
+				if(distance.has_value() && (!expected.has_value() || distance.value() < expected.value()))
+					expected = distance;
+			}
+			topaz_expect(test_case, bvh.raycast(ray, max_distance) == expected.has_value(), "BVH::raycast disagreed with brute-force for ray ", r, " over ", count, " boxes");
+			const std::optional<tz::geo::RayHit> hit = bvh.closest_hit(ray, max_distance);
+			const bool agrees = hit.has_value() == expected.has_value() && (!hit.has_value() || hit->distance == expected.value());
+			topaz_expect(test_case, agrees, "BVH::closest_hit disagreed with brute-force for ray ", r, " over ", count, " boxes");
+		}
+		for(std::size_t q = 0; q < 50; q++)
+		{
+			const tz::geo::AABB query = random_box(rng);
+			std::vector<std::size_t> expected;
+			for(std::size_t i = 0; i < count; i++)
+			{
+				if(tz::geo::overlaps(primitives[i], query))
+					expected.push_back(i);
+			}
+			std::vector<std::size_t> overlapping = bvh.overlap(query);
+			std::sort(overlapping.begin(), overlapping.end());
+			topaz_expect(test_case, overlapping == expected, "BVH::overlap disagreed with brute-force for query ", q, " over ", count, " boxes. Expected ", expected.size(), " primitives, got ", overlapping.size());
+		}
+	}
+	return test_case;
+}
+
+tz::test::Case triangles()
+{
+	tz::test::Case test_case("tz::geo::BVH Triangle Query Tests");
+	std::mt19937 rng{2};
+	const std::vector<tz::Vec3> positions = random_triangles(rng, 2000);
+	const std::vector<tz::geo::AABB> bounds = triangle_bounds(positions);
+	const tz::geo::BVH bvh{{bounds.data(), bounds.size()}};
+	auto intersect_triangle = [&positions](const tz::geo::Ray& ray, std::size_t triangle, float max)
+	{
+		return tz::geo::intersect(ray, positions[triangle * 3], positions[(triangle * 3) + 1], positions[(triangle * 3) + 2], max);
+	};
+	std::size_t hits = 0;
+	for(std::size_t r = 0; r < 500; r++)
+	{
+		const tz::geo::Ray ray = random_ray(rng, r);
+		std::optional<float> expected;
+		for(std::size_t i = 0; i < bounds.size(); i++)
+		{
+			const std::optional<float> distance = intersect_triangle(ray, i, max_distance);
+			if(distance.has_value() && (!expected.has_value() || distance.value() < expected.value()))
+				expected = distance;
+		}
+		auto exact = [&intersect_triangle, &ray](std::size_t triangle, float max){return intersect_triangle(ray, triangle, max);};
+		const std::optional<tz::geo::RayHit> hit = bvh.closest_hit(ray, max_distance, exact);
+		const bool agrees = hit.has_value() == expected.has_value() && (!hit.has_value() || hit->distance == expected.value());
+		topaz_expect(test_case, agrees, "BVH::closest_hit disagreed with brute-force for ray ", r);
+		topaz_expect(test_case, bvh.raycast(ray, max_distance, exact) == expected.has_value(), "BVH::raycast disagreed with brute-force for ray ", r);
+		if(expected.has_value())
+			hits++;
+	}
+	// Make sure the comparison above is meaningful.
+	topaz_expect(test_case, hits > 0, "No rays hit any triangles, so the test is not exercising anything");
+	return test_case;
+}
+
+tz::test::Case degenerate()
+{
+	tz::test::Case test_case("tz::geo::BVH Degenerate Tests");
+	// Identical boxes cannot be separated by the SAH, so must still be split into valid leaves.
+	const tz::geo::AABB box{{{0.0f, 0.0f, 0.0f}}, {{1.0f, 1.0f, 1.0f}}};
+	const std::vector<tz::geo::AABB> primitives(5000, box);
+	const tz::geo::BVH bvh{{primitives.data(), primitives.size()}};
+	const tz::geo::Ray ray{{{0.5f, 0.5f, -5.0f}}, {{0.0f, 0.0f, 1.0f}}};
+	const std::optional<tz::geo::RayHit> hit = bvh.closest_hit(ray, max_distance);
+	topaz_expect(test_case, hit.has_value() && hit->distance == 5.0f, "Ray should hit the coincident boxes at distance 5");
+	topaz_expect(test_case, bvh.overlap(box).size() == primitives.size(), "Every coincident box should overlap itself");
+	const tz::geo::BVH empty;
+	topaz_expect(test_case, empty.empty() && !empty.raycast(ray, max_distance) && !empty.closest_hit(ray, max_distance).has_value() && empty.overlap(box).empty(), "Empty BVH should never hit anything");
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit bvh;
+
+	bvh.add(intersect());
+	bvh.add(boxes());
+	bvh.add(triangles());
+	bvh.add(degenerate());
+
+	return bvh.result();
+}
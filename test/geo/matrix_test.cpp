@@ -7,6 +7,8 @@
 #include "geo/matrix.hpp"
 #include <string>
 #include <cstring>
+#include <cmath>
+#include <random>
 
 tz::test::Case identity()
 {
@@ -65,6 +67,66 @@ tz::test::Case addition()
 	return test_case;
 }
 
+tz::test::Case expressions()
+{
+	tz::test::Case test_case("tz::geo::Matrix Expression Tests");
+	tz::Mat4 m = tz::Mat4::identity();
+	tz::Mat4 n = tz::Mat4::identity() * 2.0f;
+	// Element-wise chains evaluate in one pass, scalars are applied to every element.
+	tz::Mat4 o = (m + n) * 2.0f - 1.0f;
+	for(std::size_t i = 0; i < 4; i++)
+	{
+		for(std::size_t j = 0; j < 4; j++)
+		{
+			float expected = (i == j) ? 5.0f : -1.0f;
+			topaz_expect(test_case, o(i, j) == expected, "Matrix expression yielded unexpected value ", o(i, j), " at (", i, ", ", j, "). Expected ", expected);
+		}
+	}
+	// Matrix products aren't element-wise, but still accept expressions on either side.
+	tz::Mat4 product = (m + m) * (n - m);
+	topaz_expect(test_case, product == tz::Mat4::identity() * 2.0f, "Product of matrix expressions yielded the wrong result");
+	tz::Vec4 v{{1.0f, 2.0f, 3.0f, 4.0f}};
+	tz::Vec4 scaled = (m * 3.0f) * v;
+	topaz_expect(test_case, scaled == v * 3.0f, "Matrix expression multiplied by a vector yielded {", scaled[0], ", ", scaled[1], ", ", scaled[2], ", ", scaled[3], "}");
+	return test_case;
+}
+
+tz::test::Case constant_evaluation()
+{
+	tz::test::Case test_case("tz::geo::Matrix Constant Evaluation Tests");
+	constexpr tz::Mat4 identity = tz::Mat4::identity();
+	static_assert(identity(2, 2) == 1.0f && identity(2, 3) == 0.0f);
+	constexpr tz::Mat4 m = []()
+	{
+		tz::Mat4 mat{};
+		for(std::size_t i = 0; i < 4; i++)
+		{
+			for(std::size_t j = 0; j < 4; j++)
+			{
+				mat(i, j) = static_cast<float>(i * 4 + j);
+			}
+		}
+		return mat;
+	}();
+	static_assert(m(1, 2) == 6.0f);
+	static_assert(m.transpose()(2, 1) == 6.0f);
+	static_assert(m * identity == m);
+	static_assert(identity * m == m);
+	constexpr tz::Mat4 doubled = m + m;
+	static_assert(doubled == m * 2.0f);
+	static_assert(tz::Mat4{m - m} == 0.0f);
+	// Mat4 * Vec4 returns the dot product of each column with the vector.
+	constexpr tz::Vec4 v = m * tz::Vec4{{1.0f, 0.0f, 0.0f, 0.0f}};
+	static_assert(v == tz::Vec4{{0.0f, 1.0f, 2.0f, 3.0f}});
+	constexpr tz::Mat3 m3 = tz::Mat3::identity() * 3.0f;
+	static_assert(m3.transpose() == m3);
+	// The SIMD kernels used at runtime agree with constant evaluation.
+	tz::Mat4 runtime_m = m;
+	topaz_expect(test_case, runtime_m.transpose() == m.transpose(), "tz::Mat4::transpose() gave a different result at runtime than during constant evaluation.");
+	topaz_expect(test_case, runtime_m * runtime_m == m * m, "tz::Mat4 multiplication gave a different result at runtime than during constant evaluation.");
+	return test_case;
+}
+
 tz::test::Case inversion()
 {
 	tz::test::Case test_case("tz::geo::Matrix Inversion Tests");
@@ -133,14 +195,105 @@ tz::test::Case column_major()
 	return test_case;
 }
 
+namespace
+{
+	template<std::size_t N>
+	tz::Matrix<float, N, N> random_matrix(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> dist{-10.0f, 10.0f};
+		tz::Matrix<float, N, N> m;
+		for(std::size_t i = 0; i < N; i++)
+		{
+			for(std::size_t j = 0; j < N; j++)
+			{
+				m(i, j) = dist(rng);
+			}
+		}
+		// Strengthen the diagonal so that the matrix is comfortably invertible.
+		for(std::size_t i = 0; i < N; i++)
+			m(i, i) += 40.0f;
+		return m;
+	}
+
+	template<std::size_t N>
+	bool roughly_equal(const tz::Matrix<float, N, N>& a, const tz::Matrix<float, N, N>& b, float tolerance)
+	{
+		for(std::size_t i = 0; i < N; i++)
+		{
+			for(std::size_t j = 0; j < N; j++)
+			{
+				if(std::abs(a(i, j) - b(i, j)) > tolerance * std::max(1.0f, std::abs(b(i, j))))
+					return false;
+			}
+		}
+		return true;
+	}
+}
+
+tz::test::Case transposition()
+{
+	tz::test::Case test_case("tz::geo::Matrix Transposition Tests");
+	tz::Mat4 order{{std::array<float, 4>{0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9, 10, 11}, {12, 13, 14, 15}}};
+	tz::Mat4 t = order.transpose();
+	tz::Mat3 order3{{std::array<float, 3>{0, 1, 2}, {3, 4, 5}, {6, 7, 8}}};
+	tz::Mat3 t3 = order3.transpose();
+	for(std::size_t i = 0; i < 4; i++)
+	{
+		for(std::size_t j = 0; j < 4; j++)
+		{
+			topaz_expect(test_case, t(i, j) == order(j, i), "Mat4 transpose incorrect at (", i, ", ", j, "). Expected ", order(j, i), ", got ", t(i, j));
+			if(i < 3 && j < 3)
+			{
+				topaz_expect(test_case, t3(i, j) == order3(j, i), "Mat3 transpose incorrect at (", i, ", ", j, "). Expected ", order3(j, i), ", got ", t3(i, j));
+			}
+		}
+	}
+	return test_case;
+}
+
+tz::test::Case simd_matches_generic()
+{
+	tz::test::Case test_case("tz::geo::Matrix SIMD/Generic Equivalence Tests");
+	std::mt19937 rng{1234};
+	for(std::size_t iteration = 0; iteration < 64; iteration++)
+	{
+		tz::Mat4 a = random_matrix<4>(rng);
+		tz::Mat4 b = random_matrix<4>(rng);
+		tz::Vec4 v{{a(0, 1), a(1, 2), a(2, 3), a(3, 0)}};
+		topaz_expect(test_case, roughly_equal(a * b, tz::detail::generic_multiply(a, b), 1e-5f), "Mat4 * Mat4 does not match the generic implementation.");
+		topaz_expect(test_case, a * v == tz::detail::generic_multiply(a, v) || (a * v - tz::detail::generic_multiply(a, v)).length() < 1e-3f, "Mat4 * Vec4 does not match the generic implementation.");
+		topaz_expect(test_case, a.transpose() == tz::detail::generic_transpose(a), "Mat4 transpose does not match the generic implementation.");
+		topaz_expect(test_case, roughly_equal(a.inverse(), tz::detail::generic_inverse(a), 1e-4f), "Mat4 inverse does not match the generic implementation.");
+		topaz_expect(test_case, roughly_equal(a * a.inverse(), tz::Mat4::identity(), 1e-4f), "Mat4 multiplied by its inverse is not the identity.");
+		topaz_expect(test_case, std::abs(v.dot(v) - (v[0] * v[0] + v[1] * v[1] + v[2] * v[2] + v[3] * v[3])) < 1e-2f, "Vec4 dot product is incorrect.");
+
+		tz::Mat3 c = random_matrix<3>(rng);
+		tz::Mat3 d = random_matrix<3>(rng);
+		topaz_expect(test_case, roughly_equal(c * d, tz::detail::generic_multiply(c, d), 1e-5f), "Mat3 * Mat3 does not match the generic implementation.");
+		topaz_expect(test_case, c.transpose() == tz::detail::generic_transpose(c), "Mat3 transpose does not match the generic implementation.");
+		topaz_expect(test_case, roughly_equal(c.inverse(), tz::detail::generic_inverse(c), 1e-4f), "Mat3 inverse does not match the generic implementation.");
+		topaz_expect(test_case, roughly_equal(c * c.inverse(), tz::Mat3::identity(), 1e-4f), "Mat3 multiplied by its inverse is not the identity.");
+	}
+	// The product may alias an operand.
+	tz::Mat4 e = random_matrix<4>(rng);
+	tz::Mat4 expected = tz::detail::generic_multiply(e, e);
+	e *= e;
+	topaz_expect(test_case, roughly_equal(e, expected, 1e-5f), "Mat4 *= itself produced the wrong result.");
+	return test_case;
+}
+
 int main()
 {
 	tz::test::Unit mat;
 
 	mat.add(identity());
 	mat.add(addition());
+	mat.add(expressions());
+	mat.add(constant_evaluation());
 	mat.add(inversion());
 	mat.add(column_major());
+	mat.add(transposition());
+	mat.add(simd_matches_generic());
 
 	return mat.result();
 }
\ No newline at end of file
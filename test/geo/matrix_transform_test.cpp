@@ -0,0 +1,237 @@
+#include "test_framework.hpp"
+#include "geo/matrix_transform.hpp"
+#include "algo/job_system.hpp"
+#include "memory/pool.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+	struct Transforms
+	{
+		std::vector<tz::Vec3> positions;
+		std::vector<tz::Vec3> rotations;
+		std::vector<tz::Quaternion> quaternions;
+		std::vector<tz::Vec3> scales;
+	};
+
+	// Rotations deliberately include angles well outside of [-pi, pi], to exercise the range reduction of the SIMD sincos.
+	Transforms random_transforms(std::size_t count)
+	{
+		std::mt19937 rng{count};
+		std::uniform_real_distribution<float> position{-100.0f, 100.0f};
+		std::uniform_real_distribution<float> angle{-50.0f, 50.0f};
+		std::uniform_real_distribution<float> scale{0.1f, 10.0f};
+		Transforms t;
+		for(std::size_t i = 0; i < count; i++)
+		{
+			t.positions.push_back({{position(rng), position(rng), position(rng)}});
+			tz::Vec3 rotation{{angle(rng), angle(rng), angle(rng)}};
+			t.rotations.push_back(rotation);
+			t.quaternions.push_back(tz::Quaternion::from_eulers(rotation));
+			t.scales.push_back({{scale(rng), scale(rng), scale(rng)}});
+		}
+		return t;
+	}
+
+	bool roughly_equal(const tz::Mat4& a, const tz::Mat4& b)
+	{
+		for(std::size_t i = 0; i < 16; i++)
+		{
+			float expected = b.data()[i];
+			if(std::abs(a.data()[i] - expected) > 1e-4f * std::max(1.0f, std::abs(expected)))
+				return false;
+		}
+		return true;
+	}
+
+	template<std::size_t N>
+	bool roughly_equal(const tz::Matrix<float, N, N>& a, const tz::Matrix<float, N, N>& b, float tolerance)
+	{
+		for(std::size_t i = 0; i < N * N; i++)
+		{
+			float expected = b.data()[i];
+			if(std::abs(a.data()[i] - expected) > tolerance * std::max(1.0f, std::abs(expected)))
+				return false;
+		}
+		return true;
+	}
+
+	std::size_t count_mismatches(const std::vector<tz::Mat4>& actual, const std::vector<tz::Mat4>& expected)
+	{
+		std::size_t mismatches = 0;
+		for(std::size_t i = 0; i < actual.size(); i++)
+		{
+			if(!roughly_equal(actual[i], expected[i]))
+				mismatches++;
+		}
+		return mismatches;
+	}
+}
+
+tz::test::Case model_batch_euler()
+{
+	tz::test::Case test_case("tz::geo::model_batch Euler Test");
+	// Not a multiple of the batch width, so the scalar tail is covered too.
+	for(std::size_t count : {0u, 1u, 3u, 4u, 1027u})
+	{
+		Transforms t = random_transforms(count);
+		std::vector<tz::Mat4> expected;
+		for(std::size_t i = 0; i < count; i++)
+			expected.push_back(tz::geo::model(t.positions[i], t.rotations[i], t.scales[i]));
+		std::vector<tz::Mat4> actual(count);
+		tz::geo::model_batch({t.positions.data(), count}, {t.rotations.data(), count}, {t.scales.data(), count}, {actual.data(), count});
+		std::size_t mismatches = count_mismatches(actual, expected);
+		topaz_expect(test_case, mismatches == 0, "tz::geo::model_batch(...) disagreed with tz::geo::model(...) for ", mismatches, " out of ", count, " transforms");
+	}
+	return test_case;
+}
+
+tz::test::Case model_batch_quaternion()
+{
+	tz::test::Case test_case("tz::geo::model_batch Quaternion Test");
+	constexpr std::size_t count = 1027;
+	Transforms t = random_transforms(count);
+	// Quaternions needn't be normalised.
+	for(std::size_t i = 0; i < count; i += 2)
+		t.quaternions[i] = t.quaternions[i] * t.quaternions[i];
+	std::vector<tz::Mat4> expected;
+	for(std::size_t i = 0; i < count; i++)
+		expected.push_back(tz::geo::translate(t.positions[i]) * static_cast<tz::Mat4>(t.quaternions[i]) * tz::geo::scale(t.scales[i]));
+	std::vector<tz::Mat4> actual(count);
+	tz::geo::model_batch({t.positions.data(), count}, {t.quaternions.data(), count}, {t.scales.data(), count}, {actual.data(), count});
+	std::size_t mismatches = count_mismatches(actual, expected);
+	topaz_expect(test_case, mismatches == 0, "tz::geo::model_batch(...) with quaternions disagreed with the equivalent matrix product for ", mismatches, " out of ", count, " transforms");
+	return test_case;
+}
+
+tz::test::Case model_batch_threaded()
+{
+	tz::test::Case test_case("tz::geo::model_batch Multi-threaded Test");
+	constexpr std::size_t count = 50001;
+	Transforms t = random_transforms(count);
+	std::vector<tz::Mat4> single(count);
+	std::vector<tz::Mat4> threaded(count);
+	tz::algo::JobSystem job_system{3};
+	tz::geo::model_batch({t.positions.data(), count}, {t.rotations.data(), count}, {t.scales.data(), count}, {single.data(), count});
+	tz::geo::model_batch({t.positions.data(), count}, {t.rotations.data(), count}, {t.scales.data(), count}, {threaded.data(), count}, &job_system);
+	// Each transform is computed identically regardless of which thread computes it.
+	topaz_expect(test_case, single == threaded, "tz::geo::model_batch(...) produced different results when multi-threaded");
+	return test_case;
+}
+
+tz::test::Case model_batch_into_pool()
+{
+	tz::test::Case test_case("tz::geo::model_batch UniformPool Destination Test");
+	constexpr std::size_t count = 8;
+	Transforms t = random_transforms(count);
+	tz::mem::AutoBlock block{sizeof(tz::Mat4) * count};
+	tz::mem::UniformPool<tz::Mat4> pool{block};
+	for(std::size_t i = 0; i < count; i++)
+		pool.set(i, tz::Mat4::identity());
+	tz::mem::Span<tz::Mat4> destination{&pool[0], pool.capacity()};
+	tz::geo::model_batch({t.positions.data(), count}, {t.rotations.data(), count}, {t.scales.data(), count}, destination);
+	for(std::size_t i = 0; i < count; i++)
+	{
+		topaz_expect(test_case, roughly_equal(pool[i], tz::geo::model(t.positions[i], t.rotations[i], t.scales[i])), "tz::geo::model_batch(...) wrote the wrong model matrix into UniformPool index ", i);
+	}
+	return test_case;
+}
+
+tz::test::Case affine_inverse()
+{
+	tz::test::Case test_case("tz::geo::affine_inverse Test");
+	constexpr std::size_t count = 256;
+	Transforms t = random_transforms(count);
+	for(std::size_t i = 0; i < count; i++)
+	{
+		tz::Mat4 m = tz::geo::model(t.positions[i], t.rotations[i], t.scales[i]);
+		tz::Mat4 inv = tz::geo::affine_inverse(m);
+		topaz_expect(test_case, roughly_equal(inv, tz::detail::generic_inverse(m), 1e-3f), "tz::geo::affine_inverse(...) disagreed with the generic inverse for transform ", i);
+		topaz_expect(test_case, roughly_equal(m * inv, tz::Mat4::identity(), 1e-3f), "tz::geo::affine_inverse(...) multiplied by the original matrix is not the identity for transform ", i);
+	}
+	// Input and output may be the same matrix.
+	tz::Mat4 m = tz::geo::model(t.positions[0], t.rotations[0], t.scales[0]);
+	tz::Mat4 expected = tz::detail::generic_inverse(m);
+	m = tz::geo::affine_inverse(m);
+	topaz_expect(test_case, roughly_equal(m, expected, 1e-3f), "tz::geo::affine_inverse(...) gave the wrong result when assigning back to its input");
+	return test_case;
+}
+
+tz::test::Case rigid_inverse()
+{
+	tz::test::Case test_case("tz::geo::rigid_inverse Test");
+	constexpr std::size_t count = 256;
+	Transforms t = random_transforms(count);
+	for(std::size_t i = 0; i < count; i++)
+	{
+		tz::Mat4 m = tz::geo::translate(t.positions[i]) * tz::geo::rotate(t.rotations[i]);
+		tz::Mat4 inv = tz::geo::rigid_inverse(m);
+		topaz_expect(test_case, roughly_equal(inv, tz::detail::generic_inverse(m), 1e-3f), "tz::geo::rigid_inverse(...) disagreed with the generic inverse for transform ", i);
+		topaz_expect(test_case, roughly_equal(tz::geo::view(t.positions[i], t.rotations[i]), inv, 1e-5f), "tz::geo::view(...) is not the rigid inverse of translate(...) * rotate(...) for transform ", i);
+	}
+	return test_case;
+}
+
+tz::test::Case normal_matrix()
+{
+	tz::test::Case test_case("tz::geo::normal_matrix Test");
+	constexpr std::size_t count = 256;
+	Transforms t = random_transforms(count);
+	for(std::size_t i = 0; i < count; i++)
+	{
+		tz::Mat4 m = tz::geo::model(t.positions[i], t.rotations[i], t.scales[i]);
+		tz::Mat3 upper_left;
+		for(std::size_t row = 0; row < 3; row++)
+		{
+			for(std::size_t col = 0; col < 3; col++)
+			{
+				upper_left(row, col) = m(row, col);
+			}
+		}
+		tz::Mat3 expected = tz::detail::generic_transpose(tz::detail::generic_inverse(upper_left));
+		topaz_expect(test_case, roughly_equal(tz::geo::normal_matrix(m), expected, 1e-3f), "tz::geo::normal_matrix(...) disagreed with the generic inverse-transpose for transform ", i);
+	}
+	// A normal on a surface scaled non-uniformly must remain perpendicular to the surface.
+	tz::Mat4 squash = tz::geo::scale({{1.0f, 4.0f, 1.0f}});
+	tz::Vec3 tangent{{1.0f, 1.0f, 0.0f}};
+	tz::Vec3 normal{{1.0f, -1.0f, 0.0f}};
+	tz::Vec4 tangent_after = squash * tz::Vec4{{tangent[0], tangent[1], tangent[2], 0.0f}};
+	tz::Vec3 normal_after = tz::geo::normal_matrix(squash) * normal;
+	float dot = tangent_after[0] * normal_after[0] + tangent_after[1] * normal_after[1] + tangent_after[2] * normal_after[2];
+	topaz_expect(test_case, std::abs(dot) < 1e-5f, "tz::geo::normal_matrix(...) produced a normal which is no longer perpendicular to its surface. Dot product = ", dot);
+	return test_case;
+}
+
+tz::test::Case constant_evaluation()
+{
+	tz::test::Case test_case("tz::geo Constant Evaluation Tests");
+	constexpr tz::Mat4 t = tz::geo::translate({{1.0f, 2.0f, 3.0f}});
+	static_assert(t(0, 3) == 1.0f && t(1, 3) == 2.0f && t(2, 3) == 3.0f && t(3, 3) == 1.0f);
+	constexpr tz::Mat4 s = tz::geo::scale({{2.0f, 4.0f, 8.0f}});
+	static_assert(s(0, 0) == 2.0f && s(1, 1) == 4.0f && s(2, 2) == 8.0f && s(3, 3) == 1.0f);
+	constexpr tz::Mat4 ts = t * s;
+	static_assert(ts(1, 1) == 4.0f && ts(1, 3) == 2.0f);
+	constexpr tz::Mat4 ortho = tz::geo::orthographic(-1.0f, 1.0f, 1.0f, -1.0f, 0.0f, 2.0f);
+	static_assert(ortho(0, 0) == 1.0f && ortho(1, 1) == 1.0f);
+	// Compile-time results are identical to the runtime ones.
+	tz::Vec3 scale_factor{{2.0f, 4.0f, 8.0f}};
+	topaz_expect(test_case, tz::geo::scale(scale_factor) == s, "tz::geo::scale(...) gave a different result at runtime than during constant evaluation.");
+	topaz_expect(test_case, tz::geo::orthographic(-1.0f, 1.0f, 1.0f, -1.0f, 0.0f, 2.0f) == ortho, "tz::geo::orthographic(...) gave a different result at runtime than during constant evaluation.");
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit transform;
+	transform.add(model_batch_euler());
+	transform.add(model_batch_quaternion());
+	transform.add(model_batch_threaded());
+	transform.add(model_batch_into_pool());
+	transform.add(affine_inverse());
+	transform.add(rigid_inverse());
+	transform.add(normal_matrix());
+	transform.add(constant_evaluation());
+	return transform.result();
+}
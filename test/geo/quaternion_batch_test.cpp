@@ -0,0 +1,259 @@
+#include "test_framework.hpp"
+#include "geo/quaternion_batch.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr float pi = 3.14159265f;
+	// Not a multiple of the batch width, so the scalar tail is covered too.
+	constexpr std::size_t counts[] = {0, 1, 3, 4, 1027};
+
+	tz::Quaternion random_quaternion(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> angle{-50.0f, 50.0f};
+		return tz::Quaternion::from_eulers({{angle(rng), angle(rng), angle(rng)}});
+	}
+
+	std::vector<tz::Quaternion> random_quaternions(std::mt19937& rng, std::size_t count)
+	{
+		std::vector<tz::Quaternion> quaternions;
+		for(std::size_t i = 0; i < count; i++)
+			quaternions.push_back(random_quaternion(rng));
+		return quaternions;
+	}
+
+	// Interpolation targets, including nearly-identical pairs (which slerp treats specially) and pairs on opposite hemispheres (which must take the shorter arc).
+	std::vector<tz::Quaternion> interpolation_targets(std::mt19937& rng, const std::vector<tz::Quaternion>& from)
+	{
+		std::vector<tz::Quaternion> to;
+		for(std::size_t i = 0; i < from.size(); i++)
+		{
+			switch(i % 3)
+			{
+				case 0:
+					to.push_back(random_quaternion(rng));
+				break;
+				case 1:
+					to.push_back(from[i] * tz::Quaternion::from_axis({{{1.0f, 2.0f, 3.0f}}, 0.001f}));
+				break;
+				default:
+					to.push_back(from[i] * tz::Quaternion::from_axis({{{0.0f, 1.0f, 0.0f}}, 2.0f * pi - 0.5f}));
+				break;
+			}
+		}
+		return to;
+	}
+
+	bool roughly_equal(const tz::Quaternion& a, const tz::Quaternion& b)
+	{
+		for(std::size_t i = 0; i < 4; i++)
+		{
+			if(std::abs(a.data()[i] - b.data()[i]) > 1e-4f)
+				return false;
+		}
+		return true;
+	}
+
+	bool roughly_equal(const tz::Vec3& a, const tz::Vec3& b)
+	{
+		return (a - b).length() < 1e-4f * std::max(1.0f, b.length());
+	}
+
+	bool roughly_equal(const tz::Mat4& a, const tz::Mat4& b)
+	{
+		for(std::size_t i = 0; i < 16; i++)
+		{
+			if(std::abs(a.data()[i] - b.data()[i]) > 1e-5f)
+				return false;
+		}
+		return true;
+	}
+
+	template<typename T>
+	std::size_t count_mismatches(const std::vector<T>& actual, const std::vector<T>& expected)
+	{
+		std::size_t mismatches = 0;
+		for(std::size_t i = 0; i < actual.size(); i++)
+		{
+			if(!roughly_equal(actual[i], expected[i]))
+				mismatches++;
+		}
+		return mismatches;
+	}
+}
+
+tz::test::Case interpolation()
+{
+	tz::test::Case test_case("tz::Quaternion Interpolation Test");
+	const tz::Vec3 up{{0.0f, 1.0f, 0.0f}};
+	tz::Quaternion from = tz::Quaternion::from_axis({up, 0.0f});
+	tz::Quaternion to = tz::Quaternion::from_axis({up, pi / 2.0f});
+	topaz_expect(test_case, roughly_equal(tz::Quaternion::slerp(from, to, 0.0f), from), "tz::Quaternion::slerp(from, to, 0) != from");
+	topaz_expect(test_case, roughly_equal(tz::Quaternion::slerp(from, to, 1.0f), to), "tz::Quaternion::slerp(from, to, 1) != to");
+	// Slerp moves at a constant angular velocity.
+	topaz_expect(test_case, roughly_equal(tz::Quaternion::slerp(from, to, 0.5f), tz::Quaternion::from_axis({up, pi / 4.0f})), "tz::Quaternion::slerp(...) halfway was not a 45 degree rotation.");
+	topaz_expect(test_case, roughly_equal(tz::Quaternion::slerp(from, to, 0.25f), tz::Quaternion::from_axis({up, pi / 8.0f})), "tz::Quaternion::slerp(...) quarter-way was not a 22.5 degree rotation.");
+	// Nlerp agrees with slerp halfway, as the arc is symmetric.
+	topaz_expect(test_case, roughly_equal(tz::Quaternion::nlerp(from, to, 0.5f), tz::Quaternion::from_axis({up, pi / 4.0f})), "tz::Quaternion::nlerp(...) halfway was not a 45 degree rotation.");
+	// A 350 degree rotation is the same as -10 degrees, so halfway from the identity must be -5 degrees rather than 175.
+	tz::Quaternion far = tz::Quaternion::from_axis({up, pi * 35.0f / 18.0f});
+	tz::Quaternion expected = tz::Quaternion::from_axis({up, -pi / 36.0f});
+	topaz_expect(test_case, tz::Quaternion::slerp(from, far, 0.5f) == expected, "tz::Quaternion::slerp(...) did not take the shortest path.");
+	topaz_expect(test_case, tz::Quaternion::nlerp(from, far, 0.5f) == expected, "tz::Quaternion::nlerp(...) did not take the shortest path.");
+	return test_case;
+}
+
+tz::test::Case rotate()
+{
+	tz::test::Case test_case("tz::Quaternion Vector Rotation Test");
+	std::mt19937 rng{1};
+	std::uniform_real_distribution<float> component{-10.0f, 10.0f};
+	for(std::size_t i = 0; i < 100; i++)
+	{
+		tz::Quaternion q = random_quaternion(rng);
+		tz::Vec3 v{{component(rng), component(rng), component(rng)}};
+		tz::Vec4 expected = q.to_matrix() * tz::Vec4{{v[0], v[1], v[2], 0.0f}};
+		tz::Vec3 result = q.rotate(v);
+		topaz_expect(test_case, roughly_equal(result, {{expected[0], expected[1], expected[2]}}), "tz::Quaternion::rotate(...) did not match the rotation matrix. Expected {", expected[0], ", ", expected[1], ", ", expected[2], "}, got {", result[0], ", ", result[1], ", ", result[2], "}");
+	}
+	return test_case;
+}
+
+tz::test::Case multiply_batch()
+{
+	tz::test::Case test_case("tz::geo::multiply_batch Test");
+	std::mt19937 rng{2};
+	for(std::size_t count : counts)
+	{
+		std::vector<tz::Quaternion> lhs = random_quaternions(rng, count), rhs = random_quaternions(rng, count), out(count), expected;
+		for(std::size_t i = 0; i < count; i++)
+			expected.push_back(lhs[i] * rhs[i]);
+		tz::geo::multiply_batch({lhs.data(), count}, {rhs.data(), count}, {out.data(), count});
+		std::size_t mismatches = count_mismatches(out, expected);
+		topaz_expect(test_case, mismatches == 0, "tz::geo::multiply_batch(...) differed from tz::Quaternion::operator* for ", mismatches, " of ", count, " rotations.");
+		// The output may alias an input.
+		tz::geo::multiply_batch({lhs.data(), count}, {rhs.data(), count}, {lhs.data(), count});
+		mismatches = count_mismatches(lhs, expected);
+		topaz_expect(test_case, mismatches == 0, "tz::geo::multiply_batch(...) differed from tz::Quaternion::operator* for ", mismatches, " of ", count, " rotations when the output aliased the input.");
+	}
+	return test_case;
+}
+
+tz::test::Case normalise_batch()
+{
+	tz::test::Case test_case("tz::geo::normalise_batch Test");
+	std::mt19937 rng{3};
+	std::uniform_real_distribution<float> scale{0.1f, 10.0f};
+	for(std::size_t count : counts)
+	{
+		std::vector<tz::Quaternion> expected = random_quaternions(rng, count), quaternions;
+		for(const tz::Quaternion& q : expected)
+		{
+			tz::Quaternion scaled = q;
+			const float s = scale(rng);
+			for(std::size_t i = 0; i < 4; i++)
+				scaled.data()[i] *= s;
+			quaternions.push_back(scaled);
+		}
+		for(std::size_t i = 0; i < count; i++)
+			expected[i] = quaternions[i].normalised();
+		tz::geo::normalise_batch({quaternions.data(), count});
+		std::size_t mismatches = count_mismatches(quaternions, expected);
+		topaz_expect(test_case, mismatches == 0, "tz::geo::normalise_batch(...) differed from tz::Quaternion::normalise() for ", mismatches, " of ", count, " rotations.");
+	}
+	return test_case;
+}
+
+tz::test::Case interpolate_batch()
+{
+	tz::test::Case test_case("tz::geo::nlerp_batch/slerp_batch Test");
+	std::mt19937 rng{4};
+	std::uniform_real_distribution<float> factor{0.0f, 1.0f};
+	for(std::size_t count : counts)
+	{
+		std::vector<tz::Quaternion> from = random_quaternions(rng, count);
+		std::vector<tz::Quaternion> to = interpolation_targets(rng, from);
+		std::vector<float> t;
+		for(std::size_t i = 0; i < count; i++)
+			t.push_back(factor(rng));
+		std::vector<tz::Quaternion> out(count), expected_nlerp, expected_slerp, expected_uniform_nlerp, expected_uniform_slerp;
+		for(std::size_t i = 0; i < count; i++)
+		{
+			expected_nlerp.push_back(tz::Quaternion::nlerp(from[i], to[i], t[i]));
+			expected_slerp.push_back(tz::Quaternion::slerp(from[i], to[i], t[i]));
+			expected_uniform_nlerp.push_back(tz::Quaternion::nlerp(from[i], to[i], 0.3f));
+			expected_uniform_slerp.push_back(tz::Quaternion::slerp(from[i], to[i], 0.3f));
+		}
+
+		tz::geo::nlerp_batch({from.data(), count}, {to.data(), count}, {t.data(), count}, {out.data(), count});
+		std::size_t mismatches = count_mismatches(out, expected_nlerp);
+		topaz_expect(test_case, mismatches == 0, "tz::geo::nlerp_batch(...) differed from tz::Quaternion::nlerp(...) for ", mismatches, " of ", count, " rotations.");
+		tz::geo::slerp_batch({from.data(), count}, {to.data(), count}, {t.data(), count}, {out.data(), count});
+		mismatches = count_mismatches(out, expected_slerp);
+		topaz_expect(test_case, mismatches == 0, "tz::geo::slerp_batch(...) differed from tz::Quaternion::slerp(...) for ", mismatches, " of ", count, " rotations.");
+		tz::geo::nlerp_batch({from.data(), count}, {to.data(), count}, 0.3f, {out.data(), count});
+		mismatches = count_mismatches(out, expected_uniform_nlerp);
+		topaz_expect(test_case, mismatches == 0, "tz::geo::nlerp_batch(...) with a uniform factor differed from tz::Quaternion::nlerp(...) for ", mismatches, " of ", count, " rotations.");
+		tz::geo::slerp_batch({from.data(), count}, {to.data(), count}, 0.3f, {out.data(), count});
+		mismatches = count_mismatches(out, expected_uniform_slerp);
+		topaz_expect(test_case, mismatches == 0, "tz::geo::slerp_batch(...) with a uniform factor differed from tz::Quaternion::slerp(...) for ", mismatches, " of ", count, " rotations.");
+	}
+	return test_case;
+}
+
+tz::test::Case rotate_batch()
+{
+	tz::test::Case test_case("tz::geo::rotate_batch Test");
+	std::mt19937 rng{5};
+	std::uniform_real_distribution<float> component{-100.0f, 100.0f};
+	for(std::size_t count : counts)
+	{
+		std::vector<tz::Quaternion> rotations = random_quaternions(rng, count);
+		std::vector<tz::Vec3> vectors, out(count), expected;
+		for(std::size_t i = 0; i < count; i++)
+		{
+			vectors.push_back({{component(rng), component(rng), component(rng)}});
+			expected.push_back(rotations[i].rotate(vectors[i]));
+		}
+		tz::geo::rotate_batch({rotations.data(), count}, {vectors.data(), count}, {out.data(), count});
+		std::size_t mismatches = count_mismatches(out, expected);
+		topaz_expect(test_case, mismatches == 0, "tz::geo::rotate_batch(...) differed from tz::Quaternion::rotate(...) for ", mismatches, " of ", count, " vectors.");
+		// Rotating in-place.
+		tz::geo::rotate_batch({rotations.data(), count}, {vectors.data(), count}, {vectors.data(), count});
+		mismatches = count_mismatches(vectors, expected);
+		topaz_expect(test_case, mismatches == 0, "tz::geo::rotate_batch(...) differed from tz::Quaternion::rotate(...) for ", mismatches, " of ", count, " vectors when rotating in-place.");
+	}
+	return test_case;
+}
+
+tz::test::Case to_matrix_batch()
+{
+	tz::test::Case test_case("tz::geo::to_matrix_batch Test");
+	std::mt19937 rng{6};
+	for(std::size_t count : counts)
+	{
+		std::vector<tz::Quaternion> rotations = random_quaternions(rng, count);
+		std::vector<tz::Mat4> out(count), expected;
+		for(const tz::Quaternion& rotation : rotations)
+			expected.push_back(rotation.to_matrix());
+		tz::geo::to_matrix_batch({rotations.data(), count}, {out.data(), count});
+		std::size_t mismatches = count_mismatches(out, expected);
+		topaz_expect(test_case, mismatches == 0, "tz::geo::to_matrix_batch(...) differed from tz::Quaternion::to_matrix() for ", mismatches, " of ", count, " rotations.");
+	}
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit quat;
+	quat.add(interpolation());
+	quat.add(rotate());
+	quat.add(multiply_batch());
+	quat.add(normalise_batch());
+	quat.add(interpolate_batch());
+	quat.add(rotate_batch());
+	quat.add(to_matrix_batch());
+	return quat.result();
+}
@@ -62,6 +62,74 @@ tz::test::Case cross()
 	return test_case;
 }
 
+tz::Vec3 make_vec3(float x, float y, float z)
+{
+	return {{x, y, z}};
+}
+
+tz::test::Case expressions()
+{
+	tz::test::Case test_case("tz::geo::Vec3 Expression Tests");
+	tz::Vec3 a(3.0f, 6.0f, 9.0f);
+	tz::Vec3 b(1.0f, 2.0f, 3.0f);
+	tz::Vec3 c(2.0f, 1.0f, 0.0f);
+	// Chained operations are fused into a single pass when the result is constructed.
+	tz::Vec3 centroid = (a + b + c) / 3.0f;
+	topaz_expect(test_case, centroid == tz::Vec3(2.0f, 3.0f, 4.0f), "tz::Vec3 centroid expression yielded unexpected value {", centroid[0], ", ", centroid[1], ", ", centroid[2], "}");
+	tz::Vec3 mixed = a - b * 2.0f + c;
+	topaz_expect(test_case, mixed == tz::Vec3(3.0f, 3.0f, 3.0f), "tz::Vec3 mixed expression yielded unexpected value {", mixed[0], ", ", mixed[1], ", ", mixed[2], "}");
+
+	// Member functions of tz::Vector are still usable directly upon an expression.
+	topaz_expect(test_case, (a - b).length() == tz::Vec3(2.0f, 4.0f, 6.0f).length(), "tz::Vec3 expression length() yielded unexpected value ", (a - b).length());
+	topaz_expect(test_case, (a + b).dot(c) == 16.0f, "tz::Vec3 expression dot() yielded unexpected value ", (a + b).dot(c));
+	topaz_expect(test_case, (a + b)[2] == 12.0f, "tz::Vec3 expression operator[] yielded unexpected value ", (a + b)[2]);
+	topaz_expect(test_case, a - b == tz::Vec3(2.0f, 4.0f, 6.0f), "tz::Vec3 expression operator== yielded false for equal values");
+
+	// Named vectors are held by reference, temporaries by value so that an expression built from them can safely outlive the full-expression.
+	static_assert(std::is_same_v<decltype(a + b), tz::detail::Elementwise<tz::Vec3, std::plus<>, const tz::Vec3&, const tz::Vec3&>>);
+	static_assert(std::is_same_v<decltype(make_vec3(0.0f, 0.0f, 0.0f) * 2.0f), tz::detail::Elementwise<tz::Vec3, std::multiplies<>, tz::Vec3, float>>);
+	auto owning = make_vec3(1.0f, 1.0f, 1.0f) + make_vec3(2.0f, 2.0f, 2.0f);
+	tz::Vec3 evaluated = owning;
+	topaz_expect(test_case, evaluated == tz::Vec3(3.0f, 3.0f, 3.0f), "tz::Vec3 expression built from temporaries yielded unexpected value {", evaluated[0], ", ", evaluated[1], ", ", evaluated[2], "}");
+
+	// Compound assignment accepts expressions too.
+	tz::Vec3 accumulated = a;
+	accumulated += b * 2.0f;
+	topaz_expect(test_case, accumulated == tz::Vec3(5.0f, 10.0f, 15.0f), "tz::Vec3 compound assignment of an expression yielded unexpected value {", accumulated[0], ", ", accumulated[1], ", ", accumulated[2], "}");
+	return test_case;
+}
+
+tz::test::Case constant_evaluation()
+{
+	tz::test::Case test_case("tz::geo::Vector Constant Evaluation Tests");
+	constexpr tz::Vec3 a{{1.0f, 2.0f, 3.0f}};
+	constexpr tz::Vec3 b{{4.0f, 5.0f, 6.0f}};
+	static_assert(a[0] == 1.0f && a[2] == 3.0f);
+	constexpr tz::Vec3 sum = a + b;
+	static_assert(sum == tz::Vec3{{5.0f, 7.0f, 9.0f}});
+	constexpr tz::Vec3 centroid = (a + b + tz::Vec3{{1.0f, 2.0f, 3.0f}}) / 3.0f;
+	static_assert(centroid == tz::Vec3{{2.0f, 3.0f, 4.0f}});
+	static_assert(a.dot(b) == 32.0f);
+	static_assert((b - a).dot(a) == 18.0f);
+	static_assert(tz::cross(a, b) == tz::Vec3{{-3.0f, 6.0f, -3.0f}});
+	// Vec4 dot uses a SIMD kernel at runtime, but must still work during constant evaluation.
+	constexpr tz::Vec4 c{{1.0f, 2.0f, 3.0f, 4.0f}};
+	static_assert(c.dot(c) == 30.0f);
+	constexpr tz::Vec4 d = []()
+	{
+		tz::Vec4 v{{1.0f, 1.0f, 1.0f, 1.0f}};
+		v *= 4.0f;
+		v -= tz::Vec4{{1.0f, 2.0f, 3.0f, 4.0f}};
+		v[3] = 10.0f;
+		return v;
+	}();
+	static_assert(d == tz::Vec4{{3.0f, 2.0f, 1.0f, 10.0f}});
+	// The same functions give the same answers at runtime.
+	tz::Vec4 runtime_c = c;
+	topaz_expect(test_case, runtime_c.dot(runtime_c) == c.dot(c), "tz::Vec4::dot(...) gave a different result at runtime than during constant evaluation.");
+	return test_case;
+}
+
 int main()
 {
 	tz::test::Unit vec;
@@ -69,6 +137,8 @@ int main()
 	vec.add(addition_subtraction());
 	vec.add(dot());
 	vec.add(cross());
+	vec.add(expressions());
+	vec.add(constant_evaluation());
 
 	return vec.result();
 }
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "test_framework.hpp"
+#include "core/core.hpp"
+#include "gl/buffer_heap.hpp"
+
+tz::gl::IndexedMesh triangle()
+{
+	tz::gl::IndexedMesh tri;
+	tri.vertices.push_back(tz::gl::Vertex{{{-0.5f, -0.5f, 0.0f}}, {{0.0f, 0.0f}}, {{}}, {{}}, {{}}});
+	tri.vertices.push_back(tz::gl::Vertex{{{0.5f, -0.5f, 0.0f}}, {{1.0f, 0.0f}}, {{}}, {{}}, {{}}});
+	tri.vertices.push_back(tz::gl::Vertex{{{0.5f, 0.5f, 0.0f}}, {{1.0f, 0.5f}}, {{}}, {{}}, {{}}});
+	tri.indices = {0, 1, 2};
+	return tri;
+}
+
+tz::test::Case allocation()
+{
+	tz::test::Case test_case("tz::gl::BufferHeap Allocation Tests");
+	tz::gl::BufferHeap heap{9, 9};
+	tz::gl::BufferHeap::Handle a = heap.add_mesh(triangle()).value();
+	tz::gl::BufferHeap::Handle b = heap.add_mesh(triangle()).value();
+	tz::gl::BufferHeap::Handle c = heap.add_mesh(triangle()).value();
+	topaz_expect(test_case, heap.get_vertices_offset(b) == 3 && heap.get_indices_offset(b) == 3, "tz::gl::BufferHeap gave unexpected offsets for the second mesh. Vertices: ", heap.get_vertices_offset(b), ", Indices: ", heap.get_indices_offset(b));
+	topaz_expect(test_case, heap.get_number_of_vertices(c) == 3 && heap.get_number_of_indices(c) == 3, "tz::gl::BufferHeap had unexpected mesh size.");
+	topaz_expect(test_case, !heap.add_mesh(triangle()).has_value(), "tz::gl::BufferHeap accepted a mesh while full.");
+
+	// Removing a mesh frees up its space for another.
+	heap.remove_mesh(b);
+	tz::gl::BufferHeap::Handle d = heap.add_mesh(triangle()).value();
+	topaz_expect(test_case, heap.get_vertices_offset(d) == 3, "tz::gl::BufferHeap didn't re-use the space of a removed mesh.");
+
+	// The data should've actually made it into the buffer.
+	tz::gl::Index idx[3];
+	(*heap).get<tz::gl::BufferType::Index>(heap.get_indices())->retrieve(heap.get_indices_offset(d) * sizeof(tz::gl::Index), sizeof(idx), idx);
+	topaz_expect(test_case, idx[0] == 0 && idx[1] == 1 && idx[2] == 2, "tz::gl::BufferHeap index data was not written to the index-buffer.");
+
+	heap.remove_mesh(a);
+	heap.remove_mesh(c);
+	heap.remove_mesh(d);
+	topaz_expect(test_case, heap.vertex_stats().free_region_count == 1 && heap.index_stats().largest_free_region == 9, "tz::gl::BufferHeap didn't coalesce back into a single region after removing every mesh.");
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit buffer_heap;
+
+	// We require topaz to be initialised.
+	{
+		tz::core::initialise("BufferHeap Tests");
+		buffer_heap.add(allocation());
+		tz::core::terminate();
+	}
+	return buffer_heap.result();
+}
@@ -6,6 +6,7 @@
 #include "core/core.hpp"
 #include "core/tz_glad/glad_context.hpp"
 #include "gl/object.hpp"
+#include "memory/tracking.hpp"
 #include "algo/static.hpp"
 
 template<tz::gl::BufferType Type>
@@ -59,6 +60,13 @@ tz::test::Case mapping()
 	topaz_expect(test_case, glGetError() == 0, "glGetError() displayed an error!");
 	topaz_expect(test_case, buf->empty(), "tz::gl::IBuffer constructed in object is not empty!");
 	topaz_expect_assert(test_case, false, "tz::gl::IBuffer asserted at the wrong time (Probably from Buffer<T>::size())...");
+	// Mapping an empty buffer needn't map anything, but must still pair with an unmap.
+	{
+		tz::mem::Block mapping = buf->map();
+		topaz_expect(test_case, mapping.size() == 0, "tz::gl::IBuffer mapping of an empty buffer had unexpected size. Expected 0, but got ", mapping.size());
+		buf->unmap();
+		topaz_expect(test_case, !buf->is_mapped(), "tz::gl::IBuffer was still mapped after unmapping an empty buffer");
+	}
 	constexpr std::size_t amt = 5;
 
 	// Now lets allocate some data in it.
@@ -94,6 +102,47 @@ tz::test::Case mapping()
 	return test_case;
 }
 
+tz::test::Case range_mapping()
+{
+	tz::test::Case test_case("tz::gl::Buffer Range Mapping Tests");
+	constexpr std::size_t amt = 8;
+	tz::gl::VertexBuffer first;
+	tz::gl::IndexBuffer second;
+	first.resize(sizeof(float) * amt);
+	second.resize(sizeof(float) * amt);
+	{
+		std::vector<float> zeroes(amt, 0.0f);
+		first.send(zeroes.data());
+		second.send(zeroes.data());
+	}
+	// Map the middle of one buffer while the whole of another is mapped.
+	tz::mem::Block whole = second.map();
+	tz::mem::Block range = first.map_range(sizeof(float) * 2, sizeof(float) * 4, tz::gl::MappingFlag::InvalidateRange | tz::gl::MappingFlag::FlushExplicit);
+	topaz_expect(test_case, first.is_mapped() && second.is_mapped(), "tz::gl::Buffer mappings were not independent of one another");
+	topaz_expect(test_case, range.size() == sizeof(float) * 4, "tz::gl::Buffer::map_range gave a block of unexpected size. Expected ", sizeof(float) * 4, ", got ", range.size());
+	// Mapping the whole buffer a second time is fine, and gives the cached block.
+	topaz_expect(test_case, second.map().begin == whole.begin, "tz::gl::Buffer::map did not return the cached mapping");
+	for(std::size_t i = 0; i < 4; i++)
+	{
+		reinterpret_cast<float*>(range.begin)[i] = static_cast<float>(i + 1);
+	}
+	reinterpret_cast<float*>(whole.begin)[0] = 5.0f;
+	// Only the first two floats are flushed.
+	first.flush_range(0, sizeof(float) * 2);
+	first.unmap();
+	second.unmap();
+	topaz_expect_assert(test_case, false, "Unexpected assert invoked while testing tz::gl::Buffer range mapping.");
+	std::vector<float> first_data(amt);
+	first.retrieve_all(first_data.data());
+	topaz_expect(test_case, first_data[0] == 0.0f && first_data[1] == 0.0f, "tz::gl::Buffer::map_range modified data before the mapped range");
+	topaz_expect(test_case, first_data[2] == 1.0f && first_data[3] == 2.0f, "tz::gl::Buffer::flush_range did not send the flushed subrange to the data-store");
+	topaz_expect(test_case, first_data[6] == 0.0f && first_data[7] == 0.0f, "tz::gl::Buffer::map_range modified data after the mapped range");
+	float second_first;
+	second.retrieve(0, sizeof(float), &second_first);
+	topaz_expect(test_case, second_first == 5.0f, "tz::gl::Buffer mapped concurrently with another did not receive its edits");
+	return test_case;
+}
+
 tz::test::Case terminality()
 {
 	tz::test::Case test_case("tz::gl Buffer Terminality Tests");
@@ -311,6 +360,115 @@ tz::test::Case sending()
 	return test_case;
 }
 
+tz::test::Case tracked_state()
+{
+	tz::test::Case test_case("tz::gl::Buffer Tracked State Tests");
+	// Query the driver directly, which the buffer no longer does. The buffer must be the bound vertex buffer.
+	auto driver_param = [](GLenum param)
+	{
+		GLint value;
+		glGetNamedBufferParameteriv(tz::gl::bound::vertex_buffer(), param, &value);
+		return value;
+	};
+	auto matches_driver = [&driver_param](const tz::gl::IBuffer& buffer)
+	{
+		const bool size_matches = static_cast<std::size_t>(driver_param(GL_BUFFER_SIZE)) == buffer.capacity() && buffer.size() <= buffer.capacity();
+		const bool terminal_matches = (driver_param(GL_BUFFER_IMMUTABLE_STORAGE) != GL_FALSE) == buffer.is_terminal();
+		const bool mapped_matches = (driver_param(GL_BUFFER_MAPPED) != GL_FALSE) == buffer.is_mapped();
+		return size_matches && terminal_matches && mapped_matches;
+	};
+	tz::gl::Object o;
+	std::size_t idx = o.emplace_buffer<tz::gl::BufferType::Array>();
+	tz::gl::IBuffer* buf = o[idx];
+	buf->bind();
+	topaz_expect(test_case, matches_driver(*buf), "tz::gl::IBuffer tracked state did not match the driver after construction");
+	buf->resize(64);
+	topaz_expect(test_case, matches_driver(*buf), "tz::gl::IBuffer tracked state did not match the driver after resize");
+	buf->safe_resize(128);
+	topaz_expect(test_case, matches_driver(*buf), "tz::gl::IBuffer tracked state did not match the driver after safe_resize");
+	buf->map();
+	topaz_expect(test_case, matches_driver(*buf), "tz::gl::IBuffer tracked state did not match the driver after map");
+	buf->unmap();
+	topaz_expect(test_case, matches_driver(*buf), "tz::gl::IBuffer tracked state did not match the driver after unmap");
+	buf->make_terminal();
+	topaz_expect(test_case, matches_driver(*buf) && buf->size() == 128, "tz::gl::IBuffer tracked state did not match the driver after make_terminal");
+	buf->map();
+	topaz_expect(test_case, matches_driver(*buf), "tz::gl::IBuffer tracked state did not match the driver after mapping a terminal buffer");
+	buf->unmap();
+
+	// Moving a buffer moves its state with it.
+	tz::gl::VertexBuffer terminal;
+	terminal.bind();
+	terminal.terminal_resize(32);
+	topaz_expect(test_case, matches_driver(terminal), "tz::gl::IBuffer tracked state did not match the driver after terminal_resize");
+	tz::gl::VertexBuffer moved;
+	moved = std::move(terminal);
+	moved.bind();
+	topaz_expect(test_case, matches_driver(moved) && moved.size() == 32 && moved.is_terminal(), "tz::gl::IBuffer tracked state did not follow a move");
+	moved.unbind();
+	topaz_expect_assert(test_case, false, "Unexpected assert invoked while testing tz::gl::Buffer tracked state.");
+	return test_case;
+}
+
+tz::test::Case growth()
+{
+	tz::test::Case test_case("tz::gl::Buffer Growth Tests");
+	const std::size_t gl_bytes_before = tz::mem::tracking::get(tz::mem::tracking::Tag::GL).current_bytes;
+	tz::gl::VertexBuffer buf;
+	buf.bind();
+	// Append one int at a time, as tz::gl::Manager does with meshes.
+	constexpr std::size_t append_count = 1000;
+	std::size_t reallocations = 0;
+	for(std::size_t i = 0; i < append_count; i++)
+	{
+		const std::size_t old_capacity = buf.capacity();
+		buf.safe_resize(buf.size() + sizeof(int));
+		if(buf.capacity() != old_capacity)
+			reallocations++;
+		int value = static_cast<int>(i);
+		buf.send(i * sizeof(int), {&value, sizeof(int)});
+	}
+	topaz_expect(test_case, buf.size() == append_count * sizeof(int), "tz::gl::Buffer had unexpected size after appending. Expected ", append_count * sizeof(int), ", got ", buf.size());
+	topaz_expect(test_case, buf.capacity() >= buf.size(), "tz::gl::Buffer had a capacity (", buf.capacity(), ") smaller than its size (", buf.size(), ")");
+	// Geometric growth: 1000 appends only need about log2(1000) reallocations.
+	topaz_expect(test_case, reallocations <= 11, "tz::gl::Buffer reallocated ", reallocations, " times while appending ", append_count, " times. Growth is not geometric");
+	std::vector<int> retrieved(append_count);
+	buf.retrieve_all(retrieved.data());
+	bool preserved = true;
+	for(std::size_t i = 0; i < append_count; i++)
+	{
+		preserved = preserved && retrieved[i] == static_cast<int>(i);
+	}
+	topaz_expect(test_case, preserved, "tz::gl::Buffer did not preserve its data while growing");
+
+	// Shrinking keeps the capacity, so growing back doesn't reallocate.
+	const std::size_t full_capacity = buf.capacity();
+	buf.safe_resize(sizeof(int));
+	topaz_expect(test_case, buf.size() == sizeof(int) && buf.capacity() == full_capacity, "tz::gl::Buffer changed its capacity when shrinking via safe_resize");
+	buf.safe_resize(full_capacity);
+	topaz_expect(test_case, buf.capacity() == full_capacity, "tz::gl::Buffer reallocated when growing within its capacity");
+	int first;
+	buf.retrieve(0, sizeof(int), &first);
+	topaz_expect(test_case, first == 0, "tz::gl::Buffer lost data when resizing within its capacity");
+
+	// Reserving grows the capacity without changing the size or the data.
+	buf.reserve(full_capacity * 4);
+	topaz_expect(test_case, buf.capacity() == full_capacity * 4 && buf.size() == full_capacity, "tz::gl::Buffer::reserve did not grow the capacity alone");
+	buf.retrieve(0, sizeof(int), &first);
+	topaz_expect(test_case, first == 0, "tz::gl::Buffer::reserve did not preserve the data");
+	// A plain resize reallocates exactly.
+	buf.resize(8);
+	topaz_expect(test_case, buf.size() == 8 && buf.capacity() == 8, "tz::gl::Buffer::resize did not reallocate to exactly the requested size");
+	if constexpr(tz::mem::tracking::enabled)
+	{
+		const std::size_t gl_bytes = tz::mem::tracking::get(tz::mem::tracking::Tag::GL).current_bytes;
+		topaz_expect(test_case, gl_bytes == gl_bytes_before + 8, "tz::mem::tracking did not account the data-store of a tz::gl::Buffer. Expected ", gl_bytes_before + 8, " bytes, got ", gl_bytes);
+	}
+	buf.unbind();
+	topaz_expect_assert(test_case, false, "Unexpected assert invoked while testing tz::gl::Buffer growth.");
+	return test_case;
+}
+
 int main()
 {
 	tz::test::Unit buffer;
@@ -322,11 +480,14 @@ int main()
 		buffer.add(statics());
 		buffer.add(binding());
 		buffer.add(mapping());
+		buffer.add(range_mapping());
 		buffer.add(terminality());
 		buffer.add(retrieval());
 		buffer.add(nonterminal_retrieval());
 		buffer.add(terminal_retrieval());
 		buffer.add(sending());
+		buffer.add(tracked_state());
+		buffer.add(growth());
 
 		tz::core::terminate();
 	}
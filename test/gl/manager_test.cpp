@@ -6,6 +6,7 @@
 #include "core/core.hpp"
 #include "core/tz_glad/glad_context.hpp"
 #include "gl/manager.hpp"
+#include <cmath>
 
 tz::gl::IndexedMesh square()
 {
@@ -62,6 +63,38 @@ tz::test::Case split()
 	return test_case;
 }
 
+tz::test::Case bounds()
+{
+	tz::test::Case test_case("tz::gl::Manager Bounds Tests");
+	tz::gl::Manager m;
+
+	tz::gl::Manager::Handle sq = m.add_mesh(square());
+	{
+		const tz::geo::AABB& box = m.get_bounds(sq).box;
+		const tz::geo::AABB expected{{{-0.5f, -0.5f, 0.0f}}, {{0.5f, 0.5f, 0.0f}}};
+		topaz_expect(test_case, box.min == expected.min && box.max == expected.max, "Square had unexpected bounding box.");
+		const float radius = m.get_bounds(sq).sphere.radius;
+		topaz_expect(test_case, std::abs(radius - std::sqrt(0.5f)) < 0.0001f, "Square had unexpected bounding sphere radius. Expected ", std::sqrt(0.5f), ", got ", radius);
+	}
+	// Each daughter owns a different edge or diagonal of the square, so must have its own bounds.
+	std::vector<tz::gl::Manager::Handle> handles = m.split(sq, 2);
+	const float expected_min_y[] = {-0.5f, -0.5f, 0.5f};
+	const float expected_max_y[] = {-0.5f, 0.5f, 0.5f};
+	for(std::size_t i = 0; i < handles.size(); i++)
+	{
+		const tz::geo::AABB& box = m.get_bounds(handles[i]).box;
+		topaz_expect(test_case, box.min[1] == expected_min_y[i] && box.max[1] == expected_max_y[i], "Daughter ", i, " had unexpected bounding box. Expected y range ", expected_min_y[i], " to ", expected_max_y[i], ", got ", box.min[1], " to ", box.max[1]);
+		// Every vertex owned by the daughter must be within both volumes.
+		for(std::size_t j = 0; j < 2; j++)
+		{
+			const tz::Vec3 position = square().vertices[(i * 2) + j].position;
+			topaz_expect(test_case, box.contains(position), "Daughter ", i, " bounding box does not contain its vertex ", j);
+			topaz_expect(test_case, m.get_bounds(handles[i]).sphere.contains(position), "Daughter ", i, " bounding sphere does not contain its vertex ", j);
+		}
+	}
+	return test_case;
+}
+
 int main()
 {
 	tz::test::Unit manager;
@@ -71,6 +104,7 @@ int main()
 		tz::core::initialise("Manager Tests");
 		manager.add(partition());
 		manager.add(split());
+		manager.add(bounds());
 		tz::core::terminate();
 	}
 	return manager.result();
@@ -0,0 +1,70 @@
+#include "test_framework.hpp"
+#include "gl/mesh_bvh.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	// Unit cube centred on the origin. Two triangles per face, faces ordered -x, +x, -y, +y, -z, +z.
+	tz::gl::IndexedMesh cube()
+	{
+		tz::gl::IndexedMesh mesh;
+		for(std::size_t axis = 0; axis < 3; axis++)
+		{
+			for(float side : {-0.5f, 0.5f})
+			{
+				const std::size_t u = (axis + 1) % 3;
+				const std::size_t v = (axis + 2) % 3;
+				const tz::gl::Index first = static_cast<tz::gl::Index>(mesh.vertices.size());
+				for(float corner_u : {-0.5f, 0.5f})
+				{
+					for(float corner_v : {-0.5f, 0.5f})
+					{
+						tz::gl::Vertex vertex{{{0.0f, 0.0f, 0.0f}}, {{0.0f, 0.0f}}};
+						vertex.position[axis] = side;
+						vertex.position[u] = corner_u;
+						vertex.position[v] = corner_v;
+						mesh.vertices.push_back(vertex);
+					}
+				}
+				for(tz::gl::Index index : {0u, 1u, 2u, 1u, 3u, 2u})
+					mesh.indices.push_back(first + index);
+			}
+		}
+		return mesh;
+	}
+}
+
+tz::test::Case mesh_queries()
+{
+	tz::test::Case test_case("tz::gl::MeshBVH Query Tests");
+	const tz::gl::MeshBVH bvh{cube()};
+	topaz_expect(test_case, bvh.get_number_of_triangles() == 12, "Cube should have ", 12, " triangles, but the BVH has ", bvh.get_number_of_triangles());
+	// Fire at the +z face (triangles 10 and 11) from in front of it.
+	const tz::geo::Ray ray{{{0.1f, 0.2f, 5.0f}}, {{0.0f, 0.0f, -1.0f}}};
+	const std::optional<tz::geo::RayHit> hit = bvh.closest_hit(ray, 100.0f);
+	topaz_expect(test_case, hit.has_value(), "Ray towards the cube should hit it");
+	if(hit.has_value())
+	{
+		topaz_expect(test_case, std::abs(hit->distance - 4.5f) < 0.0001f, "Ray should hit the cube at distance ", 4.5f, ", but hit at ", hit->distance);
+		topaz_expect(test_case, hit->primitive == 10 || hit->primitive == 11, "Ray should hit the +z face, but hit triangle ", hit->primitive);
+	}
+	topaz_expect(test_case, bvh.raycast(ray, 100.0f), "Ray towards the cube should hit it");
+	topaz_expect(test_case, !bvh.raycast(ray, 4.0f), "Ray should not reach the cube within a distance of 4");
+	const tz::geo::Ray miss{{{2.0f, 0.0f, 5.0f}}, {{0.0f, 0.0f, -1.0f}}};
+	topaz_expect(test_case, !bvh.raycast(miss, 100.0f) && !bvh.closest_hit(miss, 100.0f).has_value(), "Ray beside the cube should miss it");
+	// A thin slab through the middle of the +x face only overlaps the boxes of that face's triangles.
+	const tz::geo::AABB slab{{{0.45f, -0.1f, -0.1f}}, {{0.6f, 0.1f, 0.1f}}};
+	std::vector<std::size_t> overlapping = bvh.overlap(slab);
+	std::sort(overlapping.begin(), overlapping.end());
+	const std::vector<std::size_t> expected{2, 3};
+	topaz_expect(test_case, overlapping == expected, "Slab should overlap the boxes of the +x face's triangles only, but overlapped ", overlapping.size(), " triangles");
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit mesh_bvh;
+	mesh_bvh.add(mesh_queries());
+	return mesh_bvh.result();
+}
@@ -0,0 +1,124 @@
+#include "test_framework.hpp"
+#include "gl/mesh.hpp"
+#include "algo/job_system.hpp"
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+namespace
+{
+	tz::gl::IndexedMesh random_mesh(std::size_t triangle_count)
+	{
+		std::mt19937 rng{static_cast<std::mt19937::result_type>(triangle_count)};
+		std::uniform_real_distribution<float> coordinate{-100.0f, 100.0f};
+		std::uniform_int_distribution<tz::gl::Index> index{0, static_cast<tz::gl::Index>(triangle_count)};
+		tz::gl::IndexedMesh mesh;
+		for(std::size_t i = 0; i <= triangle_count; i++)
+		{
+			mesh.vertices.push_back({{{coordinate(rng), coordinate(rng), coordinate(rng)}}, {{0.0f, 0.0f}}});
+		}
+		for(std::size_t i = 0; i < triangle_count * 3; i++)
+		{
+			mesh.indices.push_back(index(rng));
+		}
+		return mesh;
+	}
+
+	float centroid_distance(const tz::gl::IndexedMesh& mesh, std::size_t triangle, tz::Vec3 point)
+	{
+		const tz::Vec3 centroid = (mesh.vertices[mesh.indices[triangle * 3]].position + mesh.vertices[mesh.indices[(triangle * 3) + 1]].position + mesh.vertices[mesh.indices[(triangle * 3) + 2]].position) / 3.0f;
+		return (point - centroid).length();
+	}
+
+	bool sorted_by_distance(const tz::gl::IndexedMesh& mesh, tz::Vec3 point)
+	{
+		// Keys are computed differently to this, so allow for rounding between nearly-equidistant triangles.
+		for(std::size_t i = 1; i < mesh.indices.size() / 3; i++)
+		{
+			if(centroid_distance(mesh, i - 1, point) > centroid_distance(mesh, i, point) * 1.0001f)
+				return false;
+		}
+		return true;
+	}
+
+	/// Every triangle in a canonical order, so that two meshes can be compared as multisets of triangles.
+	std::vector<std::array<tz::gl::Index, 3>> triangles(const tz::gl::IndexedMesh& mesh)
+	{
+		std::vector<std::array<tz::gl::Index, 3>> result;
+		for(std::size_t i = 0; i < mesh.indices.size(); i += 3)
+		{
+			result.push_back({mesh.indices[i], mesh.indices[i + 1], mesh.indices[i + 2]});
+		}
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+}
+
+tz::test::Case sort()
+{
+	tz::test::Case test_case("tz::gl::sort_indices Tests");
+	const tz::Vec3 camera{{10.0f, -20.0f, 5.0f}};
+	// Covers the comparison sort used for tiny meshes as well as the radix sort.
+	for(std::size_t triangle_count : {0, 1, 2, 50, 5000})
+	{
+		tz::gl::IndexedMesh mesh = random_mesh(triangle_count);
+		const auto before = triangles(mesh);
+		tz::gl::sort_indices(mesh, camera);
+		topaz_expect(test_case, sorted_by_distance(mesh, camera), "sort_indices did not sort ", triangle_count, " triangles by distance");
+		topaz_expect(test_case, triangles(mesh) == before, "sort_indices did not preserve the triangles of a mesh with ", triangle_count, " triangles");
+	}
+	// Indices which don't form a whole triangle are left alone at the end.
+	tz::gl::IndexedMesh partial = random_mesh(100);
+	partial.indices.push_back(7);
+	tz::gl::sort_indices(partial, camera);
+	topaz_expect(test_case, partial.indices.back() == 7, "sort_indices moved an index which wasn't part of a triangle");
+	return test_case;
+}
+
+tz::test::Case resort()
+{
+	tz::test::Case test_case("tz::gl::resort_indices Tests");
+	tz::gl::IndexedMesh mesh = random_mesh(5000);
+	const auto before = triangles(mesh);
+	// The first resort sees a shuffled mesh so must fall back to a full sort. After that, the camera only moves slightly.
+	tz::Vec3 camera{{0.0f, 0.0f, 0.0f}};
+	for(std::size_t frame = 0; frame < 20; frame++)
+	{
+		camera[0] += 0.5f;
+		camera[2] -= 0.25f;
+		tz::gl::resort_indices(mesh, camera);
+		topaz_expect(test_case, sorted_by_distance(mesh, camera), "resort_indices did not sort the mesh by distance on frame ", frame);
+	}
+	// A big jump is no longer coherent.
+	camera[1] += 150.0f;
+	tz::gl::resort_indices(mesh, camera);
+	topaz_expect(test_case, sorted_by_distance(mesh, camera), "resort_indices did not sort the mesh after the camera jumped");
+	topaz_expect(test_case, triangles(mesh) == before, "resort_indices did not preserve the triangles of the mesh");
+	return test_case;
+}
+
+tz::test::Case parallel()
+{
+	tz::test::Case test_case("tz::gl::sort_indices Parallel Tests");
+	tz::algo::JobSystem job_system{3};
+	const tz::Vec3 camera{{-5.0f, 2.0f, 40.0f}};
+	// Large enough to be split across the workers. The radix sort is stable, so the result must be identical to sorting on one thread.
+	tz::gl::IndexedMesh serial = random_mesh(100000);
+	tz::gl::IndexedMesh parallel = serial;
+	tz::gl::sort_indices(serial, camera);
+	tz::gl::sort_indices(parallel, camera, &job_system);
+	topaz_expect(test_case, serial.indices == parallel.indices, "Sorting across a JobSystem gave a different order to sorting on one thread");
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit mesh;
+
+	mesh.add(sort());
+	mesh.add(resort());
+	mesh.add(parallel());
+
+	return mesh.result();
+}
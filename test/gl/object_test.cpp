@@ -100,6 +100,22 @@ tz::test::Case set()
 	o.set<tz::gl::BufferType::Array>(c);
 	// We can't do much here but assert that the damn thing hasn't become nullptr.
 	topaz_expect(test_case, o[c] != nullptr, "tz::gl::Object set invocation seems to have damaged the Buffer at index ", c);
+	// Erased handles are stale, so set cannot bring them back.
+	o.erase(c);
+	topaz_expect_assert(test_case, false, "tz::gl::Object asserted unexpectedly while testing set.");
+	o.set<tz::gl::BufferType::Array>(c);
+	topaz_expect_assert(test_case, true, "tz::gl::Object set did not assert on an erased handle.");
+	topaz_assert_clear();
+	topaz_expect(test_case, o[c] == nullptr, "tz::gl::Object set revived the erased handle ", c);
+	// Re-using the slot gives a new handle, which handle_at must report instead of the slot index.
+	auto d = make_child();
+	bool found = false;
+	for(std::size_t i = 0; i < o.element_size(); i++)
+	{
+		topaz_expect(test_case, o[o.handle_at(i)] != nullptr, "tz::gl::Object::handle_at(", i, ") gave a handle to no buffer");
+		found = found || o.handle_at(i) == d;
+	}
+	topaz_expect(test_case, found, "tz::gl::Object::handle_at never gave the handle ", d, " of a buffer in a re-used slot");
 	return test_case;
 }
 
@@ -0,0 +1,207 @@
+#include "test_framework.hpp"
+#include "gl/packed_vertex.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Not a multiple of the batch width, so the scalar tail is covered too.
+	constexpr std::size_t counts[] = {0, 1, 3, 4, 1027};
+
+	tz::Vec3 random_unit(std::mt19937& rng)
+	{
+		std::normal_distribution<float> component{0.0f, 1.0f};
+		tz::Vec3 v{{component(rng), component(rng), component(rng)}};
+		return v.normalised();
+	}
+
+	std::vector<tz::gl::Vertex> random_vertices(std::mt19937& rng, std::size_t count)
+	{
+		std::uniform_real_distribution<float> position{-100.0f, 100.0f};
+		std::uniform_real_distribution<float> texcoord{0.0f, 1.0f};
+		std::vector<tz::gl::Vertex> vertices;
+		for(std::size_t i = 0; i < count; i++)
+		{
+			tz::gl::Vertex v;
+			v.position = {{position(rng), position(rng), position(rng)}};
+			v.texcoord = {{texcoord(rng), texcoord(rng)}};
+			v.normal = random_unit(rng);
+			// Tangent-space basis: Tangent orthogonal to the normal, and a bitangent of either handedness.
+			v.tangent = tz::cross(v.normal, random_unit(rng)).normalised();
+			v.bitangent = tz::cross(v.normal, v.tangent) * (i % 2 == 0 ? 1.0f : -1.0f);
+			vertices.push_back(v);
+		}
+		return vertices;
+	}
+
+	bool roughly_equal(const tz::gl::Vertex& a, const tz::gl::Vertex& b, float tolerance)
+	{
+		return a.position == b.position
+			&& (a.texcoord - b.texcoord).length() < tolerance
+			&& (a.normal - b.normal).length() < tolerance
+			&& (a.tangent - b.tangent).length() < tolerance
+			&& (a.bitangent - b.bitangent).length() < tolerance;
+	}
+}
+
+tz::test::Case half()
+{
+	tz::test::Case test_case("tz::gl Half-Precision Conversion Test");
+	topaz_expect(test_case, tz::gl::to_half(1.0f) == 0x3C00, "tz::gl::to_half(1) was wrong.");
+	topaz_expect(test_case, tz::gl::to_half(-2.0f) == 0xC000, "tz::gl::to_half(-2) was wrong.");
+	topaz_expect(test_case, tz::gl::to_half(65504.0f) == 0x7BFF, "tz::gl::to_half(65504) was not the largest half.");
+	topaz_expect(test_case, tz::gl::to_half(65520.0f) == 0x7C00, "tz::gl::to_half(65520) did not round to infinity.");
+	topaz_expect(test_case, tz::gl::to_half(std::ldexp(1.0f, -24)) == 0x0001, "tz::gl::to_half(2^-24) was not the smallest denormal half.");
+	// 1 + 2^-11 lies exactly halfway between two halves, so rounds to the even one.
+	topaz_expect(test_case, tz::gl::to_half(1.0f + std::ldexp(1.0f, -11)) == 0x3C00, "tz::gl::to_half(...) did not round halfway cases to even.");
+	topaz_expect(test_case, tz::gl::from_half(0x3555) == 0.333251953125f, "tz::gl::from_half(...) was wrong.");
+
+	// Every half must survive a round-trip, and the batch conversions must agree with the scalar ones exactly.
+	std::vector<tz::gl::Half> halves;
+	for(std::uint32_t i = 0; i <= 0xFFFF; i++)
+		halves.push_back(static_cast<tz::gl::Half>(i));
+	std::vector<float> floats(halves.size());
+	tz::gl::from_half({halves.data(), halves.size()}, {floats.data(), floats.size()});
+	std::vector<tz::gl::Half> round_trip(halves.size());
+	tz::gl::to_half({floats.data(), floats.size()}, {round_trip.data(), round_trip.size()});
+	std::size_t mismatches = 0;
+	for(std::size_t i = 0; i < halves.size(); i++)
+	{
+		const float scalar = tz::gl::from_half(halves[i]);
+		const bool nan = std::isnan(scalar);
+		const bool matches_scalar = nan ? std::isnan(floats[i]) : std::memcmp(&scalar, &floats[i], sizeof(float)) == 0;
+		// NaN payloads are not preserved, but NaN-ness is.
+		const bool round_trips = nan ? std::isnan(tz::gl::from_half(round_trip[i])) : round_trip[i] == halves[i];
+		if(!matches_scalar || !round_trips || tz::gl::to_half(floats[i]) != round_trip[i])
+			mismatches++;
+	}
+	topaz_expect(test_case, mismatches == 0, "tz::gl half conversion failed to round-trip or differed from the scalar conversion for ", mismatches, " halves.");
+
+	// Arbitrary floats, including those which overflow or underflow.
+	std::mt19937 rng{1};
+	std::uniform_real_distribution<float> exponent{-30.0f, 20.0f};
+	std::vector<float> values{0.0f, -0.0f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(), 1e-10f, 1e10f};
+	for(std::size_t i = 0; i < 1000; i++)
+		values.push_back(std::ldexp(i % 2 == 0 ? 1.0f : -1.0f, 0) * std::exp2(exponent(rng)));
+	std::vector<tz::gl::Half> batch(values.size());
+	tz::gl::to_half({values.data(), values.size()}, {batch.data(), batch.size()});
+	mismatches = 0;
+	for(std::size_t i = 0; i < values.size(); i++)
+	{
+		const tz::gl::Half scalar = tz::gl::to_half(values[i]);
+		if(batch[i] != scalar)
+			mismatches++;
+		// Correct rounding: No other half is closer.
+		if(std::isfinite(values[i]) && std::abs(values[i]) < 65504.0f)
+		{
+			const float error = std::abs(tz::gl::from_half(scalar) - values[i]);
+			const float next_error = std::abs(tz::gl::from_half(static_cast<tz::gl::Half>(scalar + 1)) - values[i]);
+			const float previous_error = (scalar & 0x7FFF) != 0 ? std::abs(tz::gl::from_half(static_cast<tz::gl::Half>(scalar - 1)) - values[i]) : error;
+			if(error > next_error || error > previous_error)
+				mismatches++;
+		}
+	}
+	topaz_expect(test_case, mismatches == 0, "tz::gl::to_half(...) was incorrectly rounded, or the batch conversion differed, for ", mismatches, " floats.");
+	return test_case;
+}
+
+tz::test::Case normalised_integers()
+{
+	tz::test::Case test_case("tz::gl Normalised Integer Conversion Test");
+	topaz_expect(test_case, tz::gl::to_unorm16(0.0f) == 0 && tz::gl::to_unorm16(1.0f) == 65535 && tz::gl::to_unorm16(2.0f) == 65535 && tz::gl::to_unorm16(-1.0f) == 0, "tz::gl::to_unorm16(...) did not map [0, 1] onto the full range, or did not clamp.");
+	topaz_expect(test_case, tz::gl::to_snorm16(-1.0f) == -32767 && tz::gl::to_snorm16(1.0f) == 32767 && tz::gl::to_snorm16(0.0f) == 0, "tz::gl::to_snorm16(...) did not map [-1, 1] onto the full range.");
+	topaz_expect(test_case, tz::gl::from_snorm16(-32768) == -1.0f, "tz::gl::from_snorm16(...) did not clamp the most negative value to -1.");
+	for(float f : {0.0f, 0.25f, 0.5f, 1.0f})
+	{
+		topaz_expect(test_case, std::abs(tz::gl::from_unorm16(tz::gl::to_unorm16(f)) - f) < 1e-5f, "tz::gl unorm16 round-trip of ", f, " was inaccurate.");
+		topaz_expect(test_case, std::abs(tz::gl::from_snorm16(tz::gl::to_snorm16(-f)) + f) < 1e-4f, "tz::gl snorm16 round-trip of ", -f, " was inaccurate.");
+	}
+
+	const tz::Vec4 value{{0.5f, -0.25f, 1.0f, -1.0f}};
+	const std::uint32_t packed = tz::gl::to_snorm_10_10_10_2(value);
+	// x = round(0.5 * 511) = 256, y = round(-0.25 * 511) = -128 (0x380), z = 511, w = -1 (0b11)
+	topaz_expect(test_case, packed == (256u | (0x380u << 10) | (511u << 20) | (3u << 30)), "tz::gl::to_snorm_10_10_10_2(...) produced the wrong bits: ", packed);
+	const tz::Vec4 unpacked = tz::gl::from_snorm_10_10_10_2(packed);
+	topaz_expect(test_case, (unpacked - value).length() < 2e-3f, "tz::gl snorm 10_10_10_2 round-trip was inaccurate.");
+	return test_case;
+}
+
+tz::test::Case octahedral()
+{
+	tz::test::Case test_case("tz::gl Octahedral Encoding Test");
+	std::mt19937 rng{2};
+	std::vector<tz::Vec3> units{{{0.0f, 0.0f, 1.0f}}, {{0.0f, 0.0f, -1.0f}}, {{1.0f, 0.0f, 0.0f}}, {{0.0f, -1.0f, 0.0f}}};
+	for(std::size_t i = 0; i < 1000; i++)
+		units.push_back(random_unit(rng));
+	float max_error = 0.0f, max_quantised_error = 0.0f;
+	for(const tz::Vec3& unit : units)
+	{
+		const tz::Vec2 encoded = tz::gl::octahedral_encode(unit);
+		max_error = std::max(max_error, (tz::gl::octahedral_decode(encoded) - unit).length());
+		const tz::Vec2 quantised{{tz::gl::from_snorm16(tz::gl::to_snorm16(encoded[0])), tz::gl::from_snorm16(tz::gl::to_snorm16(encoded[1]))}};
+		max_quantised_error = std::max(max_quantised_error, (tz::gl::octahedral_decode(quantised) - unit).length());
+	}
+	topaz_expect(test_case, max_error < 1e-5f, "tz::gl octahedral encoding was inaccurate. Max error: ", max_error);
+	topaz_expect(test_case, max_quantised_error < 1e-4f, "tz::gl octahedral encoding was inaccurate after quantising to snorm16. Max error: ", max_quantised_error);
+	const tz::Vec3 zero{{0.0f, 0.0f, 0.0f}};
+	const tz::Vec3 up{{0.0f, 0.0f, 1.0f}};
+	topaz_expect(test_case, tz::gl::octahedral_decode(tz::gl::octahedral_encode(zero)) == up, "tz::gl octahedral encoding of a zero vector did not decode to +z.");
+	return test_case;
+}
+
+tz::test::Case packed_vertex()
+{
+	tz::test::Case test_case("tz::gl::PackedVertex Test");
+	std::mt19937 rng{3};
+	for(std::size_t count : counts)
+	{
+		std::vector<tz::gl::Vertex> vertices = random_vertices(rng, count);
+		std::vector<tz::gl::PackedVertex> packed(count);
+		tz::gl::pack({vertices.data(), count}, {packed.data(), count});
+		std::vector<tz::gl::Vertex> unpacked(count);
+		tz::gl::unpack({packed.data(), count}, {unpacked.data(), count});
+		std::size_t pack_mismatches = 0, unpack_mismatches = 0, inaccurate = 0;
+		for(std::size_t i = 0; i < count; i++)
+		{
+			// The batch path must produce bit-identical results to the scalar path, so that meshes pack identically no matter how they were batched.
+			const tz::gl::PackedVertex expected = tz::gl::pack(vertices[i]);
+			if(std::memcmp(&expected, &packed[i], sizeof(tz::gl::PackedVertex)) != 0)
+				pack_mismatches++;
+			if(!roughly_equal(unpacked[i], tz::gl::unpack(packed[i]), 1e-5f))
+				unpack_mismatches++;
+			// 10-bit tangents are the least precise component.
+			if(!roughly_equal(unpacked[i], vertices[i], 5e-3f))
+				inaccurate++;
+		}
+		topaz_expect(test_case, pack_mismatches == 0, "tz::gl::pack(...) batch differed from scalar for ", pack_mismatches, " of ", count, " vertices.");
+		topaz_expect(test_case, unpack_mismatches == 0, "tz::gl::unpack(...) batch differed from scalar for ", unpack_mismatches, " of ", count, " vertices.");
+		topaz_expect(test_case, inaccurate == 0, "tz::gl::PackedVertex round-trip was inaccurate for ", inaccurate, " of ", count, " vertices.");
+	}
+	return test_case;
+}
+
+tz::test::Case formats()
+{
+	tz::test::Case test_case("tz::gl::Format Packed Descriptor Test");
+	topaz_expect(test_case, tz::gl::fmt::three_floats.element_size() == 12, "tz::gl::Format::element_size() was wrong for three floats.");
+	topaz_expect(test_case, tz::gl::fmt::snorm_10_10_10_2.element_size() == 4, "tz::gl::Format::element_size() was wrong for a packed type.");
+	topaz_expect(test_case, tz::gl::fmt::packed_vertex::texcoord.offset == offsetof(tz::gl::PackedVertex, texcoord), "tz::gl::fmt::packed_vertex::texcoord has the wrong offset.");
+	topaz_expect(test_case, tz::gl::fmt::packed_vertex::normal.offset == offsetof(tz::gl::PackedVertex, normal), "tz::gl::fmt::packed_vertex::normal has the wrong offset.");
+	topaz_expect(test_case, tz::gl::fmt::packed_vertex::tangent.offset == offsetof(tz::gl::PackedVertex, tangent), "tz::gl::fmt::packed_vertex::tangent has the wrong offset.");
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit packing;
+	packing.add(half());
+	packing.add(normalised_integers());
+	packing.add(octahedral());
+	packing.add(packed_vertex());
+	packing.add(formats());
+	return packing.result();
+}
@@ -0,0 +1,71 @@
+#include "test_framework.hpp"
+#include "core/core.hpp"
+#include "gl/streaming_buffer.hpp"
+#include <array>
+
+tz::test::Case allocation()
+{
+	tz::test::Case test_case("tz::gl::StreamingBuffer Allocation Tests");
+	tz::gl::StreamingBuffer stream{256, 3};
+	topaz_expect(test_case, stream.frame_capacity() == 256 && stream.frame_count() == 3 && stream.frame_used() == 0, "tz::gl::StreamingBuffer had unexpected initial state.");
+	std::optional<tz::gl::StreamAllocation> a = stream.allocate(10);
+	std::optional<tz::gl::StreamAllocation> b = stream.allocate(16, 16);
+	topaz_expect(test_case, a.has_value() && b.has_value(), "tz::gl::StreamingBuffer failed to allocate from an empty frame.");
+	topaz_expect(test_case, a->offset == 0 && b->offset == 16, "tz::gl::StreamingBuffer gave unexpected offsets. Expected 0 and 16, got ", a->offset, " and ", b->offset);
+	topaz_expect(test_case, stream.frame_used() == 32, "tz::gl::StreamingBuffer had unexpected usage. Expected 32 bytes, got ", stream.frame_used());
+	topaz_expect(test_case, !stream.allocate(225).has_value(), "tz::gl::StreamingBuffer allocated past the end of the frame.");
+	topaz_expect(test_case, stream.allocate(224).has_value(), "tz::gl::StreamingBuffer failed to allocate exactly the rest of the frame.");
+
+	// Each frame gets its own region, and regions are reused once every frame has been through.
+	std::array<std::size_t, 4> first_offsets;
+	for(std::size_t& first_offset : first_offsets)
+	{
+		stream.next_frame();
+		topaz_expect(test_case, stream.frame_used() == 0, "tz::gl::StreamingBuffer did not start a new frame empty.");
+		first_offset = stream.allocate(4).value().offset;
+	}
+	topaz_expect(test_case, first_offsets[0] == 256 && first_offsets[1] == 512 && first_offsets[2] == 0 && first_offsets[3] == 256, "tz::gl::StreamingBuffer did not cycle through its frame regions in order.");
+	topaz_expect_assert(test_case, false, "Unexpected assert invoked while testing tz::gl::StreamingBuffer allocation.");
+	return test_case;
+}
+
+tz::test::Case streaming()
+{
+	tz::test::Case test_case("tz::gl::StreamingBuffer Streaming Tests");
+	tz::gl::StreamingBuffer stream{64, 2};
+	// Pushed data goes straight into the persistent mapping, and is visible to the GPU without any explicit sends.
+	const std::array<float, 4> values{1.0f, 2.0f, 3.0f, 4.0f};
+	tz::gl::StreamAllocation pushed = stream.push<float>({values.data(), values.size()}).value();
+	stream.next_frame();
+	tz::gl::VertexBuffer copy;
+	copy.bind();
+	copy.resize(sizeof(values));
+	stream.bind(tz::gl::BufferType::CopySource);
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_ARRAY_BUFFER, static_cast<GLintptr>(pushed.offset), 0, sizeof(values));
+	std::array<float, 4> retrieved;
+	copy.retrieve_all(retrieved.data());
+	topaz_expect(test_case, retrieved == values, "tz::gl::StreamingBuffer pushed data did not reach the data-store.");
+
+	// Cycling round to a region that the GPU has used must wait for it rather than fail.
+	for(std::size_t frame = 0; frame < 8; frame++)
+	{
+		topaz_expect(test_case, stream.push<float>({values.data(), values.size()}).has_value(), "tz::gl::StreamingBuffer failed to push on frame ", frame);
+		stream.next_frame();
+	}
+	topaz_expect(test_case, glGetError() == GL_NO_ERROR, "glGetError() displayed an error while streaming!");
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit streaming_buffer;
+
+	// We require topaz to be initialised.
+	{
+		tz::core::initialise("StreamingBuffer Tests");
+		streaming_buffer.add(allocation());
+		streaming_buffer.add(streaming());
+		tz::core::terminate();
+	}
+	return streaming_buffer.result();
+}
@@ -0,0 +1,105 @@
+#include "test_framework.hpp"
+#include "core/core.hpp"
+#include "gl/upload_queue.hpp"
+#include <array>
+
+tz::test::Case buffer_uploads()
+{
+	tz::test::Case test_case("tz::gl::UploadQueue Buffer Tests");
+	constexpr std::size_t amt = 64;
+	tz::gl::UploadQueue queue{4096};
+	tz::gl::VertexBuffer first;
+	tz::gl::VertexBuffer second;
+	first.resize(sizeof(int) * amt);
+	second.resize(sizeof(int) * amt);
+	// Interleave tiny updates to two buffers, as per-object data typically is.
+	for(int i = 0; i < static_cast<int>(amt); i++)
+	{
+		const int negated = -i;
+		queue.send(first, i * sizeof(int), {const_cast<int*>(&i), sizeof(int)});
+		queue.send(second, i * sizeof(int), {const_cast<int*>(&negated), sizeof(int)});
+	}
+	topaz_expect(test_case, queue.pending() == amt * 2, "tz::gl::UploadQueue had unexpected number of pending updates. Expected ", amt * 2, ", got ", queue.pending());
+	// Each buffer's updates cover one contiguous range, so despite being interleaved they need only one copy per buffer.
+	const std::size_t copies = queue.flush();
+	topaz_expect(test_case, copies == 2, "tz::gl::UploadQueue did not coalesce interleaved updates. Issued ", copies, " copies for ", amt * 2, " updates");
+	topaz_expect(test_case, queue.pending() == 0, "tz::gl::UploadQueue still had pending updates after flushing");
+	std::array<int, amt> first_data;
+	std::array<int, amt> second_data;
+	first.retrieve_all(first_data.data());
+	second.retrieve_all(second_data.data());
+	bool matches = true;
+	for(std::size_t i = 0; i < amt; i++)
+	{
+		matches = matches && first_data[i] == static_cast<int>(i) && second_data[i] == -static_cast<int>(i);
+	}
+	topaz_expect(test_case, matches, "tz::gl::UploadQueue updates did not reach their buffers");
+
+	// Consecutive updates to one buffer become a single copy, and later updates to the same range win.
+	std::array<int, amt> ones;
+	ones.fill(1);
+	queue.send(first, 0, {ones.data(), sizeof(int) * amt / 2});
+	queue.send(first, sizeof(int) * amt / 2, {ones.data(), sizeof(int) * amt / 2});
+	const int seven = 7;
+	queue.send(first, 0, {const_cast<int*>(&seven), sizeof(int)});
+	topaz_expect(test_case, queue.flush() == 2, "tz::gl::UploadQueue did not coalesce consecutive updates into one copy");
+	first.retrieve_all(first_data.data());
+	topaz_expect(test_case, first_data[0] == 7 && first_data[1] == 1 && first_data[amt - 1] == 1, "tz::gl::UploadQueue did not apply updates in order");
+
+	// Updates larger than the staging buffer are sent directly, but only after anything already queued for the same range.
+	std::vector<int> big(2048, 3);
+	tz::gl::VertexBuffer large;
+	large.resize(big.size() * sizeof(int));
+	queue.send(large, 0, {const_cast<int*>(&seven), sizeof(int)});
+	queue.send(large, 0, {big.data(), big.size() * sizeof(int)});
+	topaz_expect(test_case, queue.pending() == 0, "tz::gl::UploadQueue did not flush before sending an oversized update directly");
+	queue.flush();
+	int first_big, last_big;
+	large.retrieve(0, sizeof(int), &first_big);
+	large.retrieve((big.size() - 1) * sizeof(int), sizeof(int), &last_big);
+	topaz_expect(test_case, first_big == 3 && last_big == 3, "tz::gl::UploadQueue let an older queued update overwrite an oversized update sent after it");
+	topaz_expect_assert(test_case, false, "Unexpected assert invoked while testing tz::gl::UploadQueue buffer uploads.");
+	return test_case;
+}
+
+tz::test::Case texture_uploads()
+{
+	tz::test::Case test_case("tz::gl::UploadQueue Texture Tests");
+	tz::gl::UploadQueue queue{1024};
+	tz::gl::PixelRGBA8 black_pixel{std::byte{}, std::byte{}, std::byte{}, std::byte{255}};
+	tz::gl::PixelRGBA8 white_pixel{std::byte{255}, std::byte{255}, std::byte{255}, std::byte{255}};
+	tz::gl::Image<tz::gl::PixelRGBA8> black{2, 2};
+	tz::gl::Image<tz::gl::PixelRGBA8> checkerboard{2, 2};
+	for(unsigned int x = 0; x < 2; x++)
+	{
+		for(unsigned int y = 0; y < 2; y++)
+		{
+			black(x, y) = black_pixel;
+			checkerboard(x, y) = (x == y) ? black_pixel : white_pixel;
+		}
+	}
+	tz::gl::Texture texture;
+	// No storage yet, so this can't be deferred.
+	queue.set_data(texture, black);
+	topaz_expect(test_case, queue.pending() == 0 && texture.get_width() == 2, "tz::gl::UploadQueue did not set the data of a texture without storage directly");
+	queue.set_data(texture, checkerboard);
+	topaz_expect(test_case, queue.pending() == 1, "tz::gl::UploadQueue did not queue an in-place texture update");
+	queue.flush();
+	tz::gl::Image<tz::gl::PixelRGBA8> retrieved = texture.get_data<tz::gl::PixelRGBA, typename tz::gl::PixelRGBA8::ComponentType>();
+	topaz_expect(test_case, retrieved == checkerboard, "tz::gl::UploadQueue texture update did not reach the texture");
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit upload_queue;
+
+	// We require topaz to be initialised.
+	{
+		tz::core::initialise("UploadQueue Tests");
+		upload_queue.add(buffer_uploads());
+		upload_queue.add(texture_uploads());
+		tz::core::terminate();
+	}
+	return upload_queue.result();
+}
@@ -0,0 +1,108 @@
+#include "test_framework.hpp"
+#include "memory/arena.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+tz::test::Case allocation()
+{
+	tz::test::Case test_case("tz::mem::LinearArena Allocation Tests");
+	tz::mem::LinearArena arena{256};
+	topaz_expect(test_case, arena.capacity() == 256, "tz::mem::LinearArena had unexpected capacity. Expected 256, got ", arena.capacity());
+	topaz_expect(test_case, arena.size() == 0, "tz::mem::LinearArena was not initially empty. Size: ", arena.size());
+
+	void* a = arena.allocate(1, 1);
+	topaz_expect(test_case, a != nullptr && arena.contains(a), "tz::mem::LinearArena failed to hand out a single byte.");
+	void* b = arena.allocate(sizeof(double), alignof(double));
+	topaz_expect(test_case, reinterpret_cast<std::uintptr_t>(b) % alignof(double) == 0, "tz::mem::LinearArena returned a misaligned address.");
+	void* c = arena.allocate(16, 64);
+	topaz_expect(test_case, reinterpret_cast<std::uintptr_t>(c) % 64 == 0, "tz::mem::LinearArena returned a misaligned address for an over-aligned request.");
+	topaz_expect(test_case, arena.size() + arena.remaining() == arena.capacity(), "tz::mem::LinearArena size and remaining don't add up to its capacity.");
+
+	// Exhaustion should fail gracefully and leave the arena untouched.
+	std::size_t size_before = arena.size();
+	topaz_expect(test_case, arena.allocate(arena.remaining() + 1, 1) == nullptr, "tz::mem::LinearArena handed out more memory than it has.");
+	topaz_expect(test_case, arena.size() == size_before, "tz::mem::LinearArena changed size after a failed allocation.");
+	topaz_expect(test_case, arena.allocate(arena.remaining(), 1) != nullptr, "tz::mem::LinearArena failed to hand out its last remaining bytes.");
+	topaz_expect(test_case, arena.remaining() == 0, "tz::mem::LinearArena should be full, but has ", arena.remaining(), " bytes remaining.");
+
+	arena.reset();
+	topaz_expect(test_case, arena.size() == 0, "tz::mem::LinearArena::reset() did not empty the arena.");
+	topaz_expect(test_case, arena.allocate(1, 1) == a, "tz::mem::LinearArena did not re-use memory after a reset.");
+
+	// Arenas can also sit over an existing block.
+	alignas(16) char data[32];
+	tz::mem::LinearArena borrowed{tz::mem::Block{data, sizeof(data)}};
+	topaz_expect(test_case, borrowed.allocate(8) == data, "tz::mem::LinearArena over an existing block didn't begin allocating at the start of the block.");
+	topaz_expect(test_case, !borrowed.contains(a), "tz::mem::LinearArena believes it contains an address from another arena.");
+
+	// Moving an arena leaves the source with no block to allocate from.
+	tz::mem::LinearArena moved{std::move(borrowed)};
+	topaz_expect(test_case, borrowed.capacity() == 0 && borrowed.allocate(1, 1) == nullptr, "tz::mem::LinearArena still allocates from its block after being moved from.");
+	topaz_expect(test_case, moved.capacity() == sizeof(data), "tz::mem::LinearArena move-constructor didn't take the block. Expected capacity ", sizeof(data), ", got ", moved.capacity());
+	borrowed = std::move(moved);
+	topaz_expect(test_case, moved.capacity() == 0 && borrowed.capacity() == sizeof(data), "tz::mem::LinearArena move-assignment didn't take the block.");
+	return test_case;
+}
+
+tz::test::Case markers()
+{
+	tz::test::Case test_case("tz::mem::LinearArena Marker Tests");
+	tz::mem::LinearArena arena{128};
+	arena.allocate(8);
+	tz::mem::LinearArena::Marker m = arena.mark();
+	void* first = arena.allocate(16);
+	arena.allocate(16);
+	arena.rewind(m);
+	topaz_expect(test_case, arena.size() == m, "tz::mem::LinearArena::rewind did not restore the marker position.");
+	topaz_expect(test_case, arena.allocate(16) == first, "tz::mem::LinearArena did not re-use memory after a rewind.");
+
+	std::size_t outer = arena.size();
+	{
+		tz::mem::ScopedMarker scope{arena};
+		arena.allocate(32);
+		{
+			tz::mem::ScopedMarker inner{arena};
+			arena.allocate(32);
+		}
+		topaz_expect(test_case, arena.size() >= outer + 32, "tz::mem::ScopedMarker rewound beyond its own scope.");
+	}
+	topaz_expect(test_case, arena.size() == outer, "tz::mem::ScopedMarker did not rewind the arena on destruction. Expected size ", outer, ", got ", arena.size());
+	return test_case;
+}
+
+tz::test::Case pmr()
+{
+	tz::test::Case test_case("tz::mem::ArenaResource Tests");
+	tz::mem::LinearArena arena{1024};
+	tz::mem::ArenaResource resource{arena};
+	{
+		std::pmr::vector<int> ints{&resource};
+		ints.reserve(16);
+		for(int i = 0; i < 16; i++)
+			ints.push_back(i);
+		topaz_expect(test_case, arena.contains(ints.data()), "std::pmr::vector did not allocate from the arena.");
+		topaz_expect(test_case, ints[15] == 15, "std::pmr::vector backed by an arena has corrupted data.");
+	}
+	topaz_expect(test_case, arena.size() > 0, "Arena memory should not be reclaimed by pmr deallocation.");
+
+	// Overflow falls back to upstream.
+	std::pmr::vector<char> big{&resource};
+	big.resize(4096);
+	topaz_expect(test_case, !arena.contains(big.data()), "std::pmr::vector larger than the arena should have fallen back to the upstream resource.");
+
+	tz::mem::ArenaResource other{arena};
+	topaz_expect(test_case, resource.is_equal(resource) && !resource.is_equal(other), "tz::mem::ArenaResource equality should be based on identity.");
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit arena;
+
+	arena.add(allocation());
+	arena.add(markers());
+	arena.add(pmr());
+
+	return arena.result();
+}
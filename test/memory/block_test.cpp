@@ -4,6 +4,9 @@
 
 #include "test_framework.hpp"
 #include "memory/block.hpp"
+#include "memory/align.hpp"
+#include <cstring>
+#include <limits>
 
 tz::test::Case dist()
 {
@@ -31,12 +34,57 @@ tz::test::Case auto_block()
 	return test_case;
 }
 
+tz::test::Case aligned_auto_block()
+{
+	tz::test::Case test_case("tz::mem::AutoBlock Aligned Tests");
+	for(std::size_t align : {std::size_t{16}, tz::mem::alignment::cache_line, tz::mem::alignment::page})
+	{
+		// Deliberately not a multiple of the alignment.
+		tz::mem::AutoBlock blk{100, align};
+		topaz_expect(test_case, blk.size() == 100, "tz::mem::AutoBlock::size(): Unexpected size. Expected ", 100, ", got ", blk.size());
+		topaz_expect(test_case, tz::mem::is_aligned(blk.begin, align), "tz::mem::AutoBlock(100, ", align, ") was not aligned correctly.");
+		topaz_expect(test_case, blk.path() == tz::mem::AllocationPath::Aligned, "tz::mem::AutoBlock(100, ", align, ") reported unexpected path ", tz::mem::to_string(blk.path()));
+		std::memset(blk.begin, 0xFF, blk.size());
+	}
+	tz::mem::AutoBlock plain{64};
+	topaz_expect(test_case, plain.path() == tz::mem::AllocationPath::Malloc, "tz::mem::AutoBlock(64) should report the malloc path, but got ", tz::mem::to_string(plain.path()));
+	// No allocator can satisfy this, so the block should be empty rather than null with a non-zero size.
+	tz::mem::AutoBlock impossible{std::numeric_limits<std::size_t>::max() / 2, tz::mem::alignment::cache_line};
+	topaz_expect(test_case, impossible.begin == nullptr && impossible.size() == 0, "tz::mem::AutoBlock claimed ", impossible.size(), " bytes after every allocation failed.");
+	topaz_expect(test_case, impossible.path() == tz::mem::AllocationPath::Malloc, "tz::mem::AutoBlock should report the malloc fallback after the aligned allocation failed, but got ", tz::mem::to_string(impossible.path()));
+	return test_case;
+}
+
+tz::test::Case huge_page_auto_block()
+{
+	tz::test::Case test_case("tz::mem::AutoBlock Huge Page Tests");
+	constexpr std::size_t size = 3 * tz::mem::alignment::huge_page + 123;
+	tz::mem::AutoBlock blk{size, tz::mem::alignment::cache_line, tz::mem::PageHint::Huge};
+	topaz_expect(test_case, blk.size() == size, "tz::mem::AutoBlock::size(): Unexpected size. Expected ", size, ", got ", blk.size());
+	topaz_expect(test_case, tz::mem::is_aligned(blk.begin, tz::mem::alignment::cache_line), "tz::mem::AutoBlock with huge page hint was not aligned to the requested alignment.");
+	// Whichever path was granted, the memory must be usable.
+	std::memset(blk.begin, 0xAB, blk.size());
+	topaz_expect(test_case, static_cast<unsigned char*>(blk.end)[-1] == 0xAB, "tz::mem::AutoBlock with huge page hint did not retain written data.");
+	#if defined(__linux__)
+		topaz_expect(test_case, blk.path() != tz::mem::AllocationPath::Malloc, "tz::mem::AutoBlock with huge page hint unexpectedly used plain malloc.");
+		if(blk.path() == tz::mem::AllocationPath::HugePage || blk.path() == tz::mem::AllocationPath::Mapped)
+		{
+			topaz_expect(test_case, tz::mem::is_aligned(blk.begin, tz::mem::alignment::huge_page), "tz::mem::AutoBlock mapped path was not aligned to a huge page boundary.");
+		}
+	#else
+		topaz_expect(test_case, blk.path() == tz::mem::AllocationPath::Aligned, "tz::mem::AutoBlock with huge page hint should fall back to the aligned path on this platform, but got ", tz::mem::to_string(blk.path()));
+	#endif
+	return test_case;
+}
+
 int main()
 {
 	tz::test::Unit block;
 	
 	block.add(dist());
 	block.add(auto_block());
+	block.add(aligned_auto_block());
+	block.add(huge_page_auto_block());
 
 	return block.result();
 }
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "test_framework.hpp"
+#include "memory/offset_allocator.hpp"
+#include <random>
+#include <vector>
+
+tz::test::Case allocation()
+{
+	tz::test::Case test_case("tz::mem::OffsetAllocator Allocation Tests");
+	tz::mem::OffsetAllocator alloc{100};
+	auto a = alloc.allocate(10);
+	auto b = alloc.allocate(25);
+	topaz_expect(test_case, a.has_value() && b.has_value(), "tz::mem::OffsetAllocator failed to allocate from a fresh allocator.");
+	topaz_expect(test_case, a->offset == 0 && a->size == 10, "tz::mem::OffsetAllocator gave unexpected first range. Expected (0, 10), got (", a->offset, ", ", a->size, ")");
+	topaz_expect(test_case, b->offset == 10 && b->size == 25, "tz::mem::OffsetAllocator gave unexpected second range. Expected (10, 25), got (", b->offset, ", ", b->size, ")");
+
+	tz::mem::OffsetAllocatorStats stats = alloc.stats();
+	topaz_expect(test_case, stats.used == 35 && stats.free == 65 && stats.allocation_count == 2, "tz::mem::OffsetAllocator had unexpected usage. Used: ", stats.used, ", Free: ", stats.free, ", Allocations: ", stats.allocation_count);
+	topaz_expect(test_case, stats.largest_free_region == 65, "tz::mem::OffsetAllocator had unexpected largest free region. Expected 65, got ", stats.largest_free_region);
+
+	// Can't fit more than what's left.
+	topaz_expect(test_case, !alloc.allocate(66).has_value(), "tz::mem::OffsetAllocator handed out more units than it has free.");
+	auto rest = alloc.allocate(65);
+	topaz_expect(test_case, rest.has_value() && rest->offset == 35, "tz::mem::OffsetAllocator failed to hand out exactly its remaining space.");
+	topaz_expect(test_case, !alloc.allocate(1).has_value(), "tz::mem::OffsetAllocator handed out a range while full.");
+	topaz_expect(test_case, alloc.stats().free_region_count == 0, "tz::mem::OffsetAllocator should have no free regions while full.");
+
+	// Freed gaps are re-used.
+	alloc.free(b.value());
+	auto c = alloc.allocate(20);
+	topaz_expect(test_case, c.has_value() && c->offset == 10, "tz::mem::OffsetAllocator didn't re-use a freed gap.");
+
+	alloc.reset();
+	stats = alloc.stats();
+	topaz_expect(test_case, stats.used == 0 && stats.free_region_count == 1 && stats.largest_free_region == 100, "tz::mem::OffsetAllocator::reset() didn't restore the allocator to a single free region.");
+	return test_case;
+}
+
+tz::test::Case coalescing()
+{
+	tz::test::Case test_case("tz::mem::OffsetAllocator Coalescing Tests");
+	tz::mem::OffsetAllocator alloc{64};
+	std::vector<tz::mem::OffsetAllocation> allocs;
+	for(std::size_t i = 0; i < 8; i++)
+		allocs.push_back(alloc.allocate(8).value());
+	topaz_expect(test_case, alloc.stats().free_region_count == 0, "tz::mem::OffsetAllocator should be full.");
+
+	// Free every other range. None of them are adjacent, so nothing merges.
+	for(std::size_t i = 0; i < 8; i += 2)
+		alloc.free(allocs[i]);
+	tz::mem::OffsetAllocatorStats stats = alloc.stats();
+	topaz_expect(test_case, stats.free_region_count == 4 && stats.coalesce_count == 0, "tz::mem::OffsetAllocator merged non-adjacent regions. Free regions: ", stats.free_region_count, ", Merges: ", stats.coalesce_count);
+	topaz_expect(test_case, stats.largest_free_region == 8, "tz::mem::OffsetAllocator had unexpected largest free region. Expected 8, got ", stats.largest_free_region);
+	topaz_expect(test_case, stats.fragmentation() > 0.5f, "tz::mem::OffsetAllocator reported unexpectedly low fragmentation: ", stats.fragmentation());
+	topaz_expect(test_case, !alloc.allocate(9).has_value(), "tz::mem::OffsetAllocator handed out a range larger than any free region.");
+
+	// Free the rest. Each one bridges two free neighbours.
+	for(std::size_t i = 1; i < 8; i += 2)
+		alloc.free(allocs[i]);
+	stats = alloc.stats();
+	topaz_expect(test_case, stats.free_region_count == 1 && stats.largest_free_region == 64, "tz::mem::OffsetAllocator didn't coalesce back into a single region. Free regions: ", stats.free_region_count, ", Largest: ", stats.largest_free_region);
+	topaz_expect(test_case, stats.coalesce_count == 7, "tz::mem::OffsetAllocator had unexpected number of merges. Expected 7, got ", stats.coalesce_count);
+	topaz_expect(test_case, stats.fragmentation() == 0.0f, "tz::mem::OffsetAllocator should not be fragmented when entirely free.");
+	return test_case;
+}
+
+tz::test::Case stress()
+{
+	tz::test::Case test_case("tz::mem::OffsetAllocator Stress Tests");
+	constexpr std::size_t capacity = 4096;
+	tz::mem::OffsetAllocator alloc{capacity};
+	std::vector<tz::mem::OffsetAllocation> live;
+	std::vector<bool> occupied(capacity, false);
+	std::mt19937 rng{0};
+	std::uniform_int_distribution<std::size_t> size_dist{1, 100};
+	bool overlap = false;
+	for(std::size_t i = 0; i < 10000; i++)
+	{
+		if(live.empty() || rng() % 3 != 0)
+		{
+			auto a = alloc.allocate(size_dist(rng));
+			if(!a.has_value())
+				continue;
+			for(std::size_t j = a->offset; j < a->offset + a->size; j++)
+			{
+				overlap |= occupied[j];
+				occupied[j] = true;
+			}
+			live.push_back(a.value());
+		}
+		else
+		{
+			std::size_t idx = rng() % live.size();
+			for(std::size_t j = live[idx].offset; j < live[idx].offset + live[idx].size; j++)
+				occupied[j] = false;
+			alloc.free(live[idx]);
+			live[idx] = live.back();
+			live.pop_back();
+		}
+	}
+	topaz_expect(test_case, !overlap, "tz::mem::OffsetAllocator handed out overlapping ranges.");
+	std::size_t expected_used = 0;
+	for(const tz::mem::OffsetAllocation& a : live)
+		expected_used += a.size;
+	topaz_expect(test_case, alloc.stats().used == expected_used, "tz::mem::OffsetAllocator lost track of used units. Expected ", expected_used, ", got ", alloc.stats().used);
+	for(const tz::mem::OffsetAllocation& a : live)
+		alloc.free(a);
+	topaz_expect(test_case, alloc.stats().free_region_count == 1 && alloc.stats().largest_free_region == capacity, "tz::mem::OffsetAllocator didn't coalesce back into a single region after freeing everything.");
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit offset_allocator;
+
+	offset_allocator.add(allocation());
+	offset_allocator.add(coalescing());
+	offset_allocator.add(stress());
+
+	return offset_allocator.result();
+}
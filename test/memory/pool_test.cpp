@@ -4,6 +4,7 @@
 
 #include "test_framework.hpp"
 #include "memory/pool.hpp"
+#include <string>
 
 tz::test::Case uniform()
 {
@@ -161,6 +162,109 @@ tz::test::Case overflow()
 	return test_case;
 }
 
+tz::test::Case allocation()
+{
+	tz::test::Case test_case("tz::mem::UniformPool Allocation Tests");
+	constexpr std::size_t ele_size = 4; // number of elements we can store.
+	using StorageType = std::aligned_storage_t<sizeof(int), alignof(int)>;
+	constexpr std::size_t mem_size = ele_size * sizeof(StorageType);
+	StorageType mem[ele_size];
+	tz::mem::UniformPool<int> ints{&mem, mem_size};
+
+	// Someone has already claimed index 1 manually. allocate() must not hand it out.
+	ints.set(1, 100);
+	std::size_t a = ints.allocate(5);
+	std::size_t b = ints.allocate(6);
+	std::size_t c = ints.allocate(7);
+	topaz_expect(test_case, a != 1 && b != 1 && c != 1, "UniformPool<int>::allocate() handed out an already-occupied slot. Got indices ", a, ", ", b, ", ", c);
+	topaz_expect(test_case, a != b && b != c && a != c, "UniformPool<int>::allocate() handed out the same slot twice. Got indices ", a, ", ", b, ", ", c);
+	topaz_expect(test_case, ints[a] == 5 && ints[b] == 6 && ints[c] == 7 && ints[1] == 100, "UniformPool<int>::allocate() failed to construct values in the slots it handed out.");
+	topaz_expect(test_case, ints.size() == 4, "UniformPool<int> had unexpected size after allocations. Expected ", 4, ", got ", ints.size());
+	topaz_expect(test_case, ints.full(), "UniformPool<int> wrongly considered to not be full after allocating every slot. Size == ", ints.size());
+
+	// Free a slot and make sure the next allocation re-uses it.
+	ints.deallocate(b);
+	topaz_expect(test_case, ints.size() == 3, "UniformPool<int> had unexpected size after deallocation. Expected ", 3, ", got ", ints.size());
+	std::size_t d = ints.allocate(8);
+	topaz_expect(test_case, d == b, "UniformPool<int>::allocate() did not re-use the freed slot ", b, ", instead got ", d);
+	topaz_expect(test_case, ints[d] == 8, "UniformPool<int>::allocate() failed to construct value in a re-used slot.");
+
+	// Erasing the same slot twice must not count twice.
+	ints.erase(a);
+	ints.erase(a);
+	topaz_expect(test_case, ints.size() == 3, "UniformPool<int> double-erase corrupted the size. Expected ", 3, ", got ", ints.size());
+	// A freed slot re-occupied via set() must not be handed out by allocate().
+	ints.set(a, 9);
+	ints.erase(c);
+	std::size_t e = ints.allocate(10);
+	topaz_expect(test_case, e == c, "UniformPool<int>::allocate() returned slot ", e, " but the only free slot was ", c);
+	topaz_expect(test_case, ints[a] == 9, "UniformPool<int>::allocate() clobbered a slot which was re-occupied via set().");
+	// Setting and erasing the same slot over and over must leave it free exactly once.
+	for(int i = 0; i < 1000; i++)
+	{
+		ints.set(a, i);
+		ints.erase(a);
+	}
+	std::size_t f = ints.allocate(11);
+	ints.erase(f);
+	std::size_t g = ints.allocate(12);
+	topaz_expect(test_case, f == a && g == a, "UniformPool<int>::allocate() did not re-use the repeatedly freed slot ", a, ", instead got ", f, " and then ", g);
+
+	// Overflowing via allocate() should assert.
+	topaz_expect_assert(test_case, false, "UniformPool<int> asserted sooner than expected.");
+	ints.allocate(11);
+	topaz_expect_assert(test_case, true, "UniformPool<int>::allocate() didn't assert when expected (full pool)");
+	topaz_assert_clear();
+
+	// Clearing should make every slot available again.
+	ints.clear();
+	topaz_expect(test_case, ints.empty(), "UniformPool<int>::clear() failed to empty the pool. Size == ", ints.size());
+	for(std::size_t i = 0; i < ele_size; i++)
+		ints.allocate(static_cast<int>(i));
+	topaz_expect(test_case, ints.full(), "UniformPool<int> could not re-allocate every slot after a clear. Size == ", ints.size());
+	return test_case;
+}
+
+tz::test::Case live_iteration()
+{
+	tz::test::Case test_case("tz::mem::UniformPool Live Iteration Tests");
+	// Span a few mask words so we exercise word-skipping.
+	constexpr std::size_t ele_size = 200;
+	using StorageType = std::aligned_storage_t<sizeof(int), alignof(int)>;
+	constexpr std::size_t mem_size = ele_size * sizeof(StorageType);
+	StorageType mem[ele_size];
+	tz::mem::UniformPool<int> ints{&mem, mem_size};
+
+	const std::size_t live_indices[] = {0, 3, 63, 64, 130, 199};
+	for(std::size_t idx : live_indices)
+		ints.set(idx, static_cast<int>(idx) * 2);
+
+	std::vector<std::size_t> visited;
+	ints.for_each_live([&visited](std::size_t idx, int& val)
+	{
+		visited.push_back(idx);
+		val++;
+	});
+	constexpr std::size_t live_count = sizeof(live_indices) / sizeof(std::size_t);
+	topaz_expect(test_case, visited.size() == live_count, "UniformPool<int>::for_each_live visited ", visited.size(), " elements, expected ", live_count);
+	for(std::size_t i = 0; i < std::min(visited.size(), live_count); i++)
+	{
+		topaz_expect(test_case, visited[i] == live_indices[i], "UniformPool<int>::for_each_live visited index ", visited[i], " when it expected ", live_indices[i]);
+		topaz_expect(test_case, ints[live_indices[i]] == static_cast<int>(live_indices[i]) * 2 + 1, "UniformPool<int>::for_each_live failed to provide a mutable reference at index ", live_indices[i]);
+	}
+
+	// Const iteration without indices. Erased elements must not be visited.
+	ints.erase(64);
+	const tz::mem::UniformPool<int>& cints = ints;
+	int sum = 0;
+	cints.for_each_live([&sum](const int& val){sum += val;});
+	int expected_sum = 0;
+	for(std::size_t idx : live_indices)
+		if(idx != 64)
+			expected_sum += static_cast<int>(idx) * 2 + 1;
+	topaz_expect(test_case, sum == expected_sum, "UniformPool<int>::for_each_live const sum was ", sum, ", expected ", expected_sum);
+	return test_case;
+}
 
 tz::test::Case statics()
 {
@@ -193,13 +297,60 @@ tz::test::Case statics()
 	return test_case;
 }
 
+tz::test::Case soa()
+{
+	tz::test::Case test_case("tz::mem::SoAPool Basic Tests");
+	using Pool = tz::mem::SoAPool<float, double, std::string>;
+	constexpr std::size_t cap = 10;
+	// Deliberately misalign the block. The pool should cope.
+	tz::mem::AutoBlock blk{Pool::required_size(cap) + 1};
+	tz::mem::Block misaligned{static_cast<char*>(blk.begin) + 1, Pool::required_size(cap)};
+	Pool pool{misaligned};
+	topaz_expect(test_case, pool.empty() && pool.capacity() >= cap, "tz::mem::SoAPool had unexpected initial state. Size: ", pool.size(), ", Capacity: ", pool.capacity());
+	auto aligned = [](const void* ptr){return reinterpret_cast<std::uintptr_t>(ptr) % Pool::column_alignment == 0;};
+	topaz_expect(test_case, aligned(pool.get<0>().data()) && aligned(pool.get<1>().data()) && aligned(pool.get<2>().data()), "tz::mem::SoAPool columns were not SIMD-aligned.");
+
+	for(std::size_t i = 0; i < 4; i++)
+		pool.push(static_cast<float>(i), static_cast<double>(i) * 2.0, std::to_string(i));
+	topaz_expect(test_case, pool.size() == 4, "tz::mem::SoAPool had unexpected size. Expected 4, got ", pool.size());
+	tz::mem::Span<float> floats = pool.get<0>();
+	topaz_expect(test_case, floats.size() == 4 && floats[3] == 3.0f, "tz::mem::SoAPool float column had unexpected contents.");
+	// Columns are separate arrays, so consecutive elements of a column are adjacent in memory.
+	topaz_expect(test_case, &floats[1] == &floats[0] + 1, "tz::mem::SoAPool column was not contiguous.");
+
+	// Swap-remove: The last element takes the erased element's place in every column.
+	pool.erase(1);
+	topaz_expect(test_case, pool.size() == 3, "tz::mem::SoAPool had unexpected size after erasure. Expected 3, got ", pool.size());
+	topaz_expect(test_case, pool.get<0>()[1] == 3.0f && pool.get<1>()[1] == 6.0 && pool.get<2>()[1] == "3", "tz::mem::SoAPool erasure didn't move the last element into the gap.");
+	float sum = 0.0f;
+	for(float f : pool.get<0>())
+		sum += f;
+	topaz_expect(test_case, sum == 5.0f, "tz::mem::SoAPool column iteration yielded unexpected sum. Expected 5, got ", sum);
+
+	const Pool& cpool = pool;
+	topaz_expect(test_case, cpool.get<2>()[0] == "0", "tz::mem::SoAPool const column access yielded unexpected value.");
+
+	while(!pool.full())
+		pool.push(0.0f, 0.0, "filler");
+	topaz_expect_assert(test_case, false, "tz::mem::SoAPool asserted sooner than expected.");
+	topaz_expect(test_case, pool.push(0.0f, 0.0, "overflow") == pool.capacity(), "tz::mem::SoAPool accepted a push while full.");
+	topaz_expect_assert(test_case, true, "tz::mem::SoAPool didn't assert when pushed while full.");
+	topaz_assert_clear();
+	pool.clear();
+	topaz_expect(test_case, pool.empty(), "tz::mem::SoAPool::clear() didn't empty the pool.");
+	return test_case;
+}
+
 int main()
 {
 	tz::test::Unit pool;
 	pool.add(uniform());
 	pool.add(object_semantics());
 	pool.add(overflow());
+	pool.add(allocation());
+	pool.add(live_iteration());
 	pool.add(statics());
+	pool.add(soa());
 	
 	return pool.result();
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "test_framework.hpp"
+#include "memory/slot_map.hpp"
+#include <memory>
+
+tz::test::Case insertion()
+{
+	tz::test::Case test_case("tz::mem::SlotMap Insertion Tests");
+	tz::mem::SlotMap<int> ints;
+	topaz_expect(test_case, ints.empty() && ints.size() == 0, "tz::mem::SlotMap was not initially empty. Size: ", ints.size());
+	auto a = ints.emplace(1);
+	auto b = ints.emplace(2);
+	auto c = ints.emplace(3);
+	topaz_expect(test_case, ints.size() == 3 && ints.slot_count() == 3, "tz::mem::SlotMap had unexpected size. Expected 3, got ", ints.size());
+	topaz_expect(test_case, ints[a] == 1 && ints[b] == 2 && ints[c] == 3, "tz::mem::SlotMap handles resolved to the wrong values.");
+	topaz_expect(test_case, a != b && b != c && a != c, "tz::mem::SlotMap handed out duplicate handles.");
+	int sum = 0;
+	for(int i : ints)
+		sum += i;
+	topaz_expect(test_case, sum == 6, "tz::mem::SlotMap iteration yielded unexpected sum. Expected 6, got ", sum);
+	return test_case;
+}
+
+tz::test::Case erasure()
+{
+	tz::test::Case test_case("tz::mem::SlotMap Erasure Tests");
+	tz::mem::SlotMap<int> ints;
+	auto a = ints.emplace(1);
+	auto b = ints.emplace(2);
+	auto c = ints.emplace(3);
+	ints.erase(a);
+	topaz_expect(test_case, ints.size() == 2 && ints.slot_count() == 3, "tz::mem::SlotMap had unexpected size after erasure. Expected 2, got ", ints.size());
+	topaz_expect(test_case, !ints.contains(a) && ints.find(a) == nullptr, "tz::mem::SlotMap still resolves an erased handle.");
+	// Erasure swaps the last element into the hole. Existing handles must survive that.
+	topaz_expect(test_case, ints[b] == 2 && ints[c] == 3, "tz::mem::SlotMap handles were invalidated by erasure of another element.");
+
+	// The erased slot is re-used, but the old handle must stay stale.
+	auto d = ints.emplace(4);
+	topaz_expect(test_case, ints.slot_count() == 3, "tz::mem::SlotMap didn't re-use an erased slot. Slot count: ", ints.slot_count());
+	topaz_expect(test_case, d != a, "tz::mem::SlotMap re-issued a stale handle.");
+	topaz_expect(test_case, !ints.contains(a) && ints.find(a) == nullptr, "tz::mem::SlotMap stale handle resolved to the element now occupying its slot.");
+	topaz_expect(test_case, ints[d] == 4, "tz::mem::SlotMap re-used slot resolved to the wrong value.");
+
+	// Handles that were never issued are stale too.
+	topaz_expect(test_case, !ints.contains(1000) && !ints.contains(d + 1), "tz::mem::SlotMap resolved a handle it never issued.");
+
+	ints.clear();
+	topaz_expect(test_case, ints.empty() && !ints.contains(b) && !ints.contains(c) && !ints.contains(d), "tz::mem::SlotMap::clear() didn't invalidate all handles.");
+	return test_case;
+}
+
+tz::test::Case move_only()
+{
+	tz::test::Case test_case("tz::mem::SlotMap Move-Only Tests");
+	tz::mem::SlotMap<std::unique_ptr<int>> ptrs;
+	auto a = ptrs.emplace(std::make_unique<int>(5));
+	auto b = ptrs.emplace(std::make_unique<int>(6));
+	ptrs.erase(a);
+	topaz_expect(test_case, ptrs[b] != nullptr && *ptrs[b] == 6, "tz::mem::SlotMap failed to move a move-only element during erasure.");
+	topaz_expect(test_case, ptrs.handle_at(0) == b, "tz::mem::SlotMap::handle_at returned the wrong handle after erasure.");
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit slot_map;
+
+	slot_map.add(insertion());
+	slot_map.add(erasure());
+	slot_map.add(move_only());
+
+	return slot_map.result();
+}
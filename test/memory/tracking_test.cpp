@@ -0,0 +1,127 @@
+#include "test_framework.hpp"
+#include "memory/tracking.hpp"
+#include "memory/arena.hpp"
+#include "memory/block.hpp"
+#include "memory/pool.hpp"
+#include <memory>
+
+using tz::mem::tracking::Tag;
+
+tz::test::Case tagged_blocks()
+{
+	tz::test::Case test_case("tz::mem::tracking Tagged Allocation Tests");
+	tz::mem::tracking::TagStats before = tz::mem::tracking::get(Tag::Block);
+	{
+		tz::mem::AutoBlock blk{1000};
+		tz::mem::tracking::TagStats during = tz::mem::tracking::get(Tag::Block);
+		if constexpr(tz::mem::tracking::enabled)
+		{
+			topaz_expect(test_case, during.current_bytes == before.current_bytes + 1000, "tz::mem::tracking did not account an AutoBlock. Expected ", before.current_bytes + 1000, " bytes, got ", during.current_bytes);
+			topaz_expect(test_case, during.peak_bytes >= during.current_bytes, "tz::mem::tracking peak (", during.peak_bytes, ") is lower than the current value (", during.current_bytes, ")");
+			topaz_expect(test_case, during.total_allocations == before.total_allocations + 1, "tz::mem::tracking did not count an AutoBlock allocation.");
+		}
+		else
+		{
+			topaz_expect(test_case, during.current_bytes == 0 && during.total_allocations == 0, "tz::mem::tracking recorded allocations despite being disabled.");
+		}
+	}
+	tz::mem::tracking::TagStats after = tz::mem::tracking::get(Tag::Block);
+	topaz_expect(test_case, after.current_bytes == before.current_bytes, "tz::mem::tracking did not un-account a destroyed AutoBlock. Expected ", before.current_bytes, " bytes, got ", after.current_bytes);
+
+	// Arenas account bytes in-use, which go away upon reset.
+	tz::mem::LinearArena arena{256};
+	std::size_t arena_before = tz::mem::tracking::get(Tag::Arena).current_bytes;
+	arena.allocate(64, 1);
+	if constexpr(tz::mem::tracking::enabled)
+	{
+		topaz_expect(test_case, tz::mem::tracking::get(Tag::Arena).current_bytes == arena_before + 64, "tz::mem::tracking did not account an arena allocation.");
+	}
+	arena.reset();
+	topaz_expect(test_case, tz::mem::tracking::get(Tag::Arena).current_bytes == arena_before, "tz::mem::tracking did not un-account an arena reset.");
+
+	// Pools account live elements.
+	tz::mem::AutoBlock pool_block{tz::mem::SoAPool<int, float>::required_size(4)};
+	tz::mem::SoAPool<int, float> pool{pool_block};
+	std::size_t pool_before = tz::mem::tracking::get(Tag::Pool).current_bytes;
+	pool.push(1, 2.0f);
+	if constexpr(tz::mem::tracking::enabled)
+	{
+		topaz_expect(test_case, tz::mem::tracking::get(Tag::Pool).current_bytes == pool_before + sizeof(int) + sizeof(float), "tz::mem::tracking did not account a pool element.");
+	}
+	pool.clear();
+	topaz_expect(test_case, tz::mem::tracking::get(Tag::Pool).current_bytes == pool_before, "tz::mem::tracking did not un-account a cleared pool.");
+
+	// Both of the above live within AutoBlocks, which are already accounted. Totalling them too would count the same memory twice.
+	topaz_expect(test_case, tz::mem::tracking::kind_of(Tag::Block) == tz::mem::tracking::Kind::Host, "tz::mem::tracking excluded AutoBlocks from the host memory total.");
+	topaz_expect(test_case, tz::mem::tracking::kind_of(Tag::Arena) == tz::mem::tracking::Kind::InUse && tz::mem::tracking::kind_of(Tag::Pool) == tz::mem::tracking::Kind::InUse, "tz::mem::tracking included bytes in-use within arenas or pools in totals, counting them twice.");
+	// Video memory is a separate budget, so mustn't be added to host memory.
+	topaz_expect(test_case, tz::mem::tracking::kind_of(Tag::GL) == tz::mem::tracking::Kind::Video, "tz::mem::tracking totalled GL data-stores along with host memory.");
+
+	// Pools which are destroyed without being cleared must still un-account their elements.
+	{
+		tz::mem::AutoBlock uniform_block{sizeof(int) * 4};
+		{
+			tz::mem::UniformPool<int> ints{uniform_block};
+			ints.set(0, 1);
+			ints.set(1, 2);
+			tz::mem::UniformPool<int> moved = std::move(ints);
+			tz::mem::UniformPool<int> copied = moved;
+		}
+		topaz_expect(test_case, tz::mem::tracking::get(Tag::Pool).current_bytes == pool_before, "tz::mem::tracking did not un-account a destroyed pool.");
+	}
+	return test_case;
+}
+
+tz::test::Case scoped_heap()
+{
+	tz::test::Case test_case("tz::mem::tracking Scoped Heap Tests");
+	topaz_expect(test_case, tz::mem::tracking::current_tag() == Tag::Heap, "tz::mem::tracking should default to the heap tag.");
+	std::size_t render_before = tz::mem::tracking::get(Tag::Render).current_bytes;
+	std::unique_ptr<int[]> ints;
+	{
+		tz::mem::tracking::ScopedTag scope{Tag::Render};
+		if constexpr(tz::mem::tracking::enabled)
+		{
+			topaz_expect(test_case, tz::mem::tracking::current_tag() == Tag::Render, "tz::mem::tracking::ScopedTag did not set the current tag.");
+		}
+		ints = std::make_unique<int[]>(256);
+	}
+	topaz_expect(test_case, tz::mem::tracking::current_tag() == Tag::Heap, "tz::mem::tracking::ScopedTag did not restore the previous tag.");
+	if constexpr(tz::mem::tracking::enabled)
+	{
+		topaz_expect(test_case, tz::mem::tracking::get(Tag::Render).current_bytes >= render_before + sizeof(int) * 256, "tz::mem::tracking did not account a heap allocation to the scoped tag.");
+	}
+	// Freeing outside of the scope must still un-account from the tag it was allocated with.
+	ints = nullptr;
+	topaz_expect(test_case, tz::mem::tracking::get(Tag::Render).current_bytes == render_before, "tz::mem::tracking did not un-account a heap allocation from its original tag.");
+	return test_case;
+}
+
+tz::test::Case frames()
+{
+	tz::test::Case test_case("tz::mem::tracking Per-Frame Tests");
+	tz::mem::tracking::next_frame();
+	{
+		tz::mem::AutoBlock a{16};
+		tz::mem::AutoBlock b{16};
+	}
+	tz::mem::tracking::next_frame();
+	std::size_t expected = tz::mem::tracking::enabled ? 2 : 0;
+	std::size_t actual = tz::mem::tracking::get(Tag::Block).frame_allocations;
+	topaz_expect(test_case, actual == expected, "tz::mem::tracking had unexpected per-frame allocation count. Expected ", expected, ", got ", actual);
+	tz::mem::tracking::next_frame();
+	actual = tz::mem::tracking::get(Tag::Block).frame_allocations;
+	topaz_expect(test_case, actual == 0, "tz::mem::tracking did not reset the per-frame allocation count. Expected 0, got ", actual);
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit tracking;
+
+	tracking.add(tagged_blocks());
+	tracking.add(scoped_heap());
+	tracking.add(frames());
+
+	return tracking.result();
+}
@@ -0,0 +1,146 @@
+#include "test_framework.hpp"
+#include "render/frustum_culler.hpp"
+#include "geo/matrix_transform.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Not a multiple of the batch width, so the scalar tail is covered too.
+	constexpr std::size_t counts[] = {0, 1, 3, 4, 1027};
+
+	// Camera at the origin looking down -z, with a 90 degree field of view.
+	tz::render::FrustumCuller camera()
+	{
+		return {tz::geo::perspective(1.5707963f, 1.0f, 1.0f, 100.0f) * tz::geo::view({{{0.0f, 0.0f, 0.0f}}}, {{{0.0f, 0.0f, 0.0f}}})};
+	}
+
+	tz::geo::Bounds cube(float x, float y, float z, float half_size)
+	{
+		const tz::Vec3 centre{{x, y, z}};
+		const tz::Vec3 min{{x - half_size, y - half_size, z - half_size}};
+		const tz::Vec3 max{{x + half_size, y + half_size, z + half_size}};
+		return {{min, max}, {centre, half_size * std::sqrt(3.0f)}};
+	}
+
+	std::vector<tz::geo::Bounds> random_cubes(std::mt19937& rng, std::size_t count)
+	{
+		std::uniform_real_distribution<float> coordinate{-150.0f, 150.0f};
+		std::uniform_real_distribution<float> size{0.0f, 10.0f};
+		std::vector<tz::geo::Bounds> cubes;
+		for(std::size_t i = 0; i < count; i++)
+			cubes.push_back(cube(coordinate(rng), coordinate(rng), coordinate(rng), size(rng)));
+		return cubes;
+	}
+
+	bool near(float a, float b)
+	{
+		return std::abs(a - b) < 0.001f;
+	}
+}
+
+tz::test::Case planes()
+{
+	tz::test::Case test_case("tz::render::FrustumCuller Plane Tests");
+	const tz::render::FrustumCuller culler = camera();
+	const tz::Vec4& near_plane = culler.get_plane(tz::render::FrustumCuller::Plane::Near);
+	const tz::Vec4& far_plane = culler.get_plane(tz::render::FrustumCuller::Plane::Far);
+	const tz::Vec4& left_plane = culler.get_plane(tz::render::FrustumCuller::Plane::Left);
+	topaz_expect(test_case, near(near_plane[2], -1.0f) && near(near_plane[3], -1.0f), "Near plane was unexpected. Expected z <= -1, got (", near_plane[0], ", ", near_plane[1], ", ", near_plane[2], ", ", near_plane[3], ")");
+	topaz_expect(test_case, near(far_plane[2], 1.0f) && near(far_plane[3], 100.0f), "Far plane was unexpected. Expected z >= -100, got (", far_plane[0], ", ", far_plane[1], ", ", far_plane[2], ", ", far_plane[3], ")");
+	// 90 degree fov, so the left plane is at 45 degrees and passes through the camera.
+	topaz_expect(test_case, near(left_plane[0], std::sqrt(0.5f)) && near(left_plane[2], -std::sqrt(0.5f)) && near(left_plane[3], 0.0f), "Left plane was unexpected. Got (", left_plane[0], ", ", left_plane[1], ", ", left_plane[2], ", ", left_plane[3], ")");
+	return test_case;
+}
+
+tz::test::Case visible()
+{
+	tz::test::Case test_case("tz::render::FrustumCuller Visibility Tests");
+	const tz::render::FrustumCuller culler = camera();
+	const tz::geo::Bounds ahead = cube(0.0f, 0.0f, -10.0f, 1.0f);
+	const tz::geo::Bounds behind = cube(0.0f, 0.0f, 10.0f, 1.0f);
+	const tz::geo::Bounds beside = cube(50.0f, 0.0f, -10.0f, 1.0f);
+	const tz::geo::Bounds beyond = cube(0.0f, 0.0f, -200.0f, 1.0f);
+	// Centre is outside of the right plane, but the box pokes into the frustum.
+	const tz::geo::Bounds straddling = cube(11.5f, 0.0f, -10.0f, 2.0f);
+	topaz_expect(test_case, culler.visible(ahead.box) && culler.visible(ahead.sphere), "Volume directly ahead of the camera was culled");
+	topaz_expect(test_case, !culler.visible(behind.box) && !culler.visible(behind.sphere), "Volume behind the camera was not culled");
+	topaz_expect(test_case, !culler.visible(beside.box) && !culler.visible(beside.sphere), "Volume beside the camera was not culled");
+	topaz_expect(test_case, !culler.visible(beyond.box) && !culler.visible(beyond.sphere), "Volume beyond the far plane was not culled");
+	topaz_expect(test_case, culler.visible(straddling.box) && culler.visible(straddling.sphere), "Volume straddling the right plane was culled");
+	return test_case;
+}
+
+tz::test::Case cull_batch()
+{
+	tz::test::Case test_case("tz::render::FrustumCuller Batch Tests");
+	const tz::render::FrustumCuller culler = camera();
+	std::mt19937 rng{1};
+	for(std::size_t count : counts)
+	{
+		const std::vector<tz::geo::Bounds> cubes = random_cubes(rng, count);
+		std::vector<tz::geo::AABB> boxes;
+		std::vector<tz::geo::BoundingSphere> spheres;
+		std::vector<std::size_t> expected_boxes, expected_spheres;
+		for(std::size_t i = 0; i < count; i++)
+		{
+			boxes.push_back(cubes[i].box);
+			spheres.push_back(cubes[i].sphere);
+			if(culler.visible(cubes[i].box))
+				expected_boxes.push_back(i);
+			if(culler.visible(cubes[i].sphere))
+				expected_spheres.push_back(i);
+		}
+		std::vector<std::size_t> visible(count);
+		std::size_t visible_count = culler.cull(tz::mem::Span<const tz::geo::AABB>{boxes.data(), count}, {visible.data(), count});
+		visible.resize(visible_count);
+		topaz_expect(test_case, visible == expected_boxes, "Batched box culling of ", count, " boxes disagreed with visible(AABB). Expected ", expected_boxes.size(), " visible, got ", visible_count);
+		visible.resize(count);
+		visible_count = culler.cull(tz::mem::Span<const tz::geo::BoundingSphere>{spheres.data(), count}, {visible.data(), count});
+		visible.resize(visible_count);
+		topaz_expect(test_case, visible == expected_spheres, "Batched sphere culling of ", count, " spheres disagreed with visible(BoundingSphere). Expected ", expected_spheres.size(), " visible, got ", visible_count);
+	}
+	return test_case;
+}
+
+tz::test::Case cull_snippets()
+{
+	tz::test::Case test_case("tz::render::FrustumCuller Snippet Tests");
+	const tz::render::FrustumCuller culler = camera();
+	std::mt19937 rng{2};
+	for(std::size_t count : counts)
+	{
+		const std::vector<tz::geo::Bounds> cubes = random_cubes(rng, count);
+		tz::gl::IndexSnippetList snippets;
+		for(std::size_t i = 0; i < count; i++)
+			snippets.emplace_range(i * 3, (i * 3) + 2, i);
+		const tz::gl::MDIDrawCommandList commands = culler.cull(snippets, {cubes.data(), count});
+		std::size_t command = 0;
+		for(std::size_t i = 0; i < count; i++)
+		{
+			if(!culler.visible(cubes[i].box))
+				continue;
+			topaz_expect(test_case, command < commands.size(), "Culled command list is missing visible snippet ", i);
+			if(command >= commands.size())
+				break;
+			const tz::gl::MDIDrawCommandList::Command expected = snippets[i].mdi();
+			const tz::gl::MDIDrawCommandList::Command& actual = commands[command++];
+			topaz_expect(test_case, actual.first_index == expected.first_index && actual.count == expected.count && actual.base_vertex == expected.base_vertex, "Culled command ", command - 1, " did not match the command of visible snippet ", i);
+		}
+		topaz_expect(test_case, command == commands.size(), "Culled command list contained ", commands.size(), " commands, but only ", command, " snippets were visible");
+	}
+	return test_case;
+}
+
+int main()
+{
+	tz::test::Unit render;
+
+	render.add(planes());
+	render.add(visible());
+	render.add(cull_batch());
+	render.add(cull_snippets());
+
+	return render.result();
+}